@@ -5,10 +5,13 @@ set (TARGET hsa_async)
 set (SRC_DIR "${CMAKE_SOURCE_DIR}/src/core/async")
 
 ## Included source files.
-set (SOURCE_FILES hsa_async.c test_async_utils.c test_async_invalid_group_memory.c test_async_invalid_packet.c test_async_invalid_dimensions.c test_async_invalid_kernel_object.c test_async_invalid_workgroup_size.c)
+set (SOURCE_FILES hsa_async.c test_async_utils.c test_async_invalid_group_memory.c test_async_invalid_packet.c test_async_invalid_dimensions.c test_async_invalid_kernel_object.c test_async_invalid_workgroup_size.c test_async_error_latency.c)
 
 ## Test list. 
 set (TEST_LIST async_invalid_group_memory async_invalid_dimensions async_invalid_kernel_object)
 
+## Performance test list.
+set (PERF_TEST_LIST async_error_latency)
+
 include (build)
 include (test)
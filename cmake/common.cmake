@@ -11,7 +11,7 @@ set (TEST_LIBRARIES ${UTILS_LIBRARY})
 set (HSA_LIBRARIES ${HSA_RUNTIME_LIBRARY})
 
 ## System libraries.
-set (SYSTEM_LIBRARIES check rt m pthread)
+set (SYSTEM_LIBRARIES check rt m pthread dl)
 
 ## Coding standard used.
 set (C_STANDARD "-std=c99")
@@ -38,3 +38,8 @@ endif()
 if(NOT DEFINED INSTALL_DIR)
     set (INSTALL_DIR "hsa_conformance")
 endif()
+
+## Performance tests are not added to the test list by default.
+if(NOT DEFINED ENABLE_PERFORMANCE_TESTS)
+    set (ENABLE_PERFORMANCE_TESTS FALSE)
+endif()
@@ -9,30 +9,8 @@ set (SOURCE_FILES hsa_image_clear.c test_image_clear.c)
 
 include (image_data)
 
-set (TEST_LIST "")
-
-set (VALID "")
- 
-## Test list
-foreach (CHANNEL_TYPE ${CHANNEL_TYPES})
-
-    foreach (CHANNEL_ORDER ${CHANNEL_ORDERS})
-
-        foreach (GEOMETRY ${GEOMETRIES})
-          
-            valid_image(${CHANNEL_TYPE} ${CHANNEL_ORDER} ${GEOMETRY} VALID)
-
-            if(${VALID} MATCHES TRUE)
-
-                set (TEST_LIST ${TEST_LIST} image_clear_${CHANNEL_TYPE}_${CHANNEL_ORDER}_${GEOMETRY})
-
-            endif()
-
-        endforeach()
-
-    endforeach()
-
-endforeach()
+## Test list, generated with the matrix of image_matrix.h the suite registers its tests from.
+image_test_matrix(image_clear)
 
 include (build)
 include (test)
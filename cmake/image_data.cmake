@@ -95,3 +95,76 @@ function(valid_image CHANNEL_TYPE CHANNEL_ORDER IMAGE_GEOMETRY VALID)
      endif()
 
 endfunction()
+
+## Directory of the image_capability_<agent>.cache files the image suites write.
+## The image test lists leave out the entries no agent supports once there are cache files.
+set (IMAGE_CAPABILITY_CACHE_DIR ${CMAKE_BINARY_DIR} CACHE PATH "Directory of the image capability cache files")
+
+## The hsa_ext_image_capability_t bits of IMAGE_CAPABILITY_TESTABLE in image_capability_utils.h,
+## the access modes the image tests need one of.
+set (IMAGE_CAPABILITY_READ_ONLY 1)
+set (IMAGE_CAPABILITY_READ_WRITE 4)
+set (IMAGE_CAPABILITY_READ_MODIFY_WRITE 8)
+math (EXPR IMAGE_CAPABILITY_TESTABLE "${IMAGE_CAPABILITY_READ_ONLY} | ${IMAGE_CAPABILITY_READ_WRITE} | ${IMAGE_CAPABILITY_READ_MODIFY_WRITE}")
+
+## Set TEST_LIST to the valid image tests named ${PREFIX}_<type>_<order>_<geometry>,
+## and generate image_matrix.h, the matrix of the valid channel types, orders
+## and geometries the image test suites register their tests from.
+function(image_test_matrix PREFIX)
+
+     set (TESTS "")
+     set (MATRIX "")
+
+     ## The entries at least one agent can test: read only, read write or read modify write
+     file (GLOB CAPABILITY_CACHES ${IMAGE_CAPABILITY_CACHE_DIR}/image_capability_*.cache)
+     set (SUPPORTED "")
+     get_filename_component (HSA_RUNTIME_LIBRARY_FILE ${HSA_RUNTIME_LIBRARY} REALPATH)
+     foreach (CAPABILITY_CACHE ${CAPABILITY_CACHES})
+         ## A cache older than the runtime library may miss the formats it added
+         if (EXISTS ${HSA_RUNTIME_LIBRARY_FILE} AND ${HSA_RUNTIME_LIBRARY_FILE} IS_NEWER_THAN ${CAPABILITY_CACHE})
+             list (REMOVE_ITEM CAPABILITY_CACHES ${CAPABILITY_CACHE})
+         endif()
+     endforeach()
+     foreach (CAPABILITY_CACHE ${CAPABILITY_CACHES})
+         file (STRINGS ${CAPABILITY_CACHE} CAPABILITIES REGEX "^[A-Z0-9_]+ [A-Z0-9_]+ [A-Z0-9_]+ [0-9]+$")
+         foreach (CAPABILITY ${CAPABILITIES})
+             string (REGEX REPLACE "^([A-Z0-9_]+) ([A-Z0-9_]+) ([A-Z0-9_]+) ([0-9]+)$" "\\1_\\2_\\3;\\4" CAPABILITY "${CAPABILITY}")
+             list (GET CAPABILITY 0 ENTRY)
+             list (GET CAPABILITY 1 MASK)
+             math (EXPR TESTABLE "${MASK} & ${IMAGE_CAPABILITY_TESTABLE}")
+             if (TESTABLE)
+                 list (APPEND SUPPORTED ${ENTRY})
+             endif()
+         endforeach()
+     endforeach()
+
+     foreach (CHANNEL_TYPE ${CHANNEL_TYPES})
+
+         foreach (CHANNEL_ORDER ${CHANNEL_ORDERS})
+
+             foreach (GEOMETRY ${GEOMETRIES})
+
+                 valid_image(${CHANNEL_TYPE} ${CHANNEL_ORDER} ${GEOMETRY} VALID)
+
+                 if(${VALID} MATCHES TRUE)
+                     list (FIND SUPPORTED ${CHANNEL_TYPE}_${CHANNEL_ORDER}_${GEOMETRY} SUPPORTED_INDEX)
+                     if(NOT CAPABILITY_CACHES OR SUPPORTED_INDEX GREATER -1)
+                         set (TESTS ${TESTS} ${PREFIX}_${CHANNEL_TYPE}_${CHANNEL_ORDER}_${GEOMETRY})
+                     endif()
+                     set (MATRIX "${MATRIX}IMAGE_MATRIX_ENTRY(${CHANNEL_TYPE}, ${CHANNEL_ORDER}, ${GEOMETRY})\n")
+                 endif()
+
+             endforeach()
+
+         endforeach()
+
+     endforeach()
+
+     ## Only replace the header when the matrix changes, to avoid rebuilding the suites
+     file (WRITE ${CMAKE_BINARY_DIR}/image_matrix.h.in "${MATRIX}")
+     configure_file (${CMAKE_BINARY_DIR}/image_matrix.h.in ${CMAKE_BINARY_DIR}/image_matrix.h COPYONLY)
+     include_directories (${CMAKE_BINARY_DIR})
+
+     set (TEST_LIST ${TESTS} PARENT_SCOPE)
+
+endfunction()
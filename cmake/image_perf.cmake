@@ -0,0 +1,17 @@
+## Target executable name.
+set (TARGET hsa_image_perf)
+
+## Specify the SRC_DIR.
+set (SRC_DIR "${CMAKE_SOURCE_DIR}/src/extensions/images/perf")
+
+## Included source files.
+set (SOURCE_FILES hsa_image_perf.c test_image_perf_utils.c test_image_format_conversion.c test_image_import_export_bandwidth.c test_image_clear_throughput.c test_image_copy_throughput.c test_image_query_latency.c test_image_handle_scaling.c)
+
+## Test list.
+set (TEST_LIST "")
+
+## Performance test list.
+set (PERF_TEST_LIST image_format_conversion image_import_export_bandwidth image_clear_throughput image_copy_throughput image_query_latency image_handle_scaling)
+
+include (build)
+include (test)
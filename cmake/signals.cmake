@@ -5,10 +5,13 @@ set (TARGET hsa_signals)
 set (SRC_DIR "${CMAKE_SOURCE_DIR}/src/core/signals")
 
 ## Included source files.
-set (SOURCE_FILES hsa_signals.c test_signal_create_concurrent.c test_signal_create_initial_value.c test_signal_create_max_consumers.c test_signal_create_one_consumers.c test_signal_create_zero_consumers.c test_signal_destroy_concurrent.c test_signal_kernel_multi_set.c test_signal_kernel_multi_wait.c test_signal_kernel_set.c test_signal_kernel_wait.c test_signal_wait_add.c test_signal_wait_and.c test_signal_wait_cas.c test_signal_wait_exchange.c test_signal_wait_or.c test_signal_wait_store.c test_signal_wait_subtract.c test_signal_wait_xor.c test_signal_store_release_load_acquire_ordering.c test_signal_store_release_load_acquire_ordering_transitive.c test_signal_load_store_atomic.c test_signal_add_acq_rel_ordering.c test_signal_add_acq_rel_ordering_transitive.c test_signal_add_acquire_release_ordering.c test_signal_add_acquire_release_ordering_transitive.c test_signal_add_atomic.c test_signal_and_acq_rel_ordering.c test_signal_and_acq_rel_ordering_transitive.c test_signal_and_acquire_release_ordering.c test_signal_and_acquire_release_ordering_transitive.c test_signal_and_atomic.c test_signal_cas_acq_rel_ordering.c test_signal_cas_acq_rel_ordering_transitive.c test_signal_cas_acquire_release_ordering.c test_signal_cas_acquire_release_ordering_transitive.c test_signal_cas_atomic.c test_signal_exchange_acq_rel_ordering.c test_signal_exchange_acq_rel_ordering_transitive.c test_signal_exchange_acquire_release_ordering.c test_signal_exchange_acquire_release_ordering_transitive.c test_signal_exchange_atomic.c test_signal_or_acq_rel_ordering.c test_signal_or_acq_rel_ordering_transitive.c test_signal_or_acquire_release_ordering.c test_signal_or_acquire_release_ordering_transitive.c test_signal_or_atomic.c test_signal_subtract_acq_rel_ordering.c test_signal_subtract_acq_rel_ordering_transitive.c test_signal_subtract_acquire_release_ordering_transitive.c test_signal_subtract_atomic.c test_signal_xor_acq_rel_ordering.c test_signal_xor_acq_rel_ordering_transitive.c test_signal_xor_acquire_release_ordering.c test_signal_xor_acquire_release_ordering_transitive.c test_signal_xor_atomic.c test_signal_wait_conditions.c test_signal_wait_satisfied_conditions.c test_signal_wait_expectancy.c test_signal_wait_utils.c test_signal_wait_timeout.c)
+set (SOURCE_FILES hsa_signals.c test_signal_create_concurrent.c test_signal_create_initial_value.c test_signal_create_max_consumers.c test_signal_create_one_consumers.c test_signal_create_zero_consumers.c test_signal_destroy_concurrent.c test_signal_kernel_multi_set.c test_signal_kernel_multi_wait.c test_signal_kernel_set.c test_signal_kernel_wait.c test_signal_wait_add.c test_signal_wait_and.c test_signal_wait_cas.c test_signal_wait_exchange.c test_signal_wait_or.c test_signal_wait_store.c test_signal_wait_subtract.c test_signal_wait_xor.c test_signal_store_release_load_acquire_ordering.c test_signal_store_release_load_acquire_ordering_transitive.c test_signal_load_store_atomic.c test_signal_add_acq_rel_ordering.c test_signal_add_acq_rel_ordering_transitive.c test_signal_add_acquire_release_ordering.c test_signal_add_acquire_release_ordering_transitive.c test_signal_add_atomic.c test_signal_and_acq_rel_ordering.c test_signal_and_acq_rel_ordering_transitive.c test_signal_and_acquire_release_ordering.c test_signal_and_acquire_release_ordering_transitive.c test_signal_and_atomic.c test_signal_cas_acq_rel_ordering.c test_signal_cas_acq_rel_ordering_transitive.c test_signal_cas_acquire_release_ordering.c test_signal_cas_acquire_release_ordering_transitive.c test_signal_cas_atomic.c test_signal_exchange_acq_rel_ordering.c test_signal_exchange_acq_rel_ordering_transitive.c test_signal_exchange_acquire_release_ordering.c test_signal_exchange_acquire_release_ordering_transitive.c test_signal_exchange_atomic.c test_signal_or_acq_rel_ordering.c test_signal_or_acq_rel_ordering_transitive.c test_signal_or_acquire_release_ordering.c test_signal_or_acquire_release_ordering_transitive.c test_signal_or_atomic.c test_signal_subtract_acq_rel_ordering.c test_signal_subtract_acq_rel_ordering_transitive.c test_signal_subtract_acquire_release_ordering_transitive.c test_signal_subtract_atomic.c test_signal_xor_acq_rel_ordering.c test_signal_xor_acq_rel_ordering_transitive.c test_signal_xor_acquire_release_ordering.c test_signal_xor_acquire_release_ordering_transitive.c test_signal_xor_atomic.c test_signal_wait_conditions.c test_signal_wait_satisfied_conditions.c test_signal_wait_expectancy.c test_signal_wait_utils.c test_signal_wait_timeout.c test_signal_pool_dispatch.c)
 
 ## Test list.
 set (TEST_LIST signal_create_concurrent signal_create_initial_value signal_create_max_consumers signal_create_one_consumers signal_create_zero_consumers signal_destroy_concurrent signal_kernel_multi_set signal_kernel_multi_wait signal_kernel_set signal_kernel_wait signal_wait_acquire_timeout signal_wait_acquire_add signal_wait_acquire_and signal_wait_acquire_or signal_wait_acquire_subtract signal_wait_acquire_xor signal_wait_relaxed_timeout signal_wait_relaxed_add signal_wait_relaxed_and signal_wait_relaxed_or signal_wait_relaxed_subtract signal_wait_relaxed_xor signal_wait_conditions signal_wait_expectancy signal_wait_satisfied_conditions signal_wait_store_release signal_wait_store_relaxed signal_store_release_load_acquire_ordering signal_store_release_load_acquire_ordering_transitive signal_load_store_atomic signal_add_acq_rel_ordering signal_add_acq_rel_ordering_transitive signal_add_acquire_release_ordering signal_add_acquire_release_ordering_transitive signal_add_atomic_acq_rel signal_add_atomic_acquire signal_add_atomic_release signal_add_atomic_relaxed signal_and_acq_rel_ordering signal_and_acq_rel_ordering_transitive signal_and_acquire_release_ordering signal_and_acquire_release_ordering_transitive signal_and_atomic_acq_rel signal_and_atomic_acquire signal_and_atomic_release signal_and_atomic_relaxed signal_cas_acq_rel_ordering signal_cas_acquire_release_ordering signal_cas_atomic_acq_rel signal_cas_atomic_acquire signal_cas_atomic_release signal_cas_atomic_relaxed signal_exchange_acq_rel_ordering signal_exchange_acquire_release_ordering signal_exchange_acquire_release_ordering_transitive signal_exchange_atomic_acq_rel signal_exchange_atomic_acquire signal_exchange_atomic_release signal_exchange_atomic_relaxed signal_or_acq_rel_ordering signal_or_acq_rel_ordering_transitive signal_or_acquire_release_ordering signal_or_acquire_release_ordering_transitive signal_or_atomic_acq_rel signal_or_atomic_acquire signal_or_atomic_release signal_or_atomic_relaxed signal_subtract_acq_rel_ordering signal_subtract_acq_rel_ordering_transitive signal_subtract_acquire_release_ordering_transitive signal_subtract_atomic_acq_rel signal_subtract_atomic_acquire signal_subtract_atomic_release signal_subtract_atomic_relaxed signal_xor_acq_rel_ordering signal_xor_acq_rel_ordering_transitive signal_xor_acquire_release_ordering signal_xor_acquire_release_ordering_transitive signal_xor_atomic_acq_rel signal_xor_atomic_acquire signal_xor_atomic_release signal_xor_atomic_relaxed)  
 
+## Performance test list.
+set (PERF_TEST_LIST signal_pool_dispatch)
+
 include (build)
 include (test)
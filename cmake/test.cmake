@@ -1,3 +1,8 @@
+## Add the performance tests to the test list if they are enabled
+if (ENABLE_PERFORMANCE_TESTS)
+    list (APPEND TEST_LIST ${PERF_TEST_LIST})
+endif ()
+
 ## Add tests to the test list
 
 set (COMMAND_STRING "")
@@ -20,3 +25,4 @@ endforeach ()
 install(FILES ${CMAKE_BINARY_DIR}/test.lst DESTINATION ${INSTALL_DIR})
 
 set (TEST_LIST "")
+set (PERF_TEST_LIST "")
@@ -5,7 +5,7 @@ set (TARGET ${UTILS_LIBRARY})
 set (SRC_DIR "${CMAKE_SOURCE_DIR}/src/utils")
 
 ## Included source files.
-set (SOURCE_FILES agent_utils.c concurrent_utils.c dispatch_utils.c finalize_utils.c image_utils.c queue_utils.c)
+set (SOURCE_FILES agent_utils.c arena_utils.c concurrent_utils.c dispatch_utils.c finalize_utils.c image_capability_utils.c image_format_utils.c image_matrix_utils.c image_utils.c image_verify_utils.c perf_utils.c queue_utils.c reaper_utils.c signal_pool_utils.c soft_queue_utils.c)
 
 ## Library build directives.
 include(buildlib)
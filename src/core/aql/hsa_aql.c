@@ -48,6 +48,8 @@
 #include "hsa_aql.h"
 
 DEFINE_TEST(aql_launch_size)
+DEFINE_TEST(aql_launch_geometry)
+DEFINE_TEST(aql_segment_size_cost)
 DEFINE_TEST(aql_barrier_bit_not_set)
 DEFINE_TEST(aql_barrier_bit_set)
 DEFINE_TEST(aql_barrier_cross_queue_dependency)
@@ -55,6 +57,9 @@ DEFINE_TEST(aql_barrier_cross_queue_dependency_negative_value)
 DEFINE_TEST(aql_barrier_multiple_barriers)
 DEFINE_TEST(aql_barrier_and)
 DEFINE_TEST(aql_barrier_or)
+DEFINE_TEST(aql_barrier_latency)
+DEFINE_TEST(aql_barrier_chain_throughput)
+DEFINE_TEST(aql_barrier_cross_queue_latency)
 DEFINE_TEST(aql_group_memory)
 DEFINE_TEST(aql_group_memory_overspecified)
 DEFINE_TEST(aql_private_memory)
@@ -64,6 +69,8 @@ DEFINE_TEST(aql_zero_wg_size)
 int main(int argc, char* argv[]) {
     INITIALIZE_TESTSUITE();
     ADD_TEST(aql_launch_size);
+    ADD_TEST(aql_launch_geometry);
+    ADD_TEST(aql_segment_size_cost);
     ADD_TEST(aql_barrier_bit_not_set);
     ADD_TEST(aql_barrier_bit_set);
     ADD_TEST(aql_barrier_cross_queue_dependency)
@@ -71,6 +78,9 @@ int main(int argc, char* argv[]) {
     ADD_TEST(aql_barrier_multiple_barriers)
     ADD_TEST(aql_barrier_and);
     ADD_TEST(aql_barrier_or);
+    ADD_TEST(aql_barrier_latency);
+    ADD_TEST(aql_barrier_chain_throughput);
+    ADD_TEST(aql_barrier_cross_queue_latency);
     ADD_TEST(aql_group_memory)
     ADD_TEST(aql_group_memory_overspecified)
     ADD_TEST(aql_private_memory)
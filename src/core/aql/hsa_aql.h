@@ -46,6 +46,8 @@
 #ifndef _HSA_AQL_H_
 #define _HSA_AQL_H_
 extern int test_aql_launch_size();
+extern int test_aql_launch_geometry();
+extern int test_aql_segment_size_cost();
 extern int test_aql_barrier_bit_set();
 extern int test_aql_barrier_bit_not_set();
 extern int test_aql_barrier_cross_queue_dependency();
@@ -53,6 +55,9 @@ extern int test_aql_barrier_cross_queue_dependency_negative_value();
 extern int test_aql_barrier_multiple_barriers();
 extern int test_aql_barrier_and();
 extern int test_aql_barrier_or();
+extern int test_aql_barrier_latency();
+extern int test_aql_barrier_chain_throughput();
+extern int test_aql_barrier_cross_queue_latency();
 extern int test_aql_group_memory();
 extern int test_aql_group_memory_overspecified();
 extern int test_aql_private_memory();
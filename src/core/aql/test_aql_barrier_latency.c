@@ -0,0 +1,636 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: aql_barrier_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures the latency from the decrement of a barrier packet's
+ * dependency signal to the completion of the barrier packet, for Barrier-AND
+ * and Barrier-OR packets with 1 to 5 dependency signals.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH create a queue.
+ * 2) For each barrier type and each dependency count, repeat the following
+ * BARRIER_LATENCY_ITERATIONS times:
+ *    a) Initialize the dependency signals and the completion signal to 1.
+ *    b) Enqueue a barrier packet that depends on the signals.
+ *    c) For Barrier-AND packets set all but the last dependency signal to 0.
+ *    d) Time the store of 0 to the last (AND) or first (OR) dependency signal
+ *    until a host thread actively waiting on the completion signal observes 0.
+ * 3) Report the latency statistics for each barrier type and dependency count.
+ *
+ * Expected Results: All barrier packets should complete.
+ */
+
+/*
+ * Test Name: aql_barrier_chain_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the cost of a dependency edge when a queue is filled to
+ * its full depth with alternating dispatch and barrier packets, each barrier
+ * depending on the completion signal of the dispatch before it.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH create a
+ * queue of BARRIER_CHAIN_QUEUE_SIZE packets, or the maximum queue size if smaller.
+ * 2) Load and initialize the no_op kernel.
+ * 3) Fill the queue with alternating no_op dispatch packets and Barrier-AND
+ * packets. Each dispatch has its own completion signal and the following
+ * barrier depends on it. The headers are published back to front so the
+ * packet processor starts on a full queue.
+ * 4) Time the execution of the chain until the last barrier completes.
+ * 5) Fill the queue with the same number of no_op dispatch packets, with the
+ * barrier bit set and no barrier packets, and time their execution.
+ * 6) Repeat steps 3 to 5 BARRIER_CHAIN_ITERATIONS times and report the
+ * time per barrier edge as the difference between the two runs.
+ *
+ * Expected Results: All packets should complete.
+ */
+
+/*
+ * Test Name: aql_barrier_cross_queue_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures the latency of a barrier dependency across two queues,
+ * on different agents if the platform has more than one dispatch agent.
+ *
+ * Test Description:
+ * 1) Create a queue on the first dispatch agent, and a queue on the second
+ * dispatch agent or, if there is only one, on the first agent.
+ * 2) Repeat the following BARRIER_LATENCY_ITERATIONS times:
+ *    a) Initialize three signals to 1.
+ *    b) Enqueue a barrier on the first queue that depends on signal 0
+ *    and completes signal 1.
+ *    c) Enqueue a barrier on the second queue that depends on signal 1
+ *    and completes signal 2.
+ *    d) Set signal 0 to 0 and time the completion of signal 1 and signal 2.
+ * 3) Report the latency of the same-queue hop (signal 0 to signal 1) and the
+ * cross-queue hop (signal 1 to signal 2).
+ *
+ * Expected Results: All barrier packets should complete.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BARRIER_LATENCY_QUEUE_SIZE 1024
+#define BARRIER_LATENCY_ITERATIONS 1000
+#define BARRIER_CHAIN_QUEUE_SIZE 1024
+#define BARRIER_CHAIN_ITERATIONS 10
+#define BARRIER_MAX_DEP_SIGNALS 5
+
+// Build the header of a barrier packet
+static uint16_t barrier_header(hsa_packet_type_t type) {
+    uint16_t header = 0;
+    header |= HSA_FENCE_SCOPE_AGENT << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+    header |= type << HSA_PACKET_HEADER_TYPE;
+    return header;
+}
+
+// Write the body of a barrier packet at write_index, leaving the header untouched.
+// The Barrier-AND and Barrier-OR packets have the same layout.
+static hsa_barrier_and_packet_t* write_barrier_packet(hsa_queue_t* queue,
+                                                      uint64_t write_index,
+                                                      hsa_signal_t* dep_signals,
+                                                      int num_dep_signals,
+                                                      hsa_signal_t completion_signal) {
+    const uint32_t queue_mask = queue->size - 1;
+    hsa_barrier_and_packet_t* barrier_packet
+              = &((hsa_barrier_and_packet_t*)(queue->base_address))[write_index&queue_mask];
+    memset(((uint8_t*) barrier_packet) + sizeof(barrier_packet->header), 0, sizeof(hsa_barrier_and_packet_t) - sizeof(barrier_packet->header));
+
+    int ii;
+    for (ii = 0; ii < num_dep_signals; ++ii) {
+        barrier_packet->dep_signal[ii] = dep_signals[ii];
+    }
+    barrier_packet->completion_signal = completion_signal;
+
+    return barrier_packet;
+}
+
+// Enqueue a barrier packet and ring the doorbell
+static void enqueue_barrier_packet(hsa_queue_t* queue,
+                                   hsa_packet_type_t type,
+                                   hsa_signal_t* dep_signals,
+                                   int num_dep_signals,
+                                   hsa_signal_t completion_signal) {
+    uint64_t write_index = hsa_queue_add_write_index_relaxed(queue, 1);
+
+    // Block until the queue has an empty packet slot
+    while (write_index - hsa_queue_load_read_index_relaxed(queue) >= queue->size);
+
+    hsa_barrier_and_packet_t* barrier_packet = write_barrier_packet(queue, write_index, dep_signals, num_dep_signals, completion_signal);
+    __atomic_store_n(&barrier_packet->header, barrier_header(type), __ATOMIC_RELEASE);
+    hsa_signal_store_release(queue->doorbell_signal, write_index);
+
+    return;
+}
+
+// Wait for a signal to reach 0 with an active wait, to minimize the wake up latency
+static void wait_signal_zero(hsa_signal_t signal) {
+    while (0 != hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_ACTIVE));
+    return;
+}
+
+int test_aql_barrier_latency() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t iterations = (uint32_t) perf_get_env_uint("BARRIER_LATENCY_ITERATIONS", BARRIER_LATENCY_ITERATIONS);
+    ASSERT(0 < iterations);
+
+    double* samples = (double*) malloc(iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    const hsa_packet_type_t types[2] = {HSA_PACKET_TYPE_BARRIER_AND, HSA_PACKET_TYPE_BARRIER_OR};
+    const char* type_names[2] = {"barrier_and", "barrier_or"};
+
+    // Repeat the test for each agent
+    int ii, jj, kk, tt, num_deps;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        uint32_t queue_size = BARRIER_LATENCY_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // Create the queue
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], queue_size, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create the dependency signals and the completion signal
+        hsa_signal_t dep_signals[BARRIER_MAX_DEP_SIGNALS];
+        for (jj = 0; jj < BARRIER_MAX_DEP_SIGNALS; ++jj) {
+            status = hsa_signal_create(1, 0, NULL, &dep_signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        hsa_signal_t completion_signal;
+        status = hsa_signal_create(1, 0, NULL, &completion_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        printf("\nAgent %d:\n", ii);
+
+        for (tt = 0; tt < 2; ++tt) {
+            for (num_deps = 1; num_deps <= BARRIER_MAX_DEP_SIGNALS; ++num_deps) {
+                for (kk = 0; kk < iterations; ++kk) {
+                    // Reinitialize the signals
+                    for (jj = 0; jj < num_deps; ++jj) {
+                        hsa_signal_store_relaxed(dep_signals[jj], 1);
+                    }
+                    hsa_signal_store_relaxed(completion_signal, 1);
+
+                    enqueue_barrier_packet(queue, types[tt], dep_signals, num_deps, completion_signal);
+
+                    // Resolve all but the last dependency of a Barrier-AND packet
+                    int trigger = 0;
+                    if (HSA_PACKET_TYPE_BARRIER_AND == types[tt]) {
+                        for (jj = 0; jj < num_deps - 1; ++jj) {
+                            hsa_signal_store_release(dep_signals[jj], 0);
+                        }
+                        trigger = num_deps - 1;
+                    }
+
+                    // The barrier can't complete before the trigger
+                    ASSERT(1 == hsa_signal_load_acquire(completion_signal));
+
+                    uint64_t start_ns = perf_get_time_ns();
+                    hsa_signal_store_release(dep_signals[trigger], 0);
+                    wait_signal_zero(completion_signal);
+                    samples[kk] = (double) (perf_get_time_ns() - start_ns) * 1e-3;
+                }
+
+                perf_stats_t stats;
+                perf_compute_stats(samples, iterations, &stats);
+                char label[64];
+                snprintf(label, sizeof(label), "%s %d dep latency", type_names[tt], num_deps);
+                perf_print_stats(label, "us", &stats);
+            }
+        }
+
+        // Destroy all signals
+        for (jj = 0; jj < BARRIER_MAX_DEP_SIGNALS; ++jj) {
+            status = hsa_signal_destroy(dep_signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        status = hsa_signal_destroy(completion_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the queue
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(samples);
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
+
+int test_aql_barrier_chain_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("no_op.brig", &module));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t iterations = (uint32_t) perf_get_env_uint("BARRIER_CHAIN_ITERATIONS", BARRIER_CHAIN_ITERATIONS);
+    uint32_t requested_size = (uint32_t) perf_get_env_uint("BARRIER_CHAIN_QUEUE_SIZE", BARRIER_CHAIN_QUEUE_SIZE);
+    ASSERT(0 < iterations && 2 <= requested_size);
+
+    double* edge_samples = (double*) malloc(iterations * sizeof(double));
+    ASSERT(NULL != edge_samples);
+
+    // Repeat the test for each agent
+    int ii, jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Use the largest power of two queue size that fits
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        uint32_t queue_size = 2;
+        while (queue_size * 2 <= requested_size && queue_size * 2 <= queue_max_size) {
+            queue_size *= 2;
+        }
+        const uint32_t num_edges = queue_size / 2;
+
+        // Create the queue
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], queue_size, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__no_op_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create a completion signal for each dispatch and one for the whole chain
+        hsa_signal_t* dispatch_signals = (hsa_signal_t*) malloc(num_edges * sizeof(hsa_signal_t));
+        ASSERT(NULL != dispatch_signals);
+        for (jj = 0; jj < num_edges; ++jj) {
+            status = hsa_signal_create(1, 0, NULL, &dispatch_signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        hsa_signal_t done_signal;
+        status = hsa_signal_create(1, 0, NULL, &done_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // The no_op dispatch packet prototype
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.setup = 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        dispatch_packet.workgroup_size_x = 256;
+        dispatch_packet.workgroup_size_y = 1;
+        dispatch_packet.workgroup_size_z = 1;
+        dispatch_packet.grid_size_x = 256;
+        dispatch_packet.grid_size_y = 1;
+        dispatch_packet.grid_size_z = 1;
+        dispatch_packet.group_segment_size = symbol_record.group_segment_size;
+        dispatch_packet.private_segment_size = symbol_record.private_segment_size;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+
+        uint16_t dispatch_header = 0;
+        dispatch_header |= HSA_FENCE_SCOPE_AGENT << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_header |= HSA_FENCE_SCOPE_AGENT << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+
+        const uint32_t queue_mask = queue->size - 1;
+        hsa_kernel_dispatch_packet_t* packets = (hsa_kernel_dispatch_packet_t*) queue->base_address;
+        uint16_t headers[queue_size];
+
+        double chain_us = 0.0, baseline_us = 0.0;
+        for (kk = 0; kk < iterations; ++kk) {
+            // Timed run 0 is the dispatch/barrier chain, run 1 is the
+            // dispatch only baseline with the barrier bit set.
+            double run_us[2];
+            int run;
+            for (run = 0; run < 2; ++run) {
+                uint32_t num_packets = (0 == run) ? 2 * num_edges : num_edges;
+
+                for (jj = 0; jj < num_edges; ++jj) {
+                    hsa_signal_store_relaxed(dispatch_signals[jj], 1);
+                }
+                hsa_signal_store_relaxed(done_signal, 1);
+
+                // The queue must be empty before it is filled
+                uint64_t write_index = hsa_queue_add_write_index_relaxed(queue, num_packets);
+                while (write_index != hsa_queue_load_read_index_acquire(queue));
+
+                // Write the packet bodies, leaving the headers invalid
+                for (jj = 0; jj < num_edges; ++jj) {
+                    uint64_t dispatch_index = (0 == run) ? write_index + 2 * jj : write_index + jj;
+                    hsa_kernel_dispatch_packet_t* packet = &packets[dispatch_index&queue_mask];
+                    memcpy(&packet->setup, &dispatch_packet.setup, sizeof(hsa_kernel_dispatch_packet_t) - sizeof(packet->header));
+
+                    if (0 == run) {
+                        packet->completion_signal = dispatch_signals[jj];
+                        headers[2 * jj] = dispatch_header;
+
+                        // The barrier depends on the dispatch before it
+                        hsa_signal_t completion_signal;
+                        completion_signal.handle = 0;
+                        if (num_edges - 1 == jj) {
+                            completion_signal = done_signal;
+                        }
+                        write_barrier_packet(queue, dispatch_index + 1, &dispatch_signals[jj], 1, completion_signal);
+                        headers[2 * jj + 1] = barrier_header(HSA_PACKET_TYPE_BARRIER_AND);
+                    } else {
+                        packet->completion_signal.handle = 0;
+                        if (num_edges - 1 == jj) {
+                            packet->completion_signal = done_signal;
+                        }
+                        headers[jj] = dispatch_header | (1 << HSA_PACKET_HEADER_BARRIER);
+                    }
+                }
+
+                // Publish the headers back to front and ring the doorbell once
+                uint64_t start_ns = 0;
+                int pp;
+                for (pp = (int) num_packets - 1; pp >= 0; --pp) {
+                    if (0 == pp) {
+                        start_ns = perf_get_time_ns();
+                    }
+                    __atomic_store_n((uint16_t*) &packets[(write_index + pp)&queue_mask], headers[pp], __ATOMIC_RELEASE);
+                }
+                hsa_signal_store_release(queue->doorbell_signal, write_index + num_packets - 1);
+
+                wait_signal_zero(done_signal);
+                run_us[run] = (double) (perf_get_time_ns() - start_ns) * 1e-3;
+            }
+
+            chain_us += run_us[0];
+            baseline_us += run_us[1];
+            edge_samples[kk] = (run_us[0] - run_us[1]) / (double) num_edges;
+        }
+
+        printf("\nAgent %d: %u dispatch/barrier pairs per chain\n", ii, num_edges);
+        printf("chain %.3f us, dispatch only %.3f us, %.0f barrier edges/s\n",
+               chain_us / iterations, baseline_us / iterations,
+               (double) num_edges * iterations / (chain_us * 1e-6));
+
+        perf_stats_t stats;
+        perf_compute_stats(edge_samples, iterations, &stats);
+        perf_print_stats("barrier edge cost", "us", &stats);
+
+        // Destroy all signals
+        for (jj = 0; jj < num_edges; ++jj) {
+            status = hsa_signal_destroy(dispatch_signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        free(dispatch_signals);
+        status = hsa_signal_destroy(done_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the queue
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(edge_samples);
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
+
+int test_aql_barrier_cross_queue_latency() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t iterations = (uint32_t) perf_get_env_uint("BARRIER_LATENCY_ITERATIONS", BARRIER_LATENCY_ITERATIONS);
+    ASSERT(0 < iterations);
+
+    // Collect all the dispatch agents
+    int num_dispatch_agents = 0;
+    hsa_agent_t dispatch_agents[agent_list.num_agents];
+    int ii, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        dispatch_agents[num_dispatch_agents] = agent_list.agents[ii];
+        ++num_dispatch_agents;
+    }
+
+    if (0 == num_dispatch_agents) {
+        free_agent_list(&agent_list);
+        status = hsa_shut_down();
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        return 0;
+    }
+
+    // Use a second agent for the dependent queue if there is one
+    hsa_agent_t queue_agents[2];
+    queue_agents[0] = dispatch_agents[0];
+    queue_agents[1] = (num_dispatch_agents > 1) ? dispatch_agents[1] : dispatch_agents[0];
+
+    hsa_queue_t* queues[2];
+    for (ii = 0; ii < 2; ++ii) {
+        uint32_t queue_size = BARRIER_LATENCY_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(queue_agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        status = hsa_queue_create(queue_agents[ii], queue_size, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queues[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Create signals
+    hsa_signal_t signals[3];
+    for (ii = 0; ii < 3; ++ii) {
+        status = hsa_signal_create(1, 0, NULL, &signals[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    double* local_samples = (double*) malloc(iterations * sizeof(double));
+    double* cross_samples = (double*) malloc(iterations * sizeof(double));
+    ASSERT(NULL != local_samples && NULL != cross_samples);
+
+    for (kk = 0; kk < iterations; ++kk) {
+        for (ii = 0; ii < 3; ++ii) {
+            hsa_signal_store_relaxed(signals[ii], 1);
+        }
+
+        enqueue_barrier_packet(queues[0], HSA_PACKET_TYPE_BARRIER_AND, &signals[0], 1, signals[1]);
+        enqueue_barrier_packet(queues[1], HSA_PACKET_TYPE_BARRIER_AND, &signals[1], 1, signals[2]);
+
+        // Trigger the barrier in the first queue
+        uint64_t start_ns = perf_get_time_ns();
+        hsa_signal_store_release(signals[0], 0);
+        wait_signal_zero(signals[1]);
+        uint64_t local_ns = perf_get_time_ns();
+        wait_signal_zero(signals[2]);
+        uint64_t cross_ns = perf_get_time_ns();
+
+        local_samples[kk] = (double) (local_ns - start_ns) * 1e-3;
+        cross_samples[kk] = (double) (cross_ns - local_ns) * 1e-3;
+    }
+
+    printf("\n%s\n", (num_dispatch_agents > 1) ? "Dependent queue on a second agent:" : "Dependent queue on the same agent:");
+
+    perf_stats_t stats;
+    perf_compute_stats(local_samples, iterations, &stats);
+    perf_print_stats("same queue hop", "us", &stats);
+    perf_compute_stats(cross_samples, iterations, &stats);
+    perf_print_stats("cross queue hop", "us", &stats);
+
+    free(local_samples);
+    free(cross_samples);
+
+    // Destroy all signals
+    for (ii = 0; ii < 3; ++ii) {
+        status = hsa_signal_destroy(signals[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Destroy all queues
+    for (ii = 0; ii < 2; ++ii) {
+        status = hsa_queue_destroy(queues[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,353 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: aql_launch_geometry
+ * Scope: Performance
+ *
+ * Purpose: Measures how the dispatch to completion time of the init_data kernel
+ * depends on the grid and workgroup geometry, to find the launch overhead
+ * floor and the grid size where the kernel execution time starts to dominate.
+ *
+ * Test Description:
+ * 1) For each agent that supports kernel dispatch, create a queue and finalize
+ * the init_data kernel.
+ * 2) For 1, 2 and 3 dimensions, for grid sizes of 1, 4, 16, ... work-items up
+ * to LAUNCH_GEOMETRY_MAX_ITEMS, and for workgroup sizes of 1, 4, 16, ... up to
+ * HSA_AGENT_INFO_WORKGROUP_MAX_SIZE work-items:
+ *    a) Split the sizes evenly over the dimensions, skipping geometries that
+ *    exceed HSA_AGENT_INFO_GRID_MAX_DIM or HSA_AGENT_INFO_WORKGROUP_MAX_DIM.
+ *    b) Dispatch the kernel once to warm up, then LAUNCH_GEOMETRY_ITERATIONS
+ *    times, timing each from publishing the packet to observing completion.
+ *    c) Verify the grid has been initialized.
+ * 3) Report the median and minimum dispatch to completion time and the
+ * work-items per second of each geometry. For each number of dimensions,
+ * report the launch overhead floor (the lowest median time) and the smallest
+ * grid whose best median time is more than twice the floor.
+ *
+ * Expected Results: All dispatches should complete and the data should be
+ * initialized correctly.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_helper_func.h"
+
+#define LAUNCH_GEOMETRY_MAX_ITEMS 4*1024*1024
+#define LAUNCH_GEOMETRY_ITERATIONS 20
+#define LAUNCH_GEOMETRY_MAX_LOG2_WORKGROUP 10
+
+// Split 2^log2_size over dim dimensions, giving any remainder to the lower dimensions
+static void split_pow2(uint32_t log2_size, int dim, uint32_t size[3]) {
+    uint32_t log2_dim[3] = {0, 0, 0};
+    uint32_t ii;
+    for (ii = 0; ii < log2_size; ++ii) {
+        ++log2_dim[ii % dim];
+    }
+    for (ii = 0; ii < 3; ++ii) {
+        size[ii] = 1u << log2_dim[ii];
+    }
+    return;
+}
+
+int test_aql_launch_geometry() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("init_data.brig", &module));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint64_t max_items = perf_get_env_uint("LAUNCH_GEOMETRY_MAX_ITEMS", LAUNCH_GEOMETRY_MAX_ITEMS);
+    uint32_t num_iterations = (uint32_t) perf_get_env_uint("LAUNCH_GEOMETRY_ITERATIONS", LAUNCH_GEOMETRY_ITERATIONS);
+    ASSERT(0 < max_items && max_items <= UINT32_MAX && 0 < num_iterations);
+
+    double* samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    int ii;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            // Continue if this agent does not support DISPATCH
+            continue;
+        }
+
+        // Find a memory region in the global segment
+        hsa_region_t global_region;
+        global_region.handle=(uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t)-1 == global_region.handle) {
+            // Skip the test if global fine grained memory isn't available
+            continue;
+        }
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        hsa_dim3_t grid_max_dim;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_DIM, &grid_max_dim);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        uint32_t grid_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_SIZE, &grid_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        uint16_t workgroup_max_dim[3];
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_DIM, workgroup_max_dim);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        uint32_t workgroup_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_SIZE, &workgroup_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // The largest grid must fit in the data buffer and the agent limits
+        uint32_t total_size = (max_items < grid_max_size) ? (uint32_t) max_items : grid_max_size;
+        uint32_t *data;
+        status = hsa_memory_allocate(global_region, total_size * sizeof(uint32_t), (void**) &data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create the queue
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], 1024, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__init_int_data_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Allocate the kernel argument buffer from the correct region
+        void* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, sizeof(kernarg_t), &kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        hsa_signal_t signal;
+        status = hsa_signal_create(1, 0, NULL, &signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+        dispatch_packet.group_segment_size = symbol_record.group_segment_size;
+        dispatch_packet.private_segment_size = symbol_record.private_segment_size;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+        dispatch_packet.kernarg_address = kernarg_buffer;
+        dispatch_packet.completion_signal = signal;
+
+        printf("\nAgent %d: up to %u work-items, workgroups of up to %u work-items, %u iterations\n",
+               ii, total_size, workgroup_max_size, num_iterations);
+        printf("%3s %20s %16s %12s %12s %14s\n", "dim", "grid", "workgroup", "p50 us", "min us", "work-items/s");
+
+        uint32_t value = 1;
+        int dim;
+        for (dim = 1; dim <= 3; ++dim) {
+            double floor_us = 0.0;
+            double best_us[33];
+            uint32_t log2_grid, log2_workgroup;
+            for (log2_grid = 0; log2_grid < 33; ++log2_grid) {
+                best_us[log2_grid] = 0.0;
+            }
+
+            for (log2_grid = 0; ((uint64_t) 1 << log2_grid) <= total_size; log2_grid += 2) {
+                uint32_t grid[3];
+                split_pow2(log2_grid, dim, grid);
+                if (grid[0] > grid_max_dim.x || grid[1] > grid_max_dim.y || grid[2] > grid_max_dim.z) {
+                    continue;
+                }
+                uint32_t grid_items = grid[0] * grid[1] * grid[2];
+
+                kernarg_t args;
+                args.data = data;
+                args.row_pitch = grid[0];
+                args.slice_pitch = grid[0] * grid[1];
+
+                for (log2_workgroup = 0; log2_workgroup <= LAUNCH_GEOMETRY_MAX_LOG2_WORKGROUP; log2_workgroup += 2) {
+                    uint32_t workgroup[3];
+                    split_pow2(log2_workgroup, dim, workgroup);
+                    if ((1u << log2_workgroup) > workgroup_max_size || workgroup[0] > workgroup_max_dim[0] ||
+                        workgroup[1] > workgroup_max_dim[1] || workgroup[2] > workgroup_max_dim[2]) {
+                        continue;
+                    }
+
+                    dispatch_packet.setup = dim << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+                    dispatch_packet.workgroup_size_x = (uint16_t) workgroup[0];
+                    dispatch_packet.workgroup_size_y = (uint16_t) workgroup[1];
+                    dispatch_packet.workgroup_size_z = (uint16_t) workgroup[2];
+                    dispatch_packet.grid_size_x = grid[0];
+                    dispatch_packet.grid_size_y = grid[1];
+                    dispatch_packet.grid_size_z = grid[2];
+
+                    args.value = value;
+                    memcpy(kernarg_buffer, &args, sizeof(args));
+
+                    // Warm up, then time the dispatches
+                    launch_timed_kernel(queue, &dispatch_packet, UINT64_MAX);
+                    uint32_t jj;
+                    for (jj = 0; jj < num_iterations; ++jj) {
+                        samples[jj] = (double) launch_timed_kernel(queue, &dispatch_packet, UINT64_MAX) * 1e-3;
+                    }
+
+                    // Verify the grid has been initialized
+                    for (jj = 0; jj < grid_items; ++jj) {
+                        ASSERT(value == data[jj]);
+                    }
+                    ++value;
+
+                    perf_stats_t stats;
+                    perf_compute_stats(samples, num_iterations, &stats);
+
+                    char grid_label[32], workgroup_label[32];
+                    snprintf(grid_label, sizeof(grid_label), "%ux%ux%u", grid[0], grid[1], grid[2]);
+                    snprintf(workgroup_label, sizeof(workgroup_label), "%ux%ux%u", workgroup[0], workgroup[1], workgroup[2]);
+                    printf("%3d %20s %16s %12.2f %12.2f %14.0f\n", dim, grid_label, workgroup_label,
+                           stats.p50, stats.min, (double) grid_items / (stats.p50 * 1e-6));
+
+                    if (0.0 == floor_us || stats.p50 < floor_us) {
+                        floor_us = stats.p50;
+                    }
+                    if (0.0 == best_us[log2_grid] || stats.p50 < best_us[log2_grid]) {
+                        best_us[log2_grid] = stats.p50;
+                    }
+                }
+            }
+
+            // The crossover is the smallest grid that takes more than twice the floor
+            uint32_t crossover = 0;
+            for (log2_grid = 0; log2_grid < 33; ++log2_grid) {
+                if (best_us[log2_grid] > 2.0 * floor_us) {
+                    crossover = 1u << log2_grid;
+                    break;
+                }
+            }
+            if (0 < crossover) {
+                printf("%dD: launch overhead floor %.2f us, kernel time dominates from %u work-items\n", dim, floor_us, crossover);
+            } else {
+                printf("%dD: launch overhead floor %.2f us, no grid reached twice the floor\n", dim, floor_us);
+            }
+        }
+
+        status = hsa_signal_destroy(signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Free the kernarg_buffer that was allocated on kernarg_region
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy queues
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Free the data buffers
+        status = hsa_memory_free(data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(samples);
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
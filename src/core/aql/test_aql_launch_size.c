@@ -85,6 +85,7 @@
 
 void launch_kernel_grid_size_workgroup_size(
         hsa_queue_t* queue,
+        signal_pool_t* pool,
         uint32_t* data,
         uint32_t data_size,
         uint32_t total_size,
@@ -95,7 +96,7 @@ void launch_kernel_grid_size_workgroup_size(
         uint64_t kernel_obj_address,
         void* kernarg_address) {
     // Launch the kernel
-    launch_kernel(queue, data, total_size, value, dim, grid_dim, workgroup_dim, kernel_obj_address, kernarg_address);
+    launch_kernel(queue, pool, data, total_size, value, dim, grid_dim, workgroup_dim, kernel_obj_address, kernarg_address);
 
     // Verify the data[0 --> data_size -1] has been updated correctly
     int ii;
@@ -126,6 +127,10 @@ int test_aql_launch_size() {
     struct agent_list_s agent_list;
     get_agent_list(&agent_list);
 
+    // Create the pool the completion signals of the dispatches are taken from
+    signal_pool_t* signal_pool = signal_pool_create(SIGNAL_POOL_CACHE_SIZE);
+    ASSERT(NULL != signal_pool);
+
     int ii;
     for (ii = 0; ii < agent_list.num_agents; ++ii) {
         // Check if the queue supports dispatch
@@ -257,6 +262,7 @@ int test_aql_launch_size() {
             while (workgroup_dim.x < workgroup_max_size) {
                 launch_kernel_grid_size_workgroup_size(
                         queue,
+                        signal_pool,
                         data,
                         data_size,
                         (int)total_size,
@@ -287,6 +293,7 @@ int test_aql_launch_size() {
                     while (workgroup_dim.y < workgroup_max_size) {
                         launch_kernel_grid_size_workgroup_size(
                             queue,
+                            signal_pool,
                             data,
                             data_size,
                             (int)total_size,
@@ -327,6 +334,7 @@ int test_aql_launch_size() {
                             while (workgroup_dim.z < workgroup_max_size) {
                                 launch_kernel_grid_size_workgroup_size(
                                     queue,
+                                    signal_pool,
                                     data,
                                     data_size,
                                     (int)total_size,
@@ -368,6 +376,9 @@ int test_aql_launch_size() {
     // Destroy the loaded module
     destroy_module(module);
 
+    // Destroy the signal pool
+    signal_pool_destroy(signal_pool);
+
     // Shutdown the runtime
     status = hsa_shut_down();
 
@@ -84,6 +84,10 @@ int test_aql_private_memory() {
     struct agent_list_s agent_list;
     get_agent_list(&agent_list);
 
+    // Create the pool the completion signals of the dispatches are taken from
+    signal_pool_t* signal_pool = signal_pool_create(SIGNAL_POOL_CACHE_SIZE);
+    ASSERT(NULL != signal_pool);
+
     // Repeat the test for each agent
     int ii;
     for (ii = 0; ii < agent_list.num_agents; ++ii) {
@@ -168,7 +172,7 @@ int test_aql_private_memory() {
         }
         int mult = 2;
 
-        launch_memory_kernel(queue, data_in, data_out, block_size,
+        launch_memory_kernel(queue, signal_pool, data_in, data_out, block_size,
                 symbol_record.private_segment_size,
                 0,
                 symbol_record.kernel_object,
@@ -206,6 +210,9 @@ int test_aql_private_memory() {
     // Destroy the loaded module
     destroy_module(module);
 
+    // Destroy the signal pool
+    signal_pool_destroy(signal_pool);
+
     // Shutdown the runtime
     status = hsa_shut_down();
     ASSERT(HSA_STATUS_SUCCESS == status);
@@ -0,0 +1,369 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: aql_segment_size_cost
+ * Scope: Performance
+ *
+ * Purpose: Measures the cost of requesting more group or private segment
+ * memory in a dispatch packet than a kernel needs, in terms of the dispatch
+ * latency and the throughput of a fixed amount of work.
+ *
+ * Test Description:
+ * 1) For each agent that supports kernel dispatch, create a queue and finalize
+ * the init_data kernel, which uses neither group nor private memory.
+ * 2) Determine the maximum group segment size from the size of the agent's
+ * group region. The private segment size is requested per work-item, so its
+ * maximum is SEGMENT_COST_MAX_PRIVATE, capped at the size of the agent's
+ * private region if it has one.
+ * 3) For the group segment and then the private segment, for a requested size
+ * of 0 and of powers of two up to the maximum, with the other segment size
+ * left at the kernel's requirement:
+ *    a) Dispatch a single workgroup SEGMENT_COST_ITERATIONS times (latency).
+ *    b) Dispatch SEGMENT_COST_GRID_SIZE work-items SEGMENT_COST_ITERATIONS
+ *    times. Since the work is fixed, the completion time is a proxy for the
+ *    occupancy the agent achieves with that segment size.
+ *    c) Verify the data has been initialized.
+ *    A dispatch the queue rejects, or that does not complete within
+ *    SEGMENT_COST_TIMEOUT_MS, fails the test.
+ * 4) Report the median latency and fixed work time of each size, and the
+ * throughput relative to the kernel's own segment size.
+ *
+ * Expected Results: All dispatches should complete and the data should be
+ * initialized correctly.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_helper_func.h"
+
+#define SEGMENT_COST_GRID_SIZE 1024*1024
+#define SEGMENT_COST_WORKGROUP_SIZE 256
+#define SEGMENT_COST_ITERATIONS 20
+#define SEGMENT_COST_MAX_PRIVATE 16*1024
+#define SEGMENT_COST_MIN_SIZE 16
+#define SEGMENT_COST_TIMEOUT_MS 10000
+
+static hsa_status_t segment_queue_status;
+
+// Record the error of a rejected dispatch, and wake up the thread waiting on its completion signal
+static void segment_queue_callback(hsa_status_t status, hsa_queue_t* queue, void* data) {
+    segment_queue_status = status;
+    hsa_signal_store_release(*(hsa_signal_t*) data, 0);
+    return;
+}
+
+// Dispatch the packet, failing if the queue rejects it or it does not complete in time
+static uint64_t launch_segment_dispatch(hsa_queue_t* queue, hsa_kernel_dispatch_packet_t* packet, uint64_t timeout_ns) {
+    uint64_t elapsed_ns = launch_timed_kernel(queue, packet, timeout_ns);
+    ASSERT_MSG(HSA_STATUS_SUCCESS == segment_queue_status, "The queue rejected the dispatch.\n");
+    ASSERT_MSG(UINT64_MAX != elapsed_ns, "The dispatch did not complete within the timeout.\n");
+    return elapsed_ns;
+}
+
+// Time num_iterations dispatches of the packet, returning the median in microseconds
+static double time_segment_dispatch(hsa_queue_t* queue, hsa_kernel_dispatch_packet_t* packet,
+                                    uint32_t num_iterations, uint64_t timeout_ns, double* samples) {
+    // Warm up, then time the dispatches
+    launch_segment_dispatch(queue, packet, timeout_ns);
+    uint32_t ii;
+    for (ii = 0; ii < num_iterations; ++ii) {
+        samples[ii] = (double) launch_segment_dispatch(queue, packet, timeout_ns) * 1e-3;
+    }
+
+    perf_stats_t stats;
+    perf_compute_stats(samples, num_iterations, &stats);
+    return stats.p50;
+}
+
+int test_aql_segment_size_cost() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("init_data.brig", &module));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t grid_size = (uint32_t) perf_get_env_uint("SEGMENT_COST_GRID_SIZE", SEGMENT_COST_GRID_SIZE);
+    uint32_t num_iterations = (uint32_t) perf_get_env_uint("SEGMENT_COST_ITERATIONS", SEGMENT_COST_ITERATIONS);
+    uint64_t max_private = perf_get_env_uint("SEGMENT_COST_MAX_PRIVATE", SEGMENT_COST_MAX_PRIVATE);
+    uint64_t timeout_ns = perf_get_env_uint("SEGMENT_COST_TIMEOUT_MS", SEGMENT_COST_TIMEOUT_MS) * 1000000;
+    ASSERT(0 < grid_size && 0 < num_iterations);
+
+    double* samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    int ii;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Find a memory region in the global segment
+        hsa_region_t global_region;
+        global_region.handle=(uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t)-1 == global_region.handle) {
+            // Skip the test if global fine grained memory isn't available
+            continue;
+        }
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // The group segment can be at most the size of the group region
+        size_t max_segment_size[2] = {0, max_private};
+        hsa_region_t group_region;
+        group_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_group_memory_region, &group_region);
+        if ((uint64_t)-1 != group_region.handle) {
+            status = hsa_region_get_info(group_region, HSA_REGION_INFO_SIZE, &max_segment_size[0]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        hsa_region_t private_region;
+        private_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_private_memory_region, &private_region);
+        if ((uint64_t)-1 != private_region.handle) {
+            // The region is shared by all of the work-items, so it only caps the per work-item size
+            size_t private_region_size;
+            status = hsa_region_get_info(private_region, HSA_REGION_INFO_SIZE, &private_region_size);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            if (private_region_size < max_segment_size[1]) {
+                max_segment_size[1] = private_region_size;
+            }
+        }
+
+        // The segment sizes in the dispatch packet are 32 bits
+        int kk;
+        for (kk = 0; kk < 2; ++kk) {
+            max_segment_size[kk] = (max_segment_size[kk] > UINT32_MAX) ? UINT32_MAX : max_segment_size[kk];
+        }
+
+        uint32_t workgroup_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_SIZE, &workgroup_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        uint32_t workgroup_size = (SEGMENT_COST_WORKGROUP_SIZE < workgroup_max_size) ? SEGMENT_COST_WORKGROUP_SIZE : workgroup_max_size;
+
+        uint32_t *data;
+        status = hsa_memory_allocate(global_region, grid_size * sizeof(uint32_t), (void**) &data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        hsa_signal_t signal;
+        status = hsa_signal_create(1, 0, NULL, &signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create the queue, its callback completes the signal of a rejected dispatch
+        segment_queue_status = HSA_STATUS_SUCCESS;
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], 1024, HSA_QUEUE_TYPE_SINGLE, segment_queue_callback, &signal, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__init_int_data_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Allocate the kernel argument buffer from the correct region
+        void* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, sizeof(kernarg_t), &kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        kernarg_t args;
+        args.data = data;
+        args.value = 1;
+        args.row_pitch = grid_size;
+        args.slice_pitch = grid_size;
+        memcpy(kernarg_buffer, &args, sizeof(args));
+
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+        dispatch_packet.setup = 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        dispatch_packet.workgroup_size_x = (uint16_t) workgroup_size;
+        dispatch_packet.workgroup_size_y = 1;
+        dispatch_packet.workgroup_size_z = 1;
+        dispatch_packet.grid_size_y = 1;
+        dispatch_packet.grid_size_z = 1;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+        dispatch_packet.kernarg_address = kernarg_buffer;
+        dispatch_packet.completion_signal = signal;
+
+        printf("\nAgent %d: max group segment %lu bytes, max private segment %lu bytes, %u work-items, %u iterations\n",
+               ii, (unsigned long) max_segment_size[0], (unsigned long) max_segment_size[1], grid_size, num_iterations);
+
+        // Segment 0 is the group segment, segment 1 is the private segment
+        int segment;
+        for (segment = 0; segment < 2; ++segment) {
+            const char* segment_name = (0 == segment) ? "group" : "private";
+            uint32_t required_size = (0 == segment) ? symbol_record.group_segment_size : symbol_record.private_segment_size;
+            if (max_segment_size[segment] < required_size) {
+                continue;
+            }
+
+            printf("%-8s %12s %14s %14s %12s\n", "segment", "bytes", "latency us", "fixed work us", "throughput");
+
+            double baseline_us = 0.0;
+            uint64_t size = 0;
+            while (size <= max_segment_size[segment]) {
+                // Never request less than the kernel needs
+                uint32_t segment_size = (size < required_size) ? required_size : (uint32_t) size;
+                dispatch_packet.group_segment_size = (0 == segment) ? segment_size : symbol_record.group_segment_size;
+                dispatch_packet.private_segment_size = (1 == segment) ? segment_size : symbol_record.private_segment_size;
+
+                // A single workgroup measures the dispatch latency
+                dispatch_packet.grid_size_x = workgroup_size;
+                double latency_us = time_segment_dispatch(queue, &dispatch_packet, num_iterations, timeout_ns, samples);
+
+                // The full grid measures the throughput of a fixed amount of work
+                memset(data, 0, grid_size * sizeof(uint32_t));
+                dispatch_packet.grid_size_x = grid_size;
+                double work_us = time_segment_dispatch(queue, &dispatch_packet, num_iterations, timeout_ns, samples);
+
+                uint32_t jj;
+                for (jj = 0; jj < grid_size; ++jj) {
+                    ASSERT(1 == data[jj]);
+                }
+
+                if (0.0 == baseline_us) {
+                    baseline_us = work_us;
+                }
+                printf("%-8s %12u %14.2f %14.2f %11.1f%%\n", segment_name, segment_size, latency_us, work_us,
+                       100.0 * baseline_us / work_us);
+
+                // Step through 0, the minimum size and powers of two, finishing at the maximum
+                if (size == max_segment_size[segment]) {
+                    break;
+                }
+                size = (0 == size) ? SEGMENT_COST_MIN_SIZE : size * 2;
+                if (size > max_segment_size[segment]) {
+                    size = max_segment_size[segment];
+                }
+            }
+        }
+
+        // Free the kernarg_buffer that was allocated on kernarg_region
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy queues
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        status = hsa_signal_destroy(signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Free the data buffers
+        status = hsa_memory_free(data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(samples);
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
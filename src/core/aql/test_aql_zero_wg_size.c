@@ -94,6 +94,10 @@ int test_aql_zero_wg_size() {
     struct agent_list_s agent_list;
     get_agent_list(&agent_list);
 
+    // Create the pool the completion signals of the dispatches are taken from
+    signal_pool_t* signal_pool = signal_pool_create(SIGNAL_POOL_CACHE_SIZE);
+    ASSERT(NULL != signal_pool);
+
     int ii;
     for (ii = 0; ii < agent_list.num_agents; ++ii) {
         // Check if the queue supports dispatch
@@ -182,7 +186,7 @@ int test_aql_zero_wg_size() {
             grid_dim.y = (dim == 2) ? 0: MIN_GRID_SIZE;
             grid_dim.z = (dim == 3) ? 0: MIN_GRID_SIZE;
 
-            launch_kernel(queue, data, MIN_GRID_SIZE, 1, dim, grid_dim, workgroup_dim, symbol_record.kernel_object, kernarg_buffer);
+            launch_kernel(queue, signal_pool, data, MIN_GRID_SIZE, 1, dim, grid_dim, workgroup_dim, symbol_record.kernel_object, kernarg_buffer);
 
             // Verify that no data was modified
             int jj;
@@ -215,6 +219,9 @@ int test_aql_zero_wg_size() {
     // Destroy the loaded module
     destroy_module(module);
 
+    // Destroy the signal pool
+    signal_pool_destroy(signal_pool);
+
     // Shutdown the runtime
     status = hsa_shut_down();
 
@@ -45,6 +45,8 @@
 
 #include <hsa.h>
 #include <framework.h>
+#include <perf_utils.h>
+#include <signal_pool_utils.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include "test_helper_func.h"
@@ -52,6 +54,7 @@
 // Clear the data, launch the kernel, and wait for the execution to complete
 void launch_kernel(
         hsa_queue_t* queue,
+        signal_pool_t* pool,
         uint32_t* data,
         uint32_t total_size,
         uint32_t value,
@@ -73,9 +76,13 @@ void launch_kernel(
     args.slice_pitch = grid_dim.x * grid_dim.y;
     memcpy((void*)kernarg_address, &args, sizeof(args));
 
-    // Create a signal with initial value of 1
+    // Get a signal with initial value of 1
     hsa_signal_t signal;
-    status = hsa_signal_create(1, 0, NULL, &signal);
+    if (NULL != pool) {
+        status = signal_pool_acquire(pool, 1, &signal);
+    } else {
+        status = hsa_signal_create(1, 0, NULL, &signal);
+    }
     ASSERT(HSA_STATUS_SUCCESS == status);
 
     // Request a new packet ID
@@ -111,8 +118,12 @@ void launch_kernel(
     // Wait until the kernel completes
     while (0 != hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED)) {}
 
-    // Destroy the signal
-    hsa_signal_destroy(signal);
+    // Return the signal
+    if (NULL != pool) {
+        signal_pool_release(pool, signal);
+    } else {
+        hsa_signal_destroy(signal);
+    }
 
     return;
 }
@@ -120,6 +131,7 @@ void launch_kernel(
 
 void launch_memory_kernel(
         hsa_queue_t* queue,
+        signal_pool_t* pool,
         void* in,
         void* out,
         uint32_t data_size,
@@ -139,9 +151,13 @@ void launch_memory_kernel(
     args.count = data_size;
     memcpy((void*)kernarg_address, &args, sizeof(args));
 
-    // Create a signal with initial value of 1
+    // Get a signal with initial value of 1
     hsa_signal_t signal;
-    status = hsa_signal_create(1, 0, NULL, &signal);
+    if (NULL != pool) {
+        status = signal_pool_acquire(pool, 1, &signal);
+    } else {
+        status = hsa_signal_create(1, 0, NULL, &signal);
+    }
     ASSERT(HSA_STATUS_SUCCESS == status);
 
     // Request a new packet ID
@@ -182,7 +198,46 @@ void launch_memory_kernel(
     // Wait until the kernel complete
     while (0 != hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED)) {}
 
-    hsa_signal_destroy(signal);
+    if (NULL != pool) {
+        signal_pool_release(pool, signal);
+    } else {
+        hsa_signal_destroy(signal);
+    }
 
     return;
 }
+
+uint64_t launch_timed_kernel(
+        hsa_queue_t* queue,
+        hsa_kernel_dispatch_packet_t* packet,
+        uint64_t timeout_ns) {
+    hsa_signal_store_relaxed(packet->completion_signal, 1);
+
+    // Request a new packet ID
+    uint64_t packet_id = hsa_queue_add_write_index_acquire(queue, 1);
+
+    while (packet_id - hsa_queue_load_read_index_relaxed(queue) >= queue->size) {}
+
+    hsa_kernel_dispatch_packet_t* dispatch_packet = (hsa_kernel_dispatch_packet_t*)queue->base_address
+            + packet_id % queue->size;
+
+    // Copy everything but the header, which publishes the packet
+    memcpy((uint8_t*)dispatch_packet + sizeof(packet->header), (uint8_t*)packet + sizeof(packet->header),
+           sizeof(hsa_kernel_dispatch_packet_t) - sizeof(packet->header));
+
+    uint64_t start_ns = perf_get_time_ns();
+    __atomic_store_n((uint16_t*)(&dispatch_packet->header), packet->header, __ATOMIC_RELEASE);
+
+    // Signal the door bell to launch the packet
+    hsa_signal_store_release(queue->doorbell_signal, packet_id);
+
+    // Wait until the kernel completes, or the timeout elapses
+    uint64_t timeout_hint = (UINT64_MAX == timeout_ns) ? UINT64_MAX : 0;
+    while (0 != hsa_signal_wait_acquire(packet->completion_signal, HSA_SIGNAL_CONDITION_EQ, 0, timeout_hint, HSA_WAIT_STATE_ACTIVE)) {
+        if (perf_get_time_ns() - start_ns >= timeout_ns) {
+            return UINT64_MAX;
+        }
+    }
+
+    return perf_get_time_ns() - start_ns;
+}
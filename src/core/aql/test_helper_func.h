@@ -47,6 +47,7 @@
 #define _TEST_HELPER_FUNC_H_
 
 #include <hsa.h>
+#include <signal_pool_utils.h>
 
 // Structure alignment macro
 #ifndef __ALIGNED__
@@ -80,9 +81,12 @@ typedef struct __attribute__ ((aligned(HSA_ARGUMENT_ALIGN_BYTES))) kernarg_s {
 
 // void callback_queue_error(hsa_status_t status, hsa_queue_t* queue, void* data);
 
-// Clear the data, launch the kernel, and wait for the execution to complete
+// Clear the data, launch the kernel, and wait for the execution to complete.
+// The completion signal is taken from the pool, a NULL pool falls back to
+// creating a signal.
 void launch_kernel(
         hsa_queue_t* queue,
+        signal_pool_t* pool,
         uint32_t* data,
         uint32_t total_size,
         uint32_t value,
@@ -98,9 +102,12 @@ typedef struct __attribute__ ((aligned(16))) kernarg_memory_s {
     int count;
 } kernarg_memory_t;
 
-// Launch a memory kernel (private or group), and wait for the execute to complete
+// Launch a memory kernel (private or group), and wait for the execute to complete.
+// The completion signal is taken from the pool, a NULL pool falls back to
+// creating a signal.
 void launch_memory_kernel(
         hsa_queue_t* queue,
+        signal_pool_t* pool,
         void* in,
         void* out,
         uint32_t data_size,
@@ -109,4 +116,14 @@ void launch_memory_kernel(
         uint64_t kernel_obj_address,
         void* kernarg_address);
 
+// Publish a prepared dispatch packet, and wait for the execution to complete.
+// The completion signal of the packet is reset to 1 before the packet is
+// published. Returns the time in nanoseconds from publishing the packet to
+// observing its completion, or UINT64_MAX if it has not completed within
+// timeout_ns. A timeout_ns of UINT64_MAX waits forever.
+uint64_t launch_timed_kernel(
+        hsa_queue_t* queue,
+        hsa_kernel_dispatch_packet_t* packet,
+        uint64_t timeout_ns);
+
 #endif  // _TEST_HELPER_FUNC_H_
@@ -51,6 +51,7 @@ DEFINE_TEST(async_invalid_group_memory);
 DEFINE_TEST(async_invalid_dimensions);
 DEFINE_TEST(async_invalid_workgroup_size);
 DEFINE_TEST(async_invalid_packet);
+DEFINE_TEST(async_error_latency);
 
 int main(int argc, char* argv[]) {
     INITIALIZE_TESTSUITE();
@@ -59,6 +60,7 @@ int main(int argc, char* argv[]) {
     ADD_TEST(async_invalid_dimensions);
     ADD_TEST(async_invalid_workgroup_size);
     ADD_TEST(async_invalid_packet);
+    ADD_TEST(async_error_latency);
     RUN_TESTS();
     return 0;
 }
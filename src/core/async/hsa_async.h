@@ -50,4 +50,5 @@ extern int test_async_invalid_group_memory();
 extern int test_async_invalid_dimensions();
 extern int test_async_invalid_workgroup_size();
 extern int test_async_invalid_packet();
+extern int test_async_error_latency();
 #endif  // _HSA_ASYNC_H_
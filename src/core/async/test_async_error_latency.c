@@ -0,0 +1,298 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: async_error_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures how long it takes for a malformed packet to be reported
+ * through the queue's error callback, for each of the asynchronous error
+ * classes covered by the async_invalid_* tests.
+ *
+ * Test Description:
+ * 1) For each agent on the platform that supports kernel dispatch, finalize
+ *    the no_op and group_memory kernels.
+ * 2) For each error class, build the same invalid packet as the matching
+ *    conformance test:
+ *    a) invalid_packet: an invalid packet type.
+ *    b) invalid_kernel_object: a null kernel object.
+ *    c) invalid_dimensions: a dimension count greater than 3.
+ *    d) invalid_workgroup_size: a workgroup size larger than the maximum.
+ *    e) invalid_group_memory: a group segment size larger than the maximum.
+ * 3) Dispatch the packet ASYNC_LATENCY_ITERATIONS times, each time to a
+ *    newly created queue with a valid callback, and wait up to
+ *    ASYNC_LATENCY_TIMEOUT_MS for the callback.
+ * 4) Report the time from the dispatch to the callback being invoked, and
+ *    from the callback to the waiting thread observing it. Error classes
+ *    the runtime does not report within the timeout are listed as not
+ *    reported.
+ *
+ * Expected Results: The queues callback should trigger with the expected
+ * status, and the queue id should be correctly passed to the callback.
+ *
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_async_utils.h"
+
+#define ASYNC_LATENCY_ITERATIONS 100
+#define ASYNC_LATENCY_TIMEOUT_MS 1000
+
+typedef enum async_error_class_e {
+    ASYNC_ERROR_INVALID_PACKET,
+    ASYNC_ERROR_INVALID_KERNEL_OBJECT,
+    ASYNC_ERROR_INVALID_DIMENSIONS,
+    ASYNC_ERROR_INVALID_WORKGROUP_SIZE,
+    ASYNC_ERROR_INVALID_GROUP_MEMORY,
+    ASYNC_ERROR_NUM_CLASSES
+} async_error_class_t;
+
+static const char* async_error_names[ASYNC_ERROR_NUM_CLASSES] = {
+    "invalid_packet",
+    "invalid_kernel_object",
+    "invalid_dimensions",
+    "invalid_workgroup_size",
+    "invalid_group_memory"
+};
+
+static const hsa_status_t async_error_status[ASYNC_ERROR_NUM_CLASSES] = {
+    HSA_STATUS_ERROR_INVALID_PACKET_FORMAT,
+    HSA_STATUS_ERROR_INVALID_CODE_OBJECT,
+    HSA_STATUS_ERROR_INCOMPATIBLE_ARGUMENTS,
+    HSA_STATUS_ERROR_INCOMPATIBLE_ARGUMENTS,
+    HSA_STATUS_ERROR_INVALID_ALLOCATION
+};
+
+// Build the packet used by the async_invalid_* test of the error class
+static void build_error_packet(async_error_class_t error_class, symbol_record_t* no_op_record,
+                               symbol_record_t* group_memory_record, void* kernarg_buffer,
+                               hsa_kernel_dispatch_packet_t* dispatch_packet) {
+    memset(dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+    if (ASYNC_ERROR_INVALID_PACKET == error_class) {
+        // Set every bit of the packet type to get an invalid type
+        uint16_t packet_type_bits_mask = (1 << HSA_PACKET_HEADER_WIDTH_TYPE) - 1;
+        dispatch_packet->header |= (uint16_t) (packet_type_bits_mask << HSA_PACKET_HEADER_TYPE);
+        return;
+    }
+
+    dispatch_packet->header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+    dispatch_packet->header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+    dispatch_packet->header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+    dispatch_packet->header |= 1 << HSA_PACKET_HEADER_BARRIER;
+    dispatch_packet->setup |= 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+    dispatch_packet->workgroup_size_x = 1;
+    dispatch_packet->workgroup_size_y = 1;
+    dispatch_packet->workgroup_size_z = 1;
+    dispatch_packet->grid_size_x = 1;
+    dispatch_packet->grid_size_y = 1;
+    dispatch_packet->grid_size_z = 1;
+    dispatch_packet->completion_signal.handle = 0;
+    dispatch_packet->kernel_object = no_op_record->kernel_object;
+    dispatch_packet->private_segment_size = no_op_record->private_segment_size;
+    dispatch_packet->group_segment_size = no_op_record->group_segment_size;
+    dispatch_packet->kernarg_address = NULL;
+
+    switch (error_class) {
+    case ASYNC_ERROR_INVALID_KERNEL_OBJECT:
+        dispatch_packet->kernel_object = 0;
+        dispatch_packet->private_segment_size = 0;
+        dispatch_packet->group_segment_size = 0;
+        break;
+    case ASYNC_ERROR_INVALID_DIMENSIONS:
+        dispatch_packet->setup = 4 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        break;
+    case ASYNC_ERROR_INVALID_WORKGROUP_SIZE:
+        dispatch_packet->workgroup_size_x = (uint16_t)-1;
+        break;
+    case ASYNC_ERROR_INVALID_GROUP_MEMORY:
+        dispatch_packet->kernel_object = group_memory_record->kernel_object;
+        dispatch_packet->private_segment_size = group_memory_record->private_segment_size;
+        dispatch_packet->kernarg_address = kernarg_buffer;
+        dispatch_packet->group_segment_size = (uint32_t)-1;
+        break;
+    default:
+        break;
+    }
+
+    return;
+}
+
+int test_async_error_latency() {
+    hsa_status_t status;
+
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG modules
+    const char* module_files[2] = {"no_op.brig", "group_memory.brig"};
+    char* kernel_names[2] = {"&__no_op_kernel", "&__group_memory_static_kernel"};
+    hsa_ext_module_t modules[2];
+    ASSERT(0 == load_module_from_file(module_files[0], &modules[0]));
+    ASSERT(0 == load_module_from_file(module_files[1], &modules[1]));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t num_iterations = (uint32_t) perf_get_env_uint("ASYNC_LATENCY_ITERATIONS", ASYNC_LATENCY_ITERATIONS);
+    ASSERT(0 < num_iterations);
+    uint64_t timeout_ms = perf_get_env_uint("ASYNC_LATENCY_TIMEOUT_MS", ASYNC_LATENCY_TIMEOUT_MS);
+
+    double* callback_samples = (double*) malloc(num_iterations * sizeof(double));
+    double* wake_samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != callback_samples && NULL != wake_samples);
+
+    int ii, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Make sure the agent supports kernel dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // Finalize an executable for each kernel
+        hsa_code_object_t code_objects[2];
+        hsa_executable_t executables[2];
+        symbol_record_t symbol_records[2];
+        for (kk = 0; kk < 2; ++kk) {
+            hsa_ext_control_directives_t control_directives;
+            memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+            status = finalize_executable(agent_list.agents[ii],
+                                         1,
+                                         &modules[kk],
+                                         HSA_MACHINE_MODEL_LARGE,
+                                         HSA_PROFILE_FULL,
+                                         HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                         HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                         0,
+                                         control_directives,
+                                         &code_objects[kk],
+                                         &executables[kk]);
+
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            memset(&symbol_records[kk], 0, sizeof(symbol_record_t));
+            status = get_executable_symbols(executables[kk], agent_list.agents[ii], 0, 1, &kernel_names[kk], &symbol_records[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        // Allocate the kernel argument buffer of the group_memory kernel
+        size_t kernarg_size = (0 < symbol_records[1].kernarg_segment_size) ? symbol_records[1].kernarg_segment_size : sizeof(uint64_t);
+        void* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, kernarg_size, &kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        memset(kernarg_buffer, 0, kernarg_size);
+
+        printf("\nAgent %d: %u iterations per error class\n", ii, num_iterations);
+
+        for (kk = 0; kk < ASYNC_ERROR_NUM_CLASSES; ++kk) {
+            hsa_kernel_dispatch_packet_t dispatch_packet;
+            build_error_packet((async_error_class_t) kk, &symbol_records[0], &symbol_records[1], kernarg_buffer, &dispatch_packet);
+
+            uint32_t num_samples = async_test_latency(agent_list.agents[ii], &dispatch_packet, async_error_status[kk],
+                                                      num_iterations, timeout_ms, callback_samples, wake_samples);
+            if (num_samples < num_iterations) {
+                printf("%s: not reported within %llu ms\n", async_error_names[kk], (unsigned long long) timeout_ms);
+                continue;
+            }
+
+            char label[64];
+            perf_stats_t stats;
+            perf_compute_stats(callback_samples, num_samples, &stats);
+            snprintf(label, sizeof(label), "%s dispatch to callback", async_error_names[kk]);
+            perf_print_stats(label, "us", &stats);
+
+            perf_compute_stats(wake_samples, num_samples, &stats);
+            snprintf(label, sizeof(label), "%s callback to waiter", async_error_names[kk]);
+            perf_print_stats(label, "us", &stats);
+        }
+
+        // Free the kernarg
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        for (kk = 0; kk < 2; ++kk) {
+            // Destroy the executable
+            status = hsa_executable_destroy(executables[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            // Destroy the code object
+            status = hsa_code_object_destroy(code_objects[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+    }
+
+    free(wake_samples);
+    free(callback_samples);
+
+    // Destroy the loaded modules
+    destroy_module(modules[0]);
+    destroy_module(modules[1]);
+
+    // Shutdown the runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -45,12 +45,14 @@
 
 #include <hsa.h>
 #include <framework.h>
+#include <perf_utils.h>
 #include <queue_utils.h>
 #include "test_async_utils.h"
 
 hsa_status_t global_status;
 hsa_queue_t* global_queue_handle;
 hsa_signal_t global_signal;
+uint64_t global_callback_ns;
 
 void async_callback(hsa_status_t status, hsa_queue_t* queue_handle, void* data) {
     global_status = status;
@@ -59,6 +61,14 @@ void async_callback(hsa_status_t status, hsa_queue_t* queue_handle, void* data)
     return;
 }
 
+void async_latency_callback(hsa_status_t status, hsa_queue_t* queue_handle, void* data) {
+    global_callback_ns = perf_get_time_ns();
+    global_status = status;
+    global_queue_handle = queue_handle;
+    hsa_signal_store_release(global_signal, 1);
+    return;
+}
+
 void async_test(hsa_agent_t agent, hsa_kernel_dispatch_packet_t* dispatch_packet, hsa_status_t expected_status) {
     // Initialize the global signal
     hsa_status_t status = hsa_signal_create(0, 0, NULL, &global_signal);
@@ -108,3 +118,68 @@ void async_test(hsa_agent_t agent, hsa_kernel_dispatch_packet_t* dispatch_packet
 
     return;
 }
+
+uint32_t async_test_latency(hsa_agent_t agent, hsa_kernel_dispatch_packet_t* dispatch_packet, hsa_status_t expected_status,
+                            uint32_t num_iterations, uint64_t timeout_ms, double* callback_samples, double* wake_samples) {
+    // Initialize the global signal
+    hsa_status_t status = hsa_signal_create(0, 0, NULL, &global_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Convert the timeout into a wait hint in timestamp ticks
+    uint64_t timestamp_frequency = 0;
+    status = hsa_system_get_info(HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY, &timestamp_frequency);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    uint64_t timeout_hint = timestamp_frequency * timeout_ms / 1000;
+    uint64_t timeout_ns = timeout_ms * 1000000;
+
+    uint32_t ii;
+    for (ii = 0; ii < num_iterations; ++ii) {
+        // A queue is unusable once its callback has reported an error, so
+        // every sample needs a fresh queue.
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent, 1024, HSA_QUEUE_TYPE_SINGLE, async_latency_callback, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Initialize the global variables
+        global_status = HSA_STATUS_SUCCESS;
+        global_queue_handle = 0;
+        global_callback_ns = 0;
+        hsa_signal_store_relaxed(global_signal, 0);
+
+        // Dispatch the packet.
+        uint64_t start_ns = perf_get_time_ns();
+        enqueue_dispatch_packet(queue, dispatch_packet);
+
+        // Wait on the global signal value to change to 1, giving up once the
+        // timeout has elapsed as runtimes are not required to report every
+        // error class
+        int reported = 0;
+        uint64_t wake_ns;
+        do {
+            reported = (1 == hsa_signal_wait_acquire(global_signal, HSA_SIGNAL_CONDITION_EQ, 1, timeout_hint, HSA_WAIT_STATE_ACTIVE));
+            wake_ns = perf_get_time_ns();
+        } while (!reported && wake_ns - start_ns < timeout_ns);
+
+        if (!reported) {
+            status = hsa_queue_destroy(queue);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            break;
+        }
+
+        // Verify the global_status and global_queue_handle values were set correctly
+        ASSERT(global_queue_handle == queue);
+        ASSERT(expected_status == global_status);
+
+        callback_samples[ii] = (double) (global_callback_ns - start_ns) * 1e-3;
+        wake_samples[ii] = (double) (wake_ns - global_callback_ns) * 1e-3;
+
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Destroy the global signal
+    status = hsa_signal_destroy(global_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return ii;
+}
@@ -50,4 +50,13 @@ void async_callback(hsa_status_t status, hsa_queue_t* queue_handle, void* data);
 
 void async_test(hsa_agent_t agent, hsa_kernel_dispatch_packet_t* dispatch_packet, hsa_status_t expected_status);
 
+void async_latency_callback(hsa_status_t status, hsa_queue_t* queue_handle, void* data);
+
+// Dispatch the invalid packet to num_iterations fresh queues, recording the time in
+// microseconds from the dispatch to the error callback, and from the callback to the
+// waiting thread observing it. Stops at the first dispatch whose callback has not
+// been invoked within timeout_ms, and returns the number of samples recorded.
+uint32_t async_test_latency(hsa_agent_t agent, hsa_kernel_dispatch_packet_t* dispatch_packet, hsa_status_t expected_status,
+                            uint32_t num_iterations, uint64_t timeout_ms, double* callback_samples, double* wake_samples);
+
 #endif  // _TEST_ASYNC_UTILS_H_
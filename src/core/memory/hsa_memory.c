@@ -73,6 +73,9 @@ DEFINE_TEST(memory_basic_allocate_free);
 DEFINE_TEST(memory_basic_register_deregister);
 DEFINE_TEST(memory_coherence_after_register);
 DEFINE_TEST(memory_copy_system_and_global);
+DEFINE_TEST(memory_kernarg_arena);
+DEFINE_TEST(memory_allocate_throughput);
+DEFINE_TEST(memory_allocator_soak);
 
 int main(int argc, char* argv[]) {
     INITIALIZE_TESTSUITE();
@@ -103,6 +106,9 @@ int main(int argc, char* argv[]) {
     ADD_TEST(memory_basic_register_deregister);
     ADD_TEST(memory_coherence_after_register);
     ADD_TEST(memory_copy_system_and_global);
+    ADD_TEST(memory_kernarg_arena);
+    ADD_TEST(memory_allocate_throughput);
+    ADD_TEST(memory_allocator_soak);
     RUN_TESTS();
     return 0;
 }
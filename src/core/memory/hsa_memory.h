@@ -73,5 +73,8 @@ extern int test_memory_basic_allocate_free();
 extern int test_memory_basic_register_deregister();
 extern int test_memory_coherence_after_register();
 extern int test_memory_copy_system_and_global();
+extern int test_memory_kernarg_arena();
+extern int test_memory_allocate_throughput();
+extern int test_memory_allocator_soak();
 
 #endif  // _HSA_MEMORY_H_
@@ -0,0 +1,307 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: memory_allocate_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the latency and throughput of hsa_memory_allocate and
+ * hsa_memory_free for every region that supports allocation, across
+ * allocation sizes and thread counts, and finds the sizes where the runtime
+ * switches to a slower allocation path.
+ *
+ * Test Description:
+ * 1) For each agent, iterate over the regions of get_region_list that allow
+ * allocation, and query the allocation granule and maximum size.
+ * 2) For each size from the granule to the maximum size of the region,
+ * multiplying by MEMORY_ALLOC_SIZE_STEP and capped at MEMORY_ALLOC_MAX_BYTES,
+ * and for 1, 2, 4, ... up to MEMORY_ALLOC_MAX_THREADS threads:
+ *    a) Each thread allocates and frees a buffer of the size, timing each
+ *    call separately. The number of iterations is MEMORY_ALLOC_ITERATIONS,
+ *    reduced for the large sizes so that each thread allocates at most
+ *    MEMORY_ALLOC_BYTES bytes.
+ *    b) The page faults and system CPU time of the process are sampled
+ *    around the run.
+ * 3) Report the median and 99th percentile latency of the allocations and
+ * frees, the allocate/free pairs per second, and the page faults and system
+ * time per pair, which show the calls that enter the kernel. A size is
+ * flagged as a slow path when the median single thread allocation latency
+ * is more than MEMORY_ALLOC_CLIFF times that of the previous size.
+ *
+ * Expected Results: Allocations up to the maximum size should succeed, and
+ * the allocation latency should not depend on the size.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MEMORY_ALLOC_MAX_THREADS 16
+#define MEMORY_ALLOC_ITERATIONS 1000
+#define MEMORY_ALLOC_MIN_ITERATIONS 16
+#define MEMORY_ALLOC_BYTES (1024 * 1024 * 1024)
+#define MEMORY_ALLOC_MAX_BYTES (256 * 1024 * 1024)
+#define MEMORY_ALLOC_SIZE_STEP 4
+#define MEMORY_ALLOC_CLIFF 4
+
+// Maximum number of size classes of a region
+#define MEMORY_ALLOC_MAX_SIZES 64
+
+typedef struct memory_allocate_thread_s {
+    hsa_region_t region;
+    size_t size;
+    uint64_t num_iterations;
+    double* allocate_samples;
+    double* free_samples;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint64_t failures;
+} memory_allocate_thread_t;
+
+// Work function for the allocating threads
+void thread_proc_memory_allocate(void* data) {
+    memory_allocate_thread_t* thread = (memory_allocate_thread_t*) data;
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint64_t ii;
+    for (ii = 0; ii < thread->num_iterations; ++ii) {
+        void* buffer = NULL;
+        uint64_t start = perf_get_time_ns();
+        hsa_status_t status = hsa_memory_allocate(thread->region, thread->size, &buffer);
+        uint64_t end = perf_get_time_ns();
+        thread->allocate_samples[ii] = (double) (end - start);
+        if (HSA_STATUS_SUCCESS != status) {
+            ++thread->failures;
+            thread->free_samples[ii] = 0.0;
+            continue;
+        }
+
+        start = perf_get_time_ns();
+        hsa_memory_free(buffer);
+        thread->free_samples[ii] = (double) (perf_get_time_ns() - start);
+    }
+
+    thread->end_ns = perf_get_time_ns();
+
+    return;
+}
+
+int test_memory_allocate_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus < 1) {
+        num_cpus = 1;
+    }
+
+    uint32_t max_threads = (uint32_t) perf_get_env_uint("MEMORY_ALLOC_MAX_THREADS",
+            (num_cpus < MEMORY_ALLOC_MAX_THREADS) ? (uint64_t) num_cpus : MEMORY_ALLOC_MAX_THREADS);
+    uint64_t max_iterations = perf_get_env_uint("MEMORY_ALLOC_ITERATIONS", MEMORY_ALLOC_ITERATIONS);
+    uint64_t bytes_per_thread = perf_get_env_uint("MEMORY_ALLOC_BYTES", MEMORY_ALLOC_BYTES);
+    uint64_t max_bytes = perf_get_env_uint("MEMORY_ALLOC_MAX_BYTES", MEMORY_ALLOC_MAX_BYTES);
+    uint64_t size_step = perf_get_env_uint("MEMORY_ALLOC_SIZE_STEP", MEMORY_ALLOC_SIZE_STEP);
+    uint64_t cliff = perf_get_env_uint("MEMORY_ALLOC_CLIFF", MEMORY_ALLOC_CLIFF);
+    ASSERT(0 < max_threads && 0 < max_iterations && 1 < size_step);
+
+    memory_allocate_thread_t* threads = (memory_allocate_thread_t*) malloc(max_threads * sizeof(memory_allocate_thread_t));
+    double* allocate_samples = (double*) malloc(max_threads * max_iterations * sizeof(double));
+    double* free_samples = (double*) malloc(max_threads * max_iterations * sizeof(double));
+    ASSERT(NULL != threads && NULL != allocate_samples && NULL != free_samples);
+
+    int ii, jj, kk, mm;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        struct region_list_s region_list;
+        get_region_list(agent_list.agents[ii], &region_list);
+
+        for (jj = 0; jj < region_list.num_regions; ++jj) {
+            hsa_region_t region = region_list.regions[jj];
+            bool allowed;
+            status = hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_ALLOWED, &allowed);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            if (!allowed) {
+                continue;
+            }
+
+            hsa_region_segment_t segment;
+            status = hsa_region_get_info(region, HSA_REGION_INFO_SEGMENT, &segment);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            uint32_t flags = 0;
+            if (HSA_REGION_SEGMENT_GLOBAL == segment) {
+                status = hsa_region_get_info(region, HSA_REGION_INFO_GLOBAL_FLAGS, &flags);
+                ASSERT(HSA_STATUS_SUCCESS == status);
+            }
+            size_t granule, alloc_max_size;
+            status = hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_GRANULE, &granule);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            status = hsa_region_get_info(region, HSA_REGION_INFO_ALLOC_MAX_SIZE, &alloc_max_size);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            if (0 == granule || 0 == alloc_max_size) {
+                continue;
+            }
+
+            // The sizes from the granule to the capped maximum size
+            size_t sizes[MEMORY_ALLOC_MAX_SIZES];
+            int num_sizes = 0;
+            size_t largest = (alloc_max_size < max_bytes) ? alloc_max_size : (size_t) max_bytes;
+            size_t size = (granule < largest) ? granule : largest;
+            while (num_sizes < MEMORY_ALLOC_MAX_SIZES) {
+                sizes[num_sizes++] = size;
+                if (size >= largest) {
+                    break;
+                }
+                size = (size <= largest / size_step) ? size * size_step : largest;
+            }
+
+            printf("\nAgent %d, region %d (segment %d%s%s%s): granule %zu bytes, maximum size %zu bytes\n",
+                   ii, jj, (int) segment,
+                   (flags & HSA_REGION_GLOBAL_FLAG_KERNARG) ? ", kernarg" : "",
+                   (flags & HSA_REGION_GLOBAL_FLAG_FINE_GRAINED) ? ", fine grained" : "",
+                   (flags & HSA_REGION_GLOBAL_FLAG_COARSE_GRAINED) ? ", coarse grained" : "",
+                   granule, alloc_max_size);
+            printf("%14s %8s %14s %14s %14s %14s %14s %10s %12s %10s\n", "bytes", "threads",
+                   "alloc p50 ns", "alloc p99 ns", "free p50 ns", "free p99 ns",
+                   "pairs/s", "failures", "faults/pair", "sys ns/pair");
+
+            double previous_p50 = 0.0;
+            for (kk = 0; kk < num_sizes; ++kk) {
+                uint64_t num_iterations = bytes_per_thread / sizes[kk];
+                num_iterations = (num_iterations < MEMORY_ALLOC_MIN_ITERATIONS) ? MEMORY_ALLOC_MIN_ITERATIONS : num_iterations;
+                num_iterations = (num_iterations > max_iterations) ? max_iterations : num_iterations;
+
+                uint32_t num_threads = 1;
+                while (num_threads <= max_threads) {
+                    perf_process_usage_t usage_start, usage_end;
+                    perf_get_process_usage(&usage_start);
+
+                    struct test_group* tg_alloc = test_group_create(num_threads);
+                    for (mm = 0; mm < num_threads; ++mm) {
+                        memory_allocate_thread_t* thread = &threads[mm];
+                        memset(thread, 0, sizeof(memory_allocate_thread_t));
+                        thread->region = region;
+                        thread->size = sizes[kk];
+                        thread->num_iterations = num_iterations;
+                        thread->allocate_samples = &allocate_samples[mm * num_iterations];
+                        thread->free_samples = &free_samples[mm * num_iterations];
+                        test_group_add(tg_alloc, &thread_proc_memory_allocate, thread, 1);
+                    }
+                    test_group_thread_create(tg_alloc);
+                    for (mm = 0; mm < num_threads; ++mm) {
+                        test_group_thread_affinity(tg_alloc, mm, mm % num_cpus);
+                    }
+                    test_group_start(tg_alloc);
+                    test_group_wait(tg_alloc);
+                    test_group_exit(tg_alloc);
+                    test_group_destroy(tg_alloc);
+
+                    perf_get_process_usage(&usage_end);
+
+                    uint64_t first_start = UINT64_MAX, last_end = 0;
+                    uint64_t failures = 0;
+                    for (mm = 0; mm < num_threads; ++mm) {
+                        first_start = (threads[mm].start_ns < first_start) ? threads[mm].start_ns : first_start;
+                        last_end = (threads[mm].end_ns > last_end) ? threads[mm].end_ns : last_end;
+                        failures += threads[mm].failures;
+                    }
+
+                    uint64_t num_pairs = num_threads * num_iterations;
+                    perf_stats_t allocate_stats, free_stats;
+                    perf_compute_stats(allocate_samples, num_pairs, &allocate_stats);
+                    perf_compute_stats(free_samples, num_pairs, &free_stats);
+                    double faults = (double) (usage_end.minor_faults - usage_start.minor_faults +
+                                              usage_end.major_faults - usage_start.major_faults);
+                    double system_ns = (double) (usage_end.system_time_ns - usage_start.system_time_ns);
+
+                    printf("%14zu %8u %14.0f %14.0f %14.0f %14.0f %14.0f %10lu %12.2f %10.0f\n",
+                           sizes[kk], num_threads, allocate_stats.p50, allocate_stats.p99,
+                           free_stats.p50, free_stats.p99,
+                           (double) num_pairs / ((double) (last_end - first_start) * 1e-9),
+                           (unsigned long) failures, faults / (double) num_pairs, system_ns / (double) num_pairs);
+
+                    // Compare the single thread latency to the previous size
+                    if (1 == num_threads) {
+                        if (0 < kk && 0.0 < previous_p50 && allocate_stats.p50 > (double) cliff * previous_p50) {
+                            printf("%14s slow path: median allocation latency x%.1f from %zu to %zu bytes\n", "",
+                                   allocate_stats.p50 / previous_p50, sizes[kk - 1], sizes[kk]);
+                        }
+                        previous_p50 = allocate_stats.p50;
+                    }
+
+                    // Step through powers of two, finishing at the thread maximum
+                    if (num_threads == max_threads) {
+                        break;
+                    }
+                    num_threads = (num_threads * 2 < max_threads) ? num_threads * 2 : max_threads;
+                }
+            }
+        }
+
+        free_region_list(&region_list);
+    }
+
+    free(free_samples);
+    free(allocate_samples);
+    free(threads);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,578 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: memory_allocator_soak
+ * Scope: Performance
+ *
+ * Purpose: Runs hsa_memory_allocate and hsa_memory_free for a long time with
+ * mixed allocation sizes and a steady live set, to reproduce the slow
+ * degradation of long running processes: fragmentation, failing
+ * allocations, growing latency and growing memory use.
+ *
+ * Test Description:
+ * 1) For each agent, find the fine grained global, coarse grained global and
+ * kernarg regions.
+ * 2) For each region, and for each size model, run MEMORY_SOAK_THREADS
+ * threads for MEMORY_SOAK_SECONDS seconds. The size models are:
+ *    a) log-normal, with a median of MEMORY_SOAK_MEDIAN_BYTES bytes.
+ *    b) bimodal, small buffers around 256 bytes with one in
+ *    MEMORY_SOAK_LARGE_ONE_IN buffers around MEMORY_SOAK_LARGE_BYTES bytes.
+ *    c) a trace, when MEMORY_SOAK_TRACE names a file with one allocation size
+ *    in bytes per line. Empty lines and lines starting with # are skipped.
+ * 3) Each thread keeps its share of a live set of MEMORY_SOAK_LIVE_BYTES
+ * bytes. While it is below its share a thread mostly allocates, otherwise it
+ * frees a randomly chosen live buffer, so buffers of different sizes and
+ * ages are interleaved.
+ * 4) The run is split into MEMORY_SOAK_INTERVALS intervals. For each
+ * interval report the allocations, the allocation failure rate, the median
+ * and 99th percentile allocate and free latency, the live bytes and their
+ * utilization, that is the requested bytes over the bytes rounded up to the
+ * allocation granule, and the resident set size of the process.
+ * 5) Report the drift of the median allocation latency and of the resident
+ * set size from the first to the last interval, and flag a latency drift of
+ * more than MEMORY_SOAK_DRIFT times.
+ *
+ * For a soak of several hours, set MEMORY_SOAK_SECONDS and run the test with
+ * CK_FORK=no, which disables the test timeout.
+ *
+ * Expected Results: Allocations within the live set should not fail, and the
+ * latency and resident set size should not grow over the run.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <framework.h>
+#include <math.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MEMORY_SOAK_THREADS 1
+#define MEMORY_SOAK_SECONDS 1
+#define MEMORY_SOAK_INTERVALS 10
+#define MEMORY_SOAK_LIVE_BYTES (64 * 1024 * 1024)
+#define MEMORY_SOAK_MEDIAN_BYTES 4096
+#define MEMORY_SOAK_LARGE_BYTES (1024 * 1024)
+#define MEMORY_SOAK_LARGE_ONE_IN 16
+#define MEMORY_SOAK_DRIFT 2
+#define MEMORY_SOAK_SEED 1
+
+// Spread of the log-normal sizes, the standard deviation of their logarithm
+#define MEMORY_SOAK_SIGMA 1.5
+#define MEMORY_SOAK_BIMODAL_SIGMA 0.5
+#define MEMORY_SOAK_SMALL_BYTES 256
+#define MEMORY_SOAK_TWO_PI 6.283185307179586
+
+// Maximum number of live buffers of a thread
+#define MEMORY_SOAK_MAX_LIVE (64 * 1024)
+
+// Number of latency samples kept per interval and thread
+#define MEMORY_SOAK_RESERVOIR 4096
+
+// The size models
+typedef enum soak_model_e {
+    SOAK_MODEL_LOGNORMAL = 0,
+    SOAK_MODEL_BIMODAL,
+    SOAK_MODEL_TRACE,
+    NUM_SOAK_MODELS
+} soak_model_t;
+
+static const char* SOAK_MODEL_NAMES[NUM_SOAK_MODELS] = {"log-normal", "bimodal", "trace"};
+
+// The measurements of a thread in one interval
+typedef struct soak_interval_s {
+    uint64_t allocations;
+    uint64_t failures;
+    uint64_t frees;
+    // Reservoirs of the allocate and free latencies
+    double* allocate_samples;
+    double* free_samples;
+    // Live bytes at the end of the interval
+    uint64_t live_requested;
+    uint64_t live_rounded;
+    // Resident set size at the end of the interval, sampled by thread 0
+    uint64_t rss_bytes;
+} soak_interval_t;
+
+typedef struct soak_thread_s {
+    int id;
+    hsa_region_t region;
+    size_t granule;
+    size_t max_size;
+    soak_model_t model;
+    uint64_t median_bytes;
+    uint64_t large_bytes;
+    uint64_t large_one_in;
+    const size_t* trace;
+    size_t trace_length;
+    uint64_t live_target;
+    uint64_t seed;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    int num_intervals;
+    soak_interval_t* intervals;
+    uint64_t errors;
+} soak_thread_t;
+
+// xorshift64* pseudo random number generator
+static uint64_t soak_random(uint64_t* state) {
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * 0x2545F4914F6CDD1Dull;
+}
+
+// Uniform random number in (0, 1]
+static double soak_uniform(uint64_t* state) {
+    return (double) ((soak_random(state) >> 11) + 1) / 9007199254740992.0;
+}
+
+// Log-normal random number with the given median
+static double soak_lognormal(uint64_t* state, double median, double sigma) {
+    // Box-Muller transform of two uniform numbers
+    double normal = sqrt(-2.0 * log(soak_uniform(state))) * cos(MEMORY_SOAK_TWO_PI * soak_uniform(state));
+    return median * exp(sigma * normal);
+}
+
+// Get the size of the next allocation of a thread
+static size_t soak_next_size(soak_thread_t* thread, uint64_t* state, size_t* trace_index) {
+    double size;
+    switch (thread->model) {
+    case SOAK_MODEL_LOGNORMAL:
+        size = soak_lognormal(state, (double) thread->median_bytes, MEMORY_SOAK_SIGMA);
+        break;
+    case SOAK_MODEL_BIMODAL:
+        if (0 == soak_random(state) % thread->large_one_in) {
+            size = soak_lognormal(state, (double) thread->large_bytes, MEMORY_SOAK_BIMODAL_SIGMA);
+        } else {
+            size = soak_lognormal(state, MEMORY_SOAK_SMALL_BYTES, MEMORY_SOAK_BIMODAL_SIGMA);
+        }
+        break;
+    default:
+        size = (double) thread->trace[*trace_index];
+        *trace_index = (*trace_index + 1) % thread->trace_length;
+        break;
+    }
+
+    if (size < 1.0) {
+        return 1;
+    }
+
+    return (size > (double) thread->max_size) ? thread->max_size : (size_t) size;
+}
+
+// Add a sample to a reservoir which has seen count samples before it
+static void soak_reservoir_add(double* reservoir, uint64_t count, double sample, uint64_t* state) {
+    if (count < MEMORY_SOAK_RESERVOIR) {
+        reservoir[count] = sample;
+    } else {
+        uint64_t slot = soak_random(state) % (count + 1);
+        if (slot < MEMORY_SOAK_RESERVOIR) {
+            reservoir[slot] = sample;
+        }
+    }
+
+    return;
+}
+
+// Work function for the soak threads
+void thread_proc_memory_soak(void* data) {
+    soak_thread_t* thread = (soak_thread_t*) data;
+
+    void** buffers = (void**) malloc(MEMORY_SOAK_MAX_LIVE * sizeof(void*));
+    size_t* sizes = (size_t*) malloc(MEMORY_SOAK_MAX_LIVE * sizeof(size_t));
+    if (NULL == buffers || NULL == sizes) {
+        ++thread->errors;
+        free(sizes);
+        free(buffers);
+        return;
+    }
+
+    uint64_t state = thread->seed;
+    size_t trace_index = (0 < thread->trace_length) ? (thread->id * 7919u) % thread->trace_length : 0;
+    uint64_t num_live = 0, live_requested = 0, live_rounded = 0;
+    int interval = 0;
+    soak_interval_t* current = &thread->intervals[0];
+
+    while (1) {
+        uint64_t now = perf_get_time_ns();
+        int now_interval = (int) ((double) (now - thread->start_ns) / (double) thread->duration_ns * thread->num_intervals);
+        if (now_interval != interval) {
+            // Close the intervals that have ended
+            while (interval < now_interval && interval < thread->num_intervals) {
+                thread->intervals[interval].live_requested = live_requested;
+                thread->intervals[interval].live_rounded = live_rounded;
+                if (0 == thread->id) {
+                    perf_process_usage_t usage;
+                    perf_get_process_usage(&usage);
+                    thread->intervals[interval].rss_bytes = usage.rss_bytes;
+                }
+                ++interval;
+            }
+            if (interval >= thread->num_intervals) {
+                break;
+            }
+            current = &thread->intervals[interval];
+        }
+
+        // Mostly allocate below the live target, free above it
+        int allocate = (live_requested < thread->live_target) ? (0 != soak_random(&state) % 4) : 0;
+        if (0 == num_live) {
+            allocate = 1;
+        } else if (MEMORY_SOAK_MAX_LIVE == num_live) {
+            allocate = 0;
+        }
+
+        if (allocate) {
+            size_t size = soak_next_size(thread, &state, &trace_index);
+            void* buffer = NULL;
+            uint64_t start = perf_get_time_ns();
+            hsa_status_t status = hsa_memory_allocate(thread->region, size, &buffer);
+            double elapsed = (double) (perf_get_time_ns() - start);
+            soak_reservoir_add(current->allocate_samples, current->allocations, elapsed, &state);
+            ++current->allocations;
+            if (HSA_STATUS_SUCCESS != status) {
+                ++current->failures;
+                // Make room when the region is exhausted
+                if (0 == num_live) {
+                    continue;
+                }
+            } else {
+                buffers[num_live] = buffer;
+                sizes[num_live] = size;
+                ++num_live;
+                live_requested += size;
+                live_rounded += (size + thread->granule - 1) / thread->granule * thread->granule;
+                continue;
+            }
+        }
+
+        // Free a random live buffer, moving the last one into its place
+        uint64_t victim = soak_random(&state) % num_live;
+        uint64_t start = perf_get_time_ns();
+        hsa_status_t status = hsa_memory_free(buffers[victim]);
+        double elapsed = (double) (perf_get_time_ns() - start);
+        if (HSA_STATUS_SUCCESS != status) {
+            ++thread->errors;
+        }
+        soak_reservoir_add(current->free_samples, current->frees, elapsed, &state);
+        ++current->frees;
+        live_requested -= sizes[victim];
+        live_rounded -= (sizes[victim] + thread->granule - 1) / thread->granule * thread->granule;
+        --num_live;
+        buffers[victim] = buffers[num_live];
+        sizes[victim] = sizes[num_live];
+    }
+
+    uint64_t ii;
+    for (ii = 0; ii < num_live; ++ii) {
+        if (HSA_STATUS_SUCCESS != hsa_memory_free(buffers[ii])) {
+            ++thread->errors;
+        }
+    }
+
+    free(sizes);
+    free(buffers);
+
+    return;
+}
+
+// Load a trace of allocation sizes, one size in bytes per line
+static size_t* load_size_trace(const char* path, size_t* length) {
+    FILE* file = fopen(path, "r");
+    if (NULL == file) {
+        return NULL;
+    }
+
+    size_t capacity = 1024, count = 0;
+    size_t* trace = (size_t*) malloc(capacity * sizeof(size_t));
+    char line[256];
+    while (NULL != trace && NULL != fgets(line, sizeof(line), file)) {
+        char* begin = line;
+        while (' ' == *begin || '\t' == *begin) {
+            ++begin;
+        }
+        if ('#' == *begin || '\n' == *begin || '\r' == *begin || '\0' == *begin) {
+            continue;
+        }
+
+        char* end;
+        unsigned long long size = strtoull(begin, &end, 0);
+        if (end == begin || 0 == size) {
+            continue;
+        }
+        if (count == capacity) {
+            capacity *= 2;
+            size_t* grown = (size_t*) realloc(trace, capacity * sizeof(size_t));
+            if (NULL == grown) {
+                free(trace);
+                trace = NULL;
+                break;
+            }
+            trace = grown;
+        }
+        trace[count++] = (size_t) size;
+    }
+    fclose(file);
+
+    if (NULL != trace && 0 == count) {
+        free(trace);
+        trace = NULL;
+    }
+    *length = count;
+
+    return trace;
+}
+
+int test_memory_allocator_soak() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus < 1) {
+        num_cpus = 1;
+    }
+
+    uint32_t num_threads = (uint32_t) perf_get_env_uint("MEMORY_SOAK_THREADS", MEMORY_SOAK_THREADS);
+    uint64_t num_seconds = perf_get_env_uint("MEMORY_SOAK_SECONDS", MEMORY_SOAK_SECONDS);
+    int num_intervals = (int) perf_get_env_uint("MEMORY_SOAK_INTERVALS", MEMORY_SOAK_INTERVALS);
+    uint64_t live_bytes = perf_get_env_uint("MEMORY_SOAK_LIVE_BYTES", MEMORY_SOAK_LIVE_BYTES);
+    uint64_t median_bytes = perf_get_env_uint("MEMORY_SOAK_MEDIAN_BYTES", MEMORY_SOAK_MEDIAN_BYTES);
+    uint64_t large_bytes = perf_get_env_uint("MEMORY_SOAK_LARGE_BYTES", MEMORY_SOAK_LARGE_BYTES);
+    uint64_t large_one_in = perf_get_env_uint("MEMORY_SOAK_LARGE_ONE_IN", MEMORY_SOAK_LARGE_ONE_IN);
+    uint64_t drift_limit = perf_get_env_uint("MEMORY_SOAK_DRIFT", MEMORY_SOAK_DRIFT);
+    uint64_t seed = perf_get_env_uint("MEMORY_SOAK_SEED", MEMORY_SOAK_SEED);
+    ASSERT(0 < num_threads && 0 < num_seconds && 0 < num_intervals && 0 < live_bytes && 0 < large_one_in);
+
+    // The optional trace of allocation sizes
+    size_t* trace = NULL;
+    size_t trace_length = 0;
+    const char* trace_path = getenv("MEMORY_SOAK_TRACE");
+    if (NULL != trace_path && '\0' != *trace_path) {
+        trace = load_size_trace(trace_path, &trace_length);
+        ASSERT_MSG(NULL != trace, "Can't read allocation sizes from %s", trace_path);
+    }
+
+    soak_thread_t* threads = (soak_thread_t*) malloc(num_threads * sizeof(soak_thread_t));
+    soak_interval_t* intervals = (soak_interval_t*) malloc(num_threads * num_intervals * sizeof(soak_interval_t));
+    double* reservoirs = (double*) malloc(2 * num_threads * num_intervals * MEMORY_SOAK_RESERVOIR * sizeof(double));
+    double* samples = (double*) malloc(num_threads * MEMORY_SOAK_RESERVOIR * sizeof(double));
+    ASSERT(NULL != threads && NULL != intervals && NULL != reservoirs && NULL != samples);
+
+    int ii, jj, kk, mm, nn;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t regions[3];
+        const char* region_names[3] = {"fine grained global", "coarse grained global", "kernarg"};
+
+        regions[0].handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &regions[0]);
+        regions[1].handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_coarse_grained, &regions[1]);
+        regions[2].handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &regions[2]);
+
+        for (jj = 0; jj < 3; ++jj) {
+            if ((uint64_t)-1 == regions[jj].handle) {
+                continue;
+            }
+
+            bool allowed;
+            status = hsa_region_get_info(regions[jj], HSA_REGION_INFO_RUNTIME_ALLOC_ALLOWED, &allowed);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            if (!allowed) {
+                continue;
+            }
+            size_t granule, alloc_max_size;
+            status = hsa_region_get_info(regions[jj], HSA_REGION_INFO_RUNTIME_ALLOC_GRANULE, &granule);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            status = hsa_region_get_info(regions[jj], HSA_REGION_INFO_ALLOC_MAX_SIZE, &alloc_max_size);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            granule = (0 == granule) ? 1 : granule;
+
+            // A single buffer is at most the live set share of a thread
+            uint64_t live_target = live_bytes / num_threads;
+            size_t max_size = (alloc_max_size < live_target) ? alloc_max_size : (size_t) live_target;
+            max_size = (0 == max_size) ? 1 : max_size;
+
+            for (kk = 0; kk < NUM_SOAK_MODELS; ++kk) {
+                if (SOAK_MODEL_TRACE == kk && NULL == trace) {
+                    continue;
+                }
+
+                printf("\nAgent %d, %s region, %s sizes: %u threads, %lu live bytes, %lu seconds\n",
+                       ii, region_names[jj], SOAK_MODEL_NAMES[kk], num_threads,
+                       (unsigned long) live_bytes, (unsigned long) num_seconds);
+
+                memset(intervals, 0, num_threads * num_intervals * sizeof(soak_interval_t));
+                struct test_group* tg_soak = test_group_create(num_threads);
+                for (mm = 0; mm < num_threads; ++mm) {
+                    soak_thread_t* thread = &threads[mm];
+                    memset(thread, 0, sizeof(soak_thread_t));
+                    thread->id = mm;
+                    thread->region = regions[jj];
+                    thread->granule = granule;
+                    thread->max_size = max_size;
+                    thread->model = (soak_model_t) kk;
+                    thread->median_bytes = median_bytes;
+                    thread->large_bytes = large_bytes;
+                    thread->large_one_in = large_one_in;
+                    thread->trace = trace;
+                    thread->trace_length = trace_length;
+                    thread->live_target = live_target;
+                    // The seed of xorshift must not be zero
+                    thread->seed = (seed + 1) * 0x9E3779B97F4A7C15ull + (uint64_t) mm + 1;
+                    thread->duration_ns = num_seconds * 1000000000ull;
+                    thread->num_intervals = num_intervals;
+                    thread->intervals = &intervals[mm * num_intervals];
+                    for (nn = 0; nn < num_intervals; ++nn) {
+                        double* reservoir = &reservoirs[(size_t) (mm * num_intervals + nn) * 2 * MEMORY_SOAK_RESERVOIR];
+                        thread->intervals[nn].allocate_samples = reservoir;
+                        thread->intervals[nn].free_samples = reservoir + MEMORY_SOAK_RESERVOIR;
+                    }
+                    test_group_add(tg_soak, &thread_proc_memory_soak, thread, 1);
+                }
+                test_group_thread_create(tg_soak);
+                for (mm = 0; mm < num_threads; ++mm) {
+                    test_group_thread_affinity(tg_soak, mm, mm % num_cpus);
+                }
+                // The intervals start when the threads are released
+                uint64_t start_ns = perf_get_time_ns();
+                for (mm = 0; mm < num_threads; ++mm) {
+                    threads[mm].start_ns = start_ns;
+                }
+                test_group_start(tg_soak);
+                test_group_wait(tg_soak);
+                test_group_exit(tg_soak);
+                test_group_destroy(tg_soak);
+
+                uint64_t errors = 0;
+                for (mm = 0; mm < num_threads; ++mm) {
+                    errors += threads[mm].errors;
+                }
+                ASSERT(0 == errors);
+
+                printf("%8s %10s %12s %8s %12s %12s %12s %12s %12s %8s %10s\n", "interval", "seconds",
+                       "allocations", "fail %", "alloc p50 ns", "alloc p99 ns", "free p50 ns", "free p99 ns",
+                       "live bytes", "util %", "RSS MB");
+
+                double first_p50 = 0.0, last_p50 = 0.0;
+                uint64_t first_rss = 0, last_rss = 0;
+                uint64_t total_allocations = 0, total_failures = 0;
+                for (nn = 0; nn < num_intervals; ++nn) {
+                    uint64_t allocations = 0, failures = 0;
+                    uint64_t live_requested = 0, live_rounded = 0;
+                    perf_stats_t allocate_stats, free_stats;
+                    size_t count = 0;
+                    for (mm = 0; mm < num_threads; ++mm) {
+                        soak_interval_t* interval = &intervals[mm * num_intervals + nn];
+                        uint64_t kept = (interval->allocations < MEMORY_SOAK_RESERVOIR) ? interval->allocations : MEMORY_SOAK_RESERVOIR;
+                        memcpy(&samples[count], interval->allocate_samples, kept * sizeof(double));
+                        count += kept;
+                        allocations += interval->allocations;
+                        failures += interval->failures;
+                        live_requested += interval->live_requested;
+                        live_rounded += interval->live_rounded;
+                    }
+                    perf_compute_stats(samples, count, &allocate_stats);
+                    count = 0;
+                    for (mm = 0; mm < num_threads; ++mm) {
+                        soak_interval_t* interval = &intervals[mm * num_intervals + nn];
+                        uint64_t kept = (interval->frees < MEMORY_SOAK_RESERVOIR) ? interval->frees : MEMORY_SOAK_RESERVOIR;
+                        memcpy(&samples[count], interval->free_samples, kept * sizeof(double));
+                        count += kept;
+                    }
+                    perf_compute_stats(samples, count, &free_stats);
+                    uint64_t rss_bytes = intervals[nn].rss_bytes;
+
+                    printf("%8d %10.1f %12lu %8.3f %12.0f %12.0f %12.0f %12.0f %12lu %8.1f %10.1f\n",
+                           nn, (double) num_seconds * (nn + 1) / num_intervals, (unsigned long) allocations,
+                           (0 < allocations) ? 100.0 * failures / allocations : 0.0,
+                           allocate_stats.p50, allocate_stats.p99, free_stats.p50, free_stats.p99,
+                           (unsigned long) live_requested,
+                           (0 < live_rounded) ? 100.0 * live_requested / live_rounded : 0.0,
+                           rss_bytes / (1024.0 * 1024.0));
+
+                    if (0 == nn) {
+                        first_p50 = allocate_stats.p50;
+                        first_rss = rss_bytes;
+                    }
+                    last_p50 = allocate_stats.p50;
+                    last_rss = rss_bytes;
+                    total_allocations += allocations;
+                    total_failures += failures;
+                }
+
+                double drift = (0.0 < first_p50) ? last_p50 / first_p50 : 0.0;
+                printf("%-40s %lu allocations, %lu failures, allocation latency drift x%.2f%s, RSS %+.1f MB\n", "",
+                       (unsigned long) total_allocations, (unsigned long) total_failures, drift,
+                       (drift > (double) drift_limit) ? " DRIFTING" : "",
+                       ((double) last_rss - (double) first_rss) / (1024.0 * 1024.0));
+            }
+        }
+    }
+
+    free(samples);
+    free(reservoirs);
+    free(intervals);
+    free(threads);
+    free(trace);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,313 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: memory_kernarg_arena
+ * Scope: Performance
+ *
+ * Purpose: Measures the per-dispatch cost of allocating and freeing the
+ * kernel argument and small fine grained buffers a dispatch needs, with raw
+ * hsa_memory_allocate/hsa_memory_free calls and with the thread caching
+ * arena of arena_utils.
+ *
+ * Test Description:
+ * 1) For each agent, find the kernarg region and the fine grained global
+ * region.
+ * 2) For each region, for each mode, and for 1, 2, 4, ... up to
+ * KERNARG_ARENA_MAX_THREADS threads:
+ *    a) Each thread performs KERNARG_ARENA_ITERATIONS dispatch setups. A setup
+ *    allocates KERNARG_ARENA_NUM_BLOCKS buffers of different sizes, writes
+ *    them and frees them again.
+ *    b) In the raw mode every buffer is allocated with hsa_memory_allocate
+ *    and freed with hsa_memory_free.
+ *    c) In the arena mode the buffers are allocated from an arena frame, and
+ *    the frame is released at the end of the setup. Every buffer is checked
+ *    for the requested alignment, and for overlap with the other buffers of
+ *    the setup.
+ * 3) Report the setup latency statistics and the setups per second of each
+ * mode, and the arena counters accumulated over the runs so far.
+ *
+ * Expected Results: The arena should serve every allocation, its buffers
+ * should be aligned and should not overlap, and the arena should have every
+ * block returned at the end of each run.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <arena_utils.h>
+#include <concurrent_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define KERNARG_ARENA_MAX_THREADS 16
+#define KERNARG_ARENA_ITERATIONS 10000
+#define KERNARG_ARENA_ALIGNMENT 16
+#define KERNARG_ARENA_NUM_BLOCKS 4
+
+// Sizes and alignments of the buffers of one dispatch: the kernel arguments,
+// and some small argument buffers
+static const size_t kernarg_arena_sizes[KERNARG_ARENA_NUM_BLOCKS] = {64, 16, 256, 1024};
+static const size_t kernarg_arena_alignments[KERNARG_ARENA_NUM_BLOCKS] = {16, 8, 64, 256};
+
+typedef struct kernarg_arena_thread_s {
+    hsa_region_t region;
+    arena_t* arena;
+    uint64_t num_iterations;
+    double* samples;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint64_t failures;
+    uint64_t errors;
+} kernarg_arena_thread_t;
+
+// Work function for the raw hsa_memory_allocate threads
+void thread_proc_kernarg_raw(void* data) {
+    kernarg_arena_thread_t* thread = (kernarg_arena_thread_t*) data;
+    void* blocks[KERNARG_ARENA_NUM_BLOCKS];
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint64_t ii;
+    int jj;
+    for (ii = 0; ii < thread->num_iterations; ++ii) {
+        uint64_t start = perf_get_time_ns();
+        for (jj = 0; jj < KERNARG_ARENA_NUM_BLOCKS; ++jj) {
+            blocks[jj] = NULL;
+            if (HSA_STATUS_SUCCESS != hsa_memory_allocate(thread->region, kernarg_arena_sizes[jj], &blocks[jj])) {
+                ++thread->failures;
+                continue;
+            }
+            memset(blocks[jj], jj, kernarg_arena_sizes[jj]);
+        }
+        for (jj = 0; jj < KERNARG_ARENA_NUM_BLOCKS; ++jj) {
+            if (NULL != blocks[jj]) {
+                hsa_memory_free(blocks[jj]);
+            }
+        }
+        thread->samples[ii] = (double) (perf_get_time_ns() - start);
+    }
+
+    thread->end_ns = perf_get_time_ns();
+
+    return;
+}
+
+// Work function for the arena threads
+void thread_proc_kernarg_arena(void* data) {
+    kernarg_arena_thread_t* thread = (kernarg_arena_thread_t*) data;
+    arena_frame_t frame;
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint64_t ii;
+    int jj, kk;
+    for (ii = 0; ii < thread->num_iterations; ++ii) {
+        uint64_t start = perf_get_time_ns();
+        arena_frame_begin(thread->arena, &frame);
+        for (jj = 0; jj < KERNARG_ARENA_NUM_BLOCKS; ++jj) {
+            void* block = arena_frame_alloc(&frame, kernarg_arena_sizes[jj], kernarg_arena_alignments[jj]);
+            if (NULL == block) {
+                ++thread->failures;
+                continue;
+            }
+            memset(block, jj, kernarg_arena_sizes[jj]);
+        }
+        uint64_t elapsed = perf_get_time_ns() - start;
+
+        // Verify the buffers outside of the timed section
+        for (jj = 0; jj < frame.count; ++jj) {
+            uintptr_t begin = (uintptr_t) frame.blocks[jj];
+            if (0 != begin % frame.alignments[jj] || 0 != begin % KERNARG_ARENA_ALIGNMENT) {
+                ++thread->errors;
+            }
+            for (kk = 0; kk < jj; ++kk) {
+                uintptr_t other = (uintptr_t) frame.blocks[kk];
+                if (begin < other + frame.sizes[kk] && other < begin + frame.sizes[jj]) {
+                    ++thread->errors;
+                }
+            }
+        }
+
+        start = perf_get_time_ns();
+        arena_frame_release(&frame);
+        elapsed += perf_get_time_ns() - start;
+        thread->samples[ii] = (double) elapsed;
+    }
+
+    thread->end_ns = perf_get_time_ns();
+
+    return;
+}
+
+int test_memory_kernarg_arena() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus < 1) {
+        num_cpus = 1;
+    }
+
+    uint32_t max_threads = (uint32_t) perf_get_env_uint("KERNARG_ARENA_MAX_THREADS",
+            (num_cpus < KERNARG_ARENA_MAX_THREADS) ? (uint64_t) num_cpus : KERNARG_ARENA_MAX_THREADS);
+    uint64_t num_iterations = perf_get_env_uint("KERNARG_ARENA_ITERATIONS", KERNARG_ARENA_ITERATIONS);
+    ASSERT(0 < max_threads && 0 < num_iterations);
+
+    kernarg_arena_thread_t* threads = (kernarg_arena_thread_t*) malloc(max_threads * sizeof(kernarg_arena_thread_t));
+    double* samples = (double*) malloc(max_threads * num_iterations * sizeof(double));
+    ASSERT(NULL != threads && NULL != samples);
+
+    int ii, jj, kk, mm;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t regions[2];
+        const char* region_names[2] = {"kernarg", "fine grained global"};
+
+        regions[0].handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &regions[0]);
+        regions[1].handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &regions[1]);
+
+        for (jj = 0; jj < 2; ++jj) {
+            if ((uint64_t)-1 == regions[jj].handle) {
+                continue;
+            }
+
+            arena_t* arena = arena_create(regions[jj], KERNARG_ARENA_ALIGNMENT);
+            if (NULL == arena) {
+                continue;
+            }
+
+            printf("\nAgent %d, %s region: %d buffers per dispatch, %lu dispatches per thread\n",
+                   ii, region_names[jj], KERNARG_ARENA_NUM_BLOCKS, (unsigned long) num_iterations);
+
+            // Mode 0 uses hsa_memory_allocate, mode 1 the arena
+            for (mm = 0; mm < 2; ++mm) {
+                uint32_t num_threads = 1;
+                while (num_threads <= max_threads) {
+                    struct test_group* tg_arena = test_group_create(num_threads);
+                    for (kk = 0; kk < num_threads; ++kk) {
+                        kernarg_arena_thread_t* thread = &threads[kk];
+                        memset(thread, 0, sizeof(kernarg_arena_thread_t));
+                        thread->region = regions[jj];
+                        thread->arena = arena;
+                        thread->num_iterations = num_iterations;
+                        thread->samples = &samples[kk * num_iterations];
+                        test_group_add(tg_arena, (0 == mm) ? &thread_proc_kernarg_raw : &thread_proc_kernarg_arena, thread, 1);
+                    }
+                    test_group_thread_create(tg_arena);
+                    for (kk = 0; kk < num_threads; ++kk) {
+                        test_group_thread_affinity(tg_arena, kk, kk % num_cpus);
+                    }
+                    test_group_start(tg_arena);
+                    test_group_wait(tg_arena);
+                    // The exiting threads return their caches to the arena
+                    test_group_exit(tg_arena);
+                    test_group_destroy(tg_arena);
+
+                    uint64_t first_start = UINT64_MAX, last_end = 0;
+                    uint64_t failures = 0, errors = 0;
+                    for (kk = 0; kk < num_threads; ++kk) {
+                        first_start = (threads[kk].start_ns < first_start) ? threads[kk].start_ns : first_start;
+                        last_end = (threads[kk].end_ns > last_end) ? threads[kk].end_ns : last_end;
+                        failures += threads[kk].failures;
+                        errors += threads[kk].errors;
+                    }
+                    ASSERT(0 == errors);
+
+                    char label[64];
+                    snprintf(label, sizeof(label), "%s, %u threads", (0 == mm) ? "raw" : "arena", num_threads);
+                    perf_stats_t stats;
+                    perf_compute_stats(samples, num_threads * num_iterations, &stats);
+                    perf_print_stats(label, "ns", &stats);
+                    printf("%-40s %.0f dispatch setups/s, %lu allocation failures\n", "",
+                           (double) num_threads * (double) num_iterations / ((double) (last_end - first_start) * 1e-9),
+                           (unsigned long) failures);
+
+                    if (1 == mm) {
+                        // The arena carves new chunks on demand, so it must serve every allocation
+                        ASSERT(0 == failures);
+
+                        arena_counters_t counters;
+                        arena_get_counters(arena, &counters);
+                        ASSERT(0 == counters.bytes_in_use);
+                        ASSERT(counters.allocations == counters.frees);
+                        printf("%-40s %lu cache hits, %lu refills, %lu flushes, %lu chunks (%lu bytes), %lu large\n", "",
+                               (unsigned long) counters.cache_hits, (unsigned long) counters.cache_refills,
+                               (unsigned long) counters.cache_flushes, (unsigned long) counters.chunk_allocations,
+                               (unsigned long) counters.bytes_reserved, (unsigned long) counters.large_allocations);
+                    }
+
+                    // Step through powers of two, finishing at the thread maximum
+                    if (num_threads == max_threads) {
+                        break;
+                    }
+                    num_threads = (num_threads * 2 < max_threads) ? num_threads * 2 : max_threads;
+                }
+            }
+
+            arena_destroy(arena);
+        }
+    }
+
+    free(samples);
+    free(threads);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -52,11 +52,17 @@ DEFINE_TEST(queue_callback)
 DEFINE_TEST(queue_destroy_concurrent)
 DEFINE_TEST(queue_dispatch_concurrent)
 DEFINE_TEST(queue_full)
+DEFINE_TEST(queue_full_back_pressure)
+DEFINE_TEST(queue_fan_out)
 DEFINE_TEST(queue_multiple_dispatch)
 DEFINE_TEST(queue_inactivate)
+DEFINE_TEST(queue_inactivate_latency)
 DEFINE_TEST(queue_size_create)
 DEFINE_TEST(queue_multiple_queues)
 DEFINE_TEST(queue_multi_gap)
+DEFINE_TEST(queue_multi_gap_latency)
+DEFINE_TEST(queue_soft_queue_processor)
+DEFINE_TEST(queue_soft_queue_throughput)
 DEFINE_TEST(queue_write_index_add_acq_rel_ordering)
 DEFINE_TEST(queue_write_index_add_acquire_release_ordering)
 DEFINE_TEST(queue_write_index_add_atomic)
@@ -64,6 +70,7 @@ DEFINE_TEST(queue_write_index_cas_acq_rel_ordering)
 DEFINE_TEST(queue_write_index_cas_acquire_release_ordering)
 DEFINE_TEST(queue_write_index_cas_atomic)
 DEFINE_TEST(queue_write_index_load_store_atomic)
+DEFINE_TEST(queue_write_index_throughput)
 
 int main(int argc, char* argv[])
 {
@@ -74,11 +81,17 @@ int main(int argc, char* argv[])
     ADD_TEST(queue_destroy_concurrent);
     ADD_TEST(queue_dispatch_concurrent)
     ADD_TEST(queue_full)
+    ADD_TEST(queue_full_back_pressure);
+    ADD_TEST(queue_fan_out);
     ADD_TEST(queue_multiple_dispatch);
     ADD_TEST(queue_inactivate);
+    ADD_TEST(queue_inactivate_latency);
     ADD_TEST(queue_size_create);
     ADD_TEST(queue_multiple_queues)
     ADD_TEST(queue_multi_gap);
+    ADD_TEST(queue_multi_gap_latency);
+    ADD_TEST(queue_soft_queue_processor);
+    ADD_TEST(queue_soft_queue_throughput);
     ADD_TEST(queue_write_index_add_acq_rel_ordering);
     ADD_TEST(queue_write_index_add_acquire_release_ordering);
     ADD_TEST(queue_write_index_add_atomic);
@@ -88,5 +101,6 @@ int main(int argc, char* argv[])
     // This test may not be correct. Doesn't monotonically
     // increment the write index.
     // ADD_TEST(queue_write_index_load_store_atomic);
+    ADD_TEST(queue_write_index_throughput);
     RUN_TESTS();
 }
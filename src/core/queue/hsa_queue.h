@@ -51,12 +51,18 @@ extern int test_queue_create_concurrent();
 extern int test_queue_create_parameters();
 extern int test_queue_destroy_concurrent();
 extern int test_queue_dispatch_concurrent();
+extern int test_queue_fan_out();
 extern int test_queue_multi_gap();
+extern int test_queue_multi_gap_latency();
 extern int test_queue_multiple_queues();
 extern int test_queue_multiple_dispatch();
 extern int test_queue_full();
+extern int test_queue_full_back_pressure();
 extern int test_queue_inactivate();
+extern int test_queue_inactivate_latency();
 extern int test_queue_size_create();
+extern int test_queue_soft_queue_processor();
+extern int test_queue_soft_queue_throughput();
 extern int test_queue_write_index_add_acq_rel_ordering();
 extern int test_queue_write_index_add_acquire_release_ordering();
 extern int test_queue_write_index_add_atomic();
@@ -64,4 +70,5 @@ extern int test_queue_write_index_cas_acq_rel_ordering();
 extern int test_queue_write_index_cas_acquire_release_ordering();
 extern int test_queue_write_index_cas_atomic();
 extern int test_queue_write_index_load_store_atomic();
+extern int test_queue_write_index_throughput();
 #endif  // _HSA_QUEUE_H_
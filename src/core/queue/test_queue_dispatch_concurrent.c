@@ -58,22 +58,24 @@
  * size less than HSA_AGENT_INFO_QUEUE_MAX_SIZE attribute.
  * 3) Create several different threads that concurrently operate on the queue,
  * performing the following operations:
- *    a) Create a signal for use in dispatches.
- *    b) Allocate a small memory location for use with the data_init
- *       kernel.
- *    c) Load and initialize the data_init kernel.
- *    d) Call hsa_queue_add_write_index_acquire to obtain a valid write
+ *    a) Create CON_QUEUE_DISP_IN_FLIGHT dispatch slots, each with a signal
+ *       for use in dispatches, a small memory location for use with the
+ *       data_init kernel and a kernel argument buffer.
+ *    b) Wait until the previous dispatch of the next slot has been verified.
+ *    c) Call hsa_queue_add_write_index_acquire to obtain a valid write
  *       index in the queue.
- *    e) Calls hsa_queue_load_read_index_relaxed in a loop until the write
+ *    d) Calls hsa_queue_load_read_index_relaxed in a loop until the write
  *       index is less than the sum of the read index and the queue size.
- *    f) Populates the packet at the write index with a dispatch packet
+ *    e) Populates the packet at the write index with a dispatch packet
  *       that launches the init_data kernel. The packet and the kernel parameters
  *       should be configured such that a small, one dimensional memory location
- *       should be initialized with a unique value associated with the thread.
- *    g) The thread should wait on the signal for the dispatch to finish.
- *    h) The thread should verify that the memory location was properly initialized.
- *    i) Repeat steps d through i several times, terminating only when the write
+ *       should be initialized with a unique value associated with the dispatch.
+ *    f) Hand the signal to the completion reaper, which waits for the
+ *       dispatch to finish and verifies that the memory location was properly
+ *       initialized, so that the thread keeps several dispatches in flight.
+ *    g) Repeat steps b through g several times, terminating only when the write
  *       index is equal to a set multiple of the specified queue size.
+ *    h) Wait for the remaining dispatches to be verified.
  * 4) Repeat this test for each agent/queue.
  *
  * Expected Results: All dispatches should succeed and the data should be initialized
@@ -87,19 +89,55 @@
 #include <finalize_utils.h>
 #include <framework.h>
 #include <queue_utils.h>
+#include <reaper_utils.h>
 #include <stdlib.h>
 
 #define ARGUMENT_ALIGN_BYTES 16
 #define CON_QUEUE_DISP_NUM_THREADS 32
 #define CON_QUEUE_DISP_DEFAULT_QUEUE_SIZE 256
 #define CON_QUEUE_DISP_TERMINATION_MULTIPLES 2
+#define CON_QUEUE_DISP_IN_FLIGHT 4
+#define CON_QUEUE_DISP_GRID_SIZE 256
 
 typedef struct queue_dispatch_params {
     hsa_agent_t* agent;
     hsa_queue_t* queue;
     symbol_record_t* symbol_record;
+    reaper_t* reaper;
 } queue_dispatch_params_t;
 
+// Declare the kernarg data structure
+typedef struct __attribute__ ((aligned(ARGUMENT_ALIGN_BYTES))) con_queue_dispatch_arg_s {
+    void* data;
+    uint32_t value;
+    uint32_t row_pitch;
+    uint32_t slice_pitch;
+} con_queue_dispatch_arg_t;
+
+// The resources of a dispatch in flight
+typedef struct queue_dispatch_slot_s {
+    uint32_t* data_block;
+    con_queue_dispatch_arg_t* kernarg_buffer;
+    hsa_signal_t signal;
+    // Set to 0 once the dispatch has been verified
+    hsa_signal_t verified;
+    uint32_t value;
+    uint32_t errors;
+} queue_dispatch_slot_t;
+
+// Called by the reaper once a dispatch has finished, verifies the kernel executed correctly
+void verify_dispatch(hsa_signal_value_t value, void* data) {
+    queue_dispatch_slot_t* slot = (queue_dispatch_slot_t*) data;
+    int jj;
+    for (jj = 0; jj < CON_QUEUE_DISP_GRID_SIZE; ++jj) {
+        if (slot->data_block[jj] != slot->value) {
+            ++slot->errors;
+        }
+    }
+    hsa_signal_store_release(slot->verified, 0);
+    return;
+}
+
 // Work function for concurrent queue dispatch
 void thread_proc_dispatch(void* data) {
     hsa_status_t status;
@@ -107,40 +145,35 @@ void thread_proc_dispatch(void* data) {
     queue_dispatch_params_t* param = (queue_dispatch_params_t*) data;
     int num_dispatch_packets = param->queue->size * CON_QUEUE_DISP_TERMINATION_MULTIPLES;
 
-    // Allocate a memory block used by the kernel.
+    // Allocate the memory blocks used by the kernel.
     hsa_region_t global_region;
     global_region.handle=(uint64_t)-1;
     hsa_agent_iterate_regions(*(param->agent), get_global_memory_region_fine_grained, &global_region);
     ASSERT((uint64_t)-1 != global_region.handle);
 
-    const int block_size = 1024;
-    uint32_t* data_block;
-    status = hsa_memory_allocate(global_region, block_size * sizeof(uint32_t), (void**) &data_block);
-    ASSERT(HSA_STATUS_SUCCESS == status);
-
-    // Declare the kernarg data structure
-    struct __attribute__ ((aligned(ARGUMENT_ALIGN_BYTES))) con_queue_dispatch_arg_t {
-        void* data;
-        uint32_t value;
-        uint32_t row_pitch;
-        uint32_t slice_pitch;
-    } args;
-
     // Find a memory region that supports kernel arguments
     hsa_region_t kernarg_region;
     kernarg_region.handle = (uint64_t)-1;
     hsa_agent_iterate_regions(*(param->agent), get_kernarg_memory_region, &kernarg_region);
     ASSERT((uint64_t)-1 != kernarg_region.handle);
 
-    // Allocate the kernel argument buffer from the correct region
-    void* kernarg_buffer = NULL;
-    status = hsa_memory_allocate(kernarg_region, sizeof(args), &kernarg_buffer);
-    ASSERT(HSA_STATUS_SUCCESS == status);
+    queue_dispatch_slot_t slots[CON_QUEUE_DISP_IN_FLIGHT];
+    int ii;
+    for (ii = 0; ii < CON_QUEUE_DISP_IN_FLIGHT; ++ii) {
+        status = hsa_memory_allocate(global_region, CON_QUEUE_DISP_GRID_SIZE * sizeof(uint32_t), (void**) &slots[ii].data_block);
+        ASSERT(HSA_STATUS_SUCCESS == status);
 
-    // Create a signal for dispatch
-    hsa_signal_t signal;
-    status = hsa_signal_create(1, 0, NULL, &signal);
-    ASSERT(HSA_STATUS_SUCCESS == status);
+        // Allocate the kernel argument buffer from the correct region
+        status = hsa_memory_allocate(kernarg_region, sizeof(con_queue_dispatch_arg_t), (void**) &slots[ii].kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create the signals for dispatch
+        status = hsa_signal_create(1, 0, NULL, &slots[ii].signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_signal_create(0, 0, NULL, &slots[ii].verified);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        slots[ii].errors = 0;
+    }
 
     // Fill in info for the default dispatch packet
     hsa_kernel_dispatch_packet_t dispatch_packet;
@@ -154,56 +187,59 @@ void thread_proc_dispatch(void* data) {
     dispatch_packet.workgroup_size_x = 256;
     dispatch_packet.workgroup_size_y = 1;
     dispatch_packet.workgroup_size_z = 1;
-    dispatch_packet.grid_size_x = 256;
-    dispatch_packet.grid_size_x = 1;
-    dispatch_packet.grid_size_x = 1;
+    dispatch_packet.grid_size_x = CON_QUEUE_DISP_GRID_SIZE;
+    dispatch_packet.grid_size_y = 1;
+    dispatch_packet.grid_size_z = 1;
     dispatch_packet.group_segment_size = param->symbol_record->group_segment_size;
     dispatch_packet.private_segment_size = param->symbol_record->private_segment_size;
     dispatch_packet.kernel_object = param->symbol_record->kernel_object;
     dispatch_packet.kernarg_address = 0;
-    dispatch_packet.completion_signal = signal;
 
-    int ii;
     for (ii = 0; ii < num_dispatch_packets; ++ii) {
-        // Reinitialize the signal's value
-        hsa_signal_store_relaxed(signal, 1);
+        queue_dispatch_slot_t* slot = &slots[ii % CON_QUEUE_DISP_IN_FLIGHT];
+
+        // Wait until the previous dispatch of the slot has been verified
+        hsa_signal_wait_acquire(slot->verified, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
+
+        // Reinitialize the signals' values
+        hsa_signal_store_relaxed(slot->signal, 1);
+        hsa_signal_store_relaxed(slot->verified, 1);
 
         // Setup the kernarg arguments
-        args.data = data_block;
-        args.value = (uint32_t)ii;
-        args.row_pitch = (uint32_t)0;
-        args.slice_pitch = (uint32_t)0;
-        memcpy(kernarg_buffer, &args, sizeof(args));
+        slot->value = (uint32_t)ii;
+        slot->kernarg_buffer->data = slot->data_block;
+        slot->kernarg_buffer->value = (uint32_t)ii;
+        slot->kernarg_buffer->row_pitch = (uint32_t)0;
+        slot->kernarg_buffer->slice_pitch = (uint32_t)0;
 
         // Initialize the packet with specific parameters.
-        dispatch_packet.kernarg_address = (void*) kernarg_buffer;
+        dispatch_packet.kernarg_address = (void*) slot->kernarg_buffer;
+        dispatch_packet.completion_signal = slot->signal;
 
         // Dispatch the kernel
         enqueue_dispatch_packet(param->queue, &dispatch_packet);
 
-        // Wait until the kernel complete
-        hsa_signal_wait_relaxed(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
-
-        // Verify the kernel executed correctly
-        int valid = 1;
-        int failIndex = 0;
-        int jj;
-        for (jj = 0; jj < block_size; ++jj) {
-            if (data_block[jj] != (uint32_t)ii) {
-                failIndex = jj;
-                valid = 0;
-            }
-        }
+        // Let the reaper wait for the kernel to complete and verify it
+        reaper_add(param->reaper, slot->signal, HSA_SIGNAL_CONDITION_LT, 1, verify_dispatch, slot);
     }
 
-    status = hsa_signal_destroy(signal);
-    ASSERT(HSA_STATUS_SUCCESS == status);
+    uint32_t errors = 0;
+    for (ii = 0; ii < CON_QUEUE_DISP_IN_FLIGHT; ++ii) {
+        hsa_signal_wait_acquire(slots[ii].verified, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
+        errors += slots[ii].errors;
 
-    status = hsa_memory_free(kernarg_buffer);
-    ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_signal_destroy(slots[ii].signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_signal_destroy(slots[ii].verified);
+        ASSERT(HSA_STATUS_SUCCESS == status);
 
-    status = hsa_memory_free(data_block);
-    ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_memory_free(slots[ii].kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        status = hsa_memory_free(slots[ii].data_block);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+    ASSERT(0 == errors);
 
     return;
 }
@@ -299,6 +335,10 @@ int test_queue_dispatch_concurrent() {
         params.queue = queue;
         params.symbol_record = &symbol_record;
 
+        // The reaper waits for the dispatches of all of the threads
+        params.reaper = reaper_create(CON_QUEUE_DISP_NUM_THREADS * CON_QUEUE_DISP_IN_FLIGHT);
+        ASSERT(NULL != params.reaper);
+
         // Create the test group
         struct test_group* tg_concurrent_queue_dispatch = test_group_create(CON_QUEUE_DISP_NUM_THREADS);
         test_group_add(tg_concurrent_queue_dispatch, &thread_proc_dispatch, &params, CON_QUEUE_DISP_NUM_THREADS);
@@ -308,6 +348,8 @@ int test_queue_dispatch_concurrent() {
         test_group_exit(tg_concurrent_queue_dispatch);
         test_group_destroy(tg_concurrent_queue_dispatch);
 
+        reaper_destroy(params.reaper);
+
         // Destroy the executable
         status = hsa_executable_destroy(executable);
         ASSERT(HSA_STATUS_SUCCESS == status);
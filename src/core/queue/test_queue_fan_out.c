@@ -0,0 +1,381 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_fan_out
+ * Scope: Performance
+ *
+ * Purpose: Measures how dispatch throughput scales when work is spread over
+ * several queues of an agent, each fed by a dedicated host thread, and compares
+ * it with the same number of threads sharing a single multi-producer queue.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH, load and
+ * finalize the no_op and init_data kernels.
+ * 2) For each kernel, and for 1, 2, 4, ... up to HSA_AGENT_INFO_QUEUES_MAX
+ * threads (capped by FAN_OUT_MAX_QUEUES):
+ *    a) Sharded: create one HSA_QUEUE_TYPE_SINGLE queue per thread. Each thread
+ *    enqueues FAN_OUT_DISPATCHES_PER_THREAD dispatches to its own queue and
+ *    waits for its completion signal.
+ *    b) Shared: if the agent supports HSA_QUEUE_TYPE_MULTI, create a single queue
+ *    and have all of the threads enqueue to it.
+ *    c) Each thread records when it started and when its last dispatch
+ *    completed. The init_data dispatches write a value unique to the thread,
+ *    which is verified after completion.
+ * 3) Report the aggregate dispatch throughput, the coefficient of variation of
+ * the per-thread throughput (fairness), and the spread of the per-thread
+ * completion times (skew).
+ *
+ * Expected Results: All dispatches should complete and the data should be
+ * initialized correctly.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <queue_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARGUMENT_ALIGN_BYTES 16
+#define FAN_OUT_QUEUE_SIZE 256
+#define FAN_OUT_MAX_QUEUES 64
+#define FAN_OUT_DISPATCHES_PER_THREAD 4096
+#define FAN_OUT_DATA_SIZE 256
+
+typedef struct fan_out_thread_s {
+    hsa_queue_t* queue;
+    hsa_kernel_dispatch_packet_t dispatch_packet;
+    uint32_t num_dispatches;
+    uint64_t start_ns;
+    uint64_t end_ns;
+} fan_out_thread_t;
+
+// Work function for the dispatch threads
+void thread_proc_fan_out(void* data) {
+    fan_out_thread_t* thread = (fan_out_thread_t*) data;
+
+    hsa_signal_store_relaxed(thread->dispatch_packet.completion_signal, thread->num_dispatches);
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint32_t ii;
+    for (ii = 0; ii < thread->num_dispatches; ++ii) {
+        enqueue_dispatch_packet(thread->queue, &thread->dispatch_packet);
+    }
+
+    // Wait for all of the thread's dispatches to complete
+    while (0 != hsa_signal_wait_acquire(thread->dispatch_packet.completion_signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_ACTIVE));
+
+    thread->end_ns = perf_get_time_ns();
+
+    return;
+}
+
+int test_queue_fan_out() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG modules
+    const char* module_files[2] = {"no_op.brig", "init_data.brig"};
+    char* kernel_names[2] = {"&__no_op_kernel", "&__init_int_data_kernel"};
+    hsa_ext_module_t modules[2];
+    ASSERT(0 == load_module_from_file(module_files[0], &modules[0]));
+    ASSERT(0 == load_module_from_file(module_files[1], &modules[1]));
+
+    // Get the agent list
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t max_threads = (uint32_t) perf_get_env_uint("FAN_OUT_MAX_QUEUES", FAN_OUT_MAX_QUEUES);
+    uint32_t num_dispatches = (uint32_t) perf_get_env_uint("FAN_OUT_DISPATCHES_PER_THREAD", FAN_OUT_DISPATCHES_PER_THREAD);
+    ASSERT(0 < max_threads && 0 < num_dispatches);
+
+    int ii, jj, kk, mm;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        uint32_t queue_max;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUES_MAX, &queue_max);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (queue_max < 1) {
+            continue;
+        }
+        if (queue_max > max_threads) {
+            queue_max = max_threads;
+        }
+
+        hsa_queue_type_t queue_type;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_TYPE, &queue_type);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        uint32_t queue_size = FAN_OUT_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // Find a global region for the data buffers
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        ASSERT((uint64_t)-1 != global_region.handle);
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // Finalize an executable for each kernel
+        hsa_code_object_t code_objects[2];
+        hsa_executable_t executables[2];
+        symbol_record_t symbol_records[2];
+        for (kk = 0; kk < 2; ++kk) {
+            hsa_ext_control_directives_t control_directives;
+            memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+            status = finalize_executable(agent_list.agents[ii],
+                                         1,
+                                         &modules[kk],
+                                         HSA_MACHINE_MODEL_LARGE,
+                                         HSA_PROFILE_FULL,
+                                         HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                         HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                         0,
+                                         control_directives,
+                                         &code_objects[kk],
+                                         &executables[kk]);
+
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            memset(&symbol_records[kk], 0, sizeof(symbol_record_t));
+            status = get_executable_symbols(executables[kk], agent_list.agents[ii], 0, 1, &kernel_names[kk], &symbol_records[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        // Allocate the per thread resources
+        fan_out_thread_t* threads = (fan_out_thread_t*) malloc(queue_max * sizeof(fan_out_thread_t));
+        hsa_queue_t** queues = (hsa_queue_t**) malloc(queue_max * sizeof(hsa_queue_t*));
+        hsa_signal_t* signals = (hsa_signal_t*) malloc(queue_max * sizeof(hsa_signal_t));
+        uint32_t** data = (uint32_t**) malloc(queue_max * sizeof(uint32_t*));
+        void** kernarg_buffers = (void**) malloc(queue_max * sizeof(void*));
+        double* samples = (double*) malloc(queue_max * sizeof(double));
+        ASSERT(NULL != threads && NULL != queues && NULL != signals && NULL != data && NULL != kernarg_buffers && NULL != samples);
+
+        struct __attribute__((aligned(ARGUMENT_ALIGN_BYTES))) args_t {
+            void* data;
+            uint32_t value;
+            uint32_t row_pitch;
+            uint32_t slice_pitch;
+        } args;
+
+        for (jj = 0; jj < queue_max; ++jj) {
+            status = hsa_signal_create(1, 0, NULL, &signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            status = hsa_memory_allocate(global_region, FAN_OUT_DATA_SIZE * sizeof(uint32_t), (void**) &data[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            status = hsa_memory_allocate(kernarg_region, symbol_records[1].kernarg_segment_size, &kernarg_buffers[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            args.data = data[jj];
+            args.value = (uint32_t) jj + 1;
+            args.row_pitch = 0;
+            args.slice_pitch = 0;
+            memcpy(kernarg_buffers[jj], &args, sizeof(args));
+        }
+
+        printf("\nAgent %d: up to %u queues of %u packets, %u dispatches per thread\n",
+               ii, queue_max, queue_size, num_dispatches);
+
+        for (kk = 0; kk < 2; ++kk) {
+            uint32_t num_threads = 1;
+            while (num_threads <= queue_max) {
+                // Mode 0 is one queue per thread, mode 1 is a single shared MULTI queue
+                for (mm = 0; mm < 2; ++mm) {
+                    if (1 == mm && HSA_QUEUE_TYPE_MULTI != queue_type) {
+                        continue;
+                    }
+
+                    uint32_t num_queues = (0 == mm) ? num_threads : 1;
+                    for (jj = 0; jj < num_queues; ++jj) {
+                        status = hsa_queue_create(agent_list.agents[ii], queue_size, (0 == mm) ? HSA_QUEUE_TYPE_SINGLE : HSA_QUEUE_TYPE_MULTI,
+                                                  NULL, NULL, UINT32_MAX, UINT32_MAX, &queues[jj]);
+                        ASSERT(HSA_STATUS_SUCCESS == status);
+                    }
+
+                    struct test_group* tg_fan_out = test_group_create(num_threads);
+                    for (jj = 0; jj < num_threads; ++jj) {
+                        fan_out_thread_t* thread = &threads[jj];
+                        memset(thread, 0, sizeof(fan_out_thread_t));
+                        thread->queue = queues[(0 == mm) ? jj : 0];
+                        thread->num_dispatches = num_dispatches;
+
+                        hsa_kernel_dispatch_packet_t* packet = &thread->dispatch_packet;
+                        packet->header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+                        packet->header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+                        packet->header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+                        packet->setup |= 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+                        packet->workgroup_size_x = FAN_OUT_DATA_SIZE;
+                        packet->workgroup_size_y = 1;
+                        packet->workgroup_size_z = 1;
+                        packet->grid_size_x = FAN_OUT_DATA_SIZE;
+                        packet->grid_size_y = 1;
+                        packet->grid_size_z = 1;
+                        packet->group_segment_size = symbol_records[kk].group_segment_size;
+                        packet->private_segment_size = symbol_records[kk].private_segment_size;
+                        packet->kernel_object = symbol_records[kk].kernel_object;
+                        packet->kernarg_address = (1 == kk) ? kernarg_buffers[jj] : 0;
+                        packet->completion_signal = signals[jj];
+
+                        memset(data[jj], 0, FAN_OUT_DATA_SIZE * sizeof(uint32_t));
+
+                        test_group_add(tg_fan_out, &thread_proc_fan_out, thread, 1);
+                    }
+                    test_group_thread_create(tg_fan_out);
+                    test_group_start(tg_fan_out);
+                    test_group_wait(tg_fan_out);
+                    test_group_exit(tg_fan_out);
+                    test_group_destroy(tg_fan_out);
+
+                    // Validate the data written by the init_data kernel
+                    if (1 == kk) {
+                        for (jj = 0; jj < num_threads; ++jj) {
+                            int ee;
+                            for (ee = 0; ee < FAN_OUT_DATA_SIZE; ++ee) {
+                                ASSERT((uint32_t) jj + 1 == data[jj][ee]);
+                            }
+                        }
+                    }
+
+                    // Compute the aggregate throughput, fairness and skew
+                    uint64_t first_start = UINT64_MAX, first_end = UINT64_MAX, last_end = 0;
+                    for (jj = 0; jj < num_threads; ++jj) {
+                        first_start = (threads[jj].start_ns < first_start) ? threads[jj].start_ns : first_start;
+                        first_end = (threads[jj].end_ns < first_end) ? threads[jj].end_ns : first_end;
+                        last_end = (threads[jj].end_ns > last_end) ? threads[jj].end_ns : last_end;
+                        samples[jj] = (double) num_dispatches / ((double) (threads[jj].end_ns - threads[jj].start_ns) * 1e-9);
+                    }
+
+                    perf_stats_t stats;
+                    perf_compute_stats(samples, num_threads, &stats);
+                    double elapsed_s = (double) (last_end - first_start) * 1e-9;
+                    printf("%-6s %-7s %3u threads %3u queues: %10.0f dispatches/s, per thread cv %.3f, completion skew %.3f ms\n",
+                           (0 == kk) ? "no_op" : "init",
+                           (0 == mm) ? "sharded" : "shared",
+                           num_threads, num_queues,
+                           (double) num_threads * num_dispatches / elapsed_s,
+                           stats.cv,
+                           (double) (last_end - first_end) * 1e-6);
+
+                    for (jj = 0; jj < num_queues; ++jj) {
+                        status = hsa_queue_destroy(queues[jj]);
+                        ASSERT(HSA_STATUS_SUCCESS == status);
+                    }
+                }
+
+                // Step through powers of two, finishing at the queue maximum
+                if (num_threads == queue_max) {
+                    break;
+                }
+                num_threads = (num_threads * 2 < queue_max) ? num_threads * 2 : queue_max;
+            }
+        }
+
+        for (jj = 0; jj < queue_max; ++jj) {
+            status = hsa_signal_destroy(signals[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            status = hsa_memory_free(data[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            status = hsa_memory_free(kernarg_buffers[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        free(samples);
+        free(kernarg_buffers);
+        free(data);
+        free(signals);
+        free(queues);
+        free(threads);
+
+        for (kk = 0; kk < 2; ++kk) {
+            // Destroy the executable
+            status = hsa_executable_destroy(executables[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            // Destroy the code object
+            status = hsa_code_object_destroy(code_objects[kk]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+    }
+
+    // Destroy the loaded modules
+    destroy_module(modules[0]);
+    destroy_module(modules[1]);
+
+    // Shutdown runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,480 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_full_back_pressure
+ * Scope: Performance
+ *
+ * Purpose: Characterizes the behavior of producers that continuously push
+ * packets into a queue that the packet processor drains more slowly than
+ * it is filled, and compares the policies a producer can use to wait for
+ * a free packet slot.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH and
+ * multi-producer queues, create a small HSA_QUEUE_TYPE_MULTI queue.
+ * 2) Load and finalize the init_data kernel, which is used as a busy
+ * kernel. The grid size of each dispatch determines how slowly the
+ * queue drains and is configurable with the BACK_PRESSURE_GRID_SIZE
+ * environment variable.
+ * 3) For each wait policy (spin, yield and blocked signal wait) start
+ * several producer threads. Each producer reserves a write index and, while
+ * the slot at that index is still occupied, waits using the policy.
+ *    a) spin: poll the read index in a tight loop, as enqueue_dispatch_packet_at does.
+ *    b) yield: poll the read index, calling sched_yield between polls.
+ *    c) signal: block on the completion signal until the packet occupying the
+ *       slot has completed, the runtime's futex-style wait.
+ * 4) Every dispatch decrements a shared completion signal. Wait until all
+ * of the dispatches have completed and verify the data buffer.
+ * 5) Report, for each policy, the dispatch throughput, the time producers
+ * were stalled, the CPU time burned while stalled, and how often the read
+ * index was observed to change while stalled.
+ *
+ * Expected Results: All dispatches should complete and the data should be
+ * initialized correctly. The measurements are reported for information.
+ */
+
+#define _GNU_SOURCE
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARGUMENT_ALIGN_BYTES 16
+#define BACK_PRESSURE_QUEUE_SIZE 64
+#define BACK_PRESSURE_NUM_PRODUCERS 4
+#define BACK_PRESSURE_PACKETS_PER_PRODUCER 1024
+#define BACK_PRESSURE_GRID_SIZE (1024 * 1024)
+#define BACK_PRESSURE_WORKGROUP_SIZE 256
+#define BACK_PRESSURE_DATA_VALUE 0x5a5a5a5a
+
+typedef enum back_pressure_policy_e {
+    BACK_PRESSURE_POLICY_SPIN,
+    BACK_PRESSURE_POLICY_YIELD,
+    BACK_PRESSURE_POLICY_SIGNAL,
+    BACK_PRESSURE_POLICY_COUNT
+} back_pressure_policy_t;
+
+static const char* policy_names[BACK_PRESSURE_POLICY_COUNT] = {"spin", "yield", "signal"};
+
+typedef struct back_pressure_params_s {
+    hsa_queue_t* queue;
+    back_pressure_policy_t policy;
+    // The dispatch packet prototype shared by all producers
+    hsa_kernel_dispatch_packet_t* dispatch_packet;
+    // The completion signal shared by all of the dispatches
+    hsa_signal_t completion_signal;
+    // The initial value of the completion signal
+    hsa_signal_value_t total_packets;
+    // The write index of the queue when the trial started
+    uint64_t base_index;
+    uint32_t num_packets;
+} back_pressure_params_t;
+
+typedef struct back_pressure_producer_s {
+    back_pressure_params_t* params;
+    // Stall duration samples in nanoseconds, one per stalled packet
+    double* stall_samples;
+    uint64_t stall_count;
+    uint64_t stall_ns;
+    uint64_t stall_cpu_ns;
+    uint64_t polls;
+    uint64_t read_index_updates;
+    uint64_t read_index_advance;
+} back_pressure_producer_t;
+
+// Wait until the packet slot at write_index is free, using the producer's policy
+static void wait_for_slot(back_pressure_producer_t* producer, uint64_t write_index) {
+    back_pressure_params_t* params = producer->params;
+    hsa_queue_t* queue = params->queue;
+
+    // The slot is occupied until the packet size positions ahead of it
+    // has been consumed, i.e. while write_index - read_index >= size.
+    uint64_t read_index = hsa_queue_load_read_index_relaxed(queue);
+    if (write_index - read_index < queue->size) {
+        return;
+    }
+
+    uint64_t start_ns = perf_get_time_ns();
+    uint64_t start_cpu_ns = perf_get_thread_cpu_time_ns();
+
+    while (write_index - read_index >= queue->size) {
+        switch (params->policy) {
+        case BACK_PRESSURE_POLICY_SPIN:
+            break;
+        case BACK_PRESSURE_POLICY_YIELD:
+            sched_yield();
+            break;
+        case BACK_PRESSURE_POLICY_SIGNAL: {
+            // Dispatches have the barrier bit set and complete in order, so the
+            // k-th dispatch of the trial has completed, and has been consumed by
+            // the packet processor, once the signal drops below total - k.
+            uint64_t occupant = write_index - queue->size - params->base_index;
+            hsa_signal_value_t target = params->total_packets - (hsa_signal_value_t) occupant;
+            hsa_signal_wait_acquire(params->completion_signal, HSA_SIGNAL_CONDITION_LT, target, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
+            break;
+        }
+        default:
+            break;
+        }
+
+        uint64_t new_read_index = hsa_queue_load_read_index_relaxed(queue);
+        ++producer->polls;
+        if (new_read_index != read_index) {
+            ++producer->read_index_updates;
+            producer->read_index_advance += new_read_index - read_index;
+            read_index = new_read_index;
+        }
+    }
+
+    uint64_t elapsed_ns = perf_get_time_ns() - start_ns;
+    producer->stall_cpu_ns += perf_get_thread_cpu_time_ns() - start_cpu_ns;
+    producer->stall_ns += elapsed_ns;
+    producer->stall_samples[producer->stall_count++] = (double) elapsed_ns;
+
+    return;
+}
+
+// Work function for the producer threads
+void thread_proc_back_pressure(void* data) {
+    back_pressure_producer_t* producer = (back_pressure_producer_t*) data;
+    back_pressure_params_t* params = producer->params;
+    hsa_queue_t* queue = params->queue;
+    const uint32_t queue_mask = queue->size - 1;
+
+    uint32_t ii;
+    for (ii = 0; ii < params->num_packets; ++ii) {
+        // Reserve a packet slot and wait until it is free
+        uint64_t write_index = hsa_queue_add_write_index_relaxed(queue, 1);
+        wait_for_slot(producer, write_index);
+
+        hsa_kernel_dispatch_packet_t* packet_base
+                  = &((hsa_kernel_dispatch_packet_t*)(queue->base_address))[write_index&queue_mask];
+
+        // Copy over the packet information
+        memcpy(&packet_base->setup, &params->dispatch_packet->setup, sizeof(hsa_kernel_dispatch_packet_t) - sizeof(packet_base->header));
+
+        // Atomically set the packet header
+        __atomic_store_n((uint16_t*) packet_base, params->dispatch_packet->header, __ATOMIC_RELEASE);
+
+        // Ring the doorbell.
+        hsa_signal_store_release(queue->doorbell_signal, write_index);
+    }
+
+    return;
+}
+
+int test_queue_full_back_pressure() {
+    hsa_status_t status;
+
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("init_data.brig", &module));
+
+    // Get the agent list
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    // The benchmark parameters can be overridden from the environment
+    uint32_t num_producers = (uint32_t) perf_get_env_uint("BACK_PRESSURE_NUM_PRODUCERS", BACK_PRESSURE_NUM_PRODUCERS);
+    uint32_t num_packets = (uint32_t) perf_get_env_uint("BACK_PRESSURE_PACKETS_PER_PRODUCER", BACK_PRESSURE_PACKETS_PER_PRODUCER);
+    uint32_t grid_size = (uint32_t) perf_get_env_uint("BACK_PRESSURE_GRID_SIZE", BACK_PRESSURE_GRID_SIZE);
+    ASSERT(0 < num_producers && 0 < num_packets && 0 < grid_size);
+
+    int ii, jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Only test on agents the support the queue dispatch feature.
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (!(features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Several producers share the queue, so it must support QUEUE_TYPE_MULTI
+        hsa_queue_type_t queue_type;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_TYPE, &queue_type);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (HSA_QUEUE_TYPE_MULTI != queue_type) {
+            continue;
+        }
+
+        // Adjust the queue size
+        uint32_t queue_size = BACK_PRESSURE_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // Find a global region for the data buffer
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        ASSERT((uint64_t)-1 != global_region.handle);
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // Finalize the executable
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__init_int_data_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Allocate the data buffer written by the busy kernel
+        uint32_t* data;
+        status = hsa_memory_allocate(global_region, grid_size * sizeof(uint32_t), (void**) &data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // All of the dispatches share the same kernel arguments
+        struct __attribute__((aligned(ARGUMENT_ALIGN_BYTES))) args_t {
+            void* data;
+            uint32_t value;
+            uint32_t row_pitch;
+            uint32_t slice_pitch;
+        } args;
+        args.data = data;
+        args.value = BACK_PRESSURE_DATA_VALUE;
+        args.row_pitch = 0;
+        args.slice_pitch = 0;
+
+        void* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, symbol_record.kernarg_segment_size, &kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        memcpy(kernarg_buffer, &args, sizeof(args));
+
+        // Create the completion signal shared by all dispatches
+        hsa_signal_t signal;
+        status = hsa_signal_create(1, 0, NULL, &signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Create the prototype packet data. The barrier bit keeps the
+        // dispatches serialized, so the queue drains one kernel at a time.
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_packet.header |= 1 << HSA_PACKET_HEADER_BARRIER;
+        dispatch_packet.setup |= 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        dispatch_packet.workgroup_size_x = (grid_size < BACK_PRESSURE_WORKGROUP_SIZE) ? grid_size : BACK_PRESSURE_WORKGROUP_SIZE;
+        dispatch_packet.workgroup_size_y = 1;
+        dispatch_packet.workgroup_size_z = 1;
+        dispatch_packet.grid_size_x = grid_size;
+        dispatch_packet.grid_size_y = 1;
+        dispatch_packet.grid_size_z = 1;
+        dispatch_packet.group_segment_size = symbol_record.group_segment_size;
+        dispatch_packet.private_segment_size = symbol_record.private_segment_size;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+        dispatch_packet.kernarg_address = kernarg_buffer;
+        dispatch_packet.completion_signal = signal;
+
+        printf("\nAgent %d: queue size %u, %u producers, %u packets per producer, grid size %u\n",
+               ii, queue_size, num_producers, num_packets, grid_size);
+
+        back_pressure_producer_t* producers = (back_pressure_producer_t*) malloc(num_producers * sizeof(back_pressure_producer_t));
+        double* stall_samples = (double*) malloc((size_t) num_producers * num_packets * sizeof(double));
+        ASSERT(NULL != producers && NULL != stall_samples);
+
+        back_pressure_policy_t policy;
+        for (policy = BACK_PRESSURE_POLICY_SPIN; policy < BACK_PRESSURE_POLICY_COUNT; ++policy) {
+            // Use a fresh queue for each policy
+            hsa_queue_t* queue;
+            status = hsa_queue_create(agent_list.agents[ii], queue_size, HSA_QUEUE_TYPE_MULTI, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            memset(data, 0, grid_size * sizeof(uint32_t));
+
+            back_pressure_params_t params;
+            params.queue = queue;
+            params.policy = policy;
+            params.dispatch_packet = &dispatch_packet;
+            params.completion_signal = signal;
+            params.total_packets = (hsa_signal_value_t) num_producers * num_packets;
+            params.base_index = hsa_queue_load_write_index_relaxed(queue);
+            params.num_packets = num_packets;
+
+            hsa_signal_store_relaxed(signal, params.total_packets);
+
+            struct test_group* tg_back_pressure = test_group_create(num_producers);
+            for (jj = 0; jj < num_producers; ++jj) {
+                memset(&producers[jj], 0, sizeof(back_pressure_producer_t));
+                producers[jj].params = &params;
+                producers[jj].stall_samples = stall_samples + (size_t) jj * num_packets;
+                test_group_add(tg_back_pressure, &thread_proc_back_pressure, &producers[jj], 1);
+            }
+            test_group_thread_create(tg_back_pressure);
+
+            uint64_t start_ns = perf_get_time_ns();
+            test_group_start(tg_back_pressure);
+            test_group_wait(tg_back_pressure);
+
+            // Wait for the last dispatch to complete
+            hsa_signal_value_t value;
+            do {
+                value = hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
+            } while (0 != value);
+            uint64_t elapsed_ns = perf_get_time_ns() - start_ns;
+
+            test_group_exit(tg_back_pressure);
+            test_group_destroy(tg_back_pressure);
+
+            // Validate the data
+            for (kk = 0; kk < grid_size; ++kk) {
+                ASSERT(BACK_PRESSURE_DATA_VALUE == data[kk]);
+            }
+
+            // Accumulate the producer statistics
+            uint64_t stall_count = 0, stall_ns = 0, stall_cpu_ns = 0;
+            uint64_t polls = 0, updates = 0, advance = 0;
+            for (jj = 0; jj < num_producers; ++jj) {
+                memmove(stall_samples + stall_count, producers[jj].stall_samples, producers[jj].stall_count * sizeof(double));
+                stall_count += producers[jj].stall_count;
+                stall_ns += producers[jj].stall_ns;
+                stall_cpu_ns += producers[jj].stall_cpu_ns;
+                polls += producers[jj].polls;
+                updates += producers[jj].read_index_updates;
+                advance += producers[jj].read_index_advance;
+            }
+
+            double elapsed_s = (double) elapsed_ns * 1e-9;
+            printf("Policy %-6s: %.0f packets/s, %llu of %llu packets stalled, stalled %.1f%% of producer time\n",
+                   policy_names[policy],
+                   (double) params.total_packets / elapsed_s,
+                   (unsigned long long) stall_count,
+                   (unsigned long long) params.total_packets,
+                   100.0 * (double) stall_ns / ((double) elapsed_ns * num_producers));
+            printf("              CPU while stalled %.3f s (%.1f%% of stalled time), %llu read index polls\n",
+                   (double) stall_cpu_ns * 1e-9,
+                   (0 == stall_ns) ? 0.0 : 100.0 * (double) stall_cpu_ns / (double) stall_ns,
+                   (unsigned long long) polls);
+            printf("              read index updates seen %.0f/s while stalled, %.2f packets per update\n",
+                   (0 == stall_ns) ? 0.0 : (double) updates / ((double) stall_ns * 1e-9),
+                   (0 == updates) ? 0.0 : (double) advance / (double) updates);
+
+            // Convert the stall samples to microseconds
+            for (kk = 0; kk < stall_count; ++kk) {
+                stall_samples[kk] *= 1e-3;
+            }
+            perf_stats_t stats;
+            perf_compute_stats(stall_samples, stall_count, &stats);
+            perf_print_stats("              stall time", "us", &stats);
+
+            // Destroy the queue
+            status = hsa_queue_destroy(queue);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        free(stall_samples);
+        free(producers);
+
+        // Destroy the signal
+        status = hsa_signal_destroy(signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Free the kernel argument and data buffers
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_memory_free(data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,343 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_inactivate_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures how quickly hsa_queue_inactivate fences off a queue that
+ * still has packets in flight, i.e. how long the call takes and how long
+ * packets keep completing after it has returned.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH, load and
+ * finalize the init_data kernel.
+ * 2) For an idle queue and for a queue loaded with INACTIVATE_LATENCY_IN_FLIGHT
+ * packets, repeat INACTIVATE_LATENCY_ITERATIONS times:
+ *    a) Create a queue and enqueue the packets. The packets are init_data
+ *    dispatches of INACTIVATE_LATENCY_GRID_SIZE work-items with the barrier bit
+ *    set, that all decrement one completion signal.
+ *    b) Wait for the first packet to complete, so the packet processor is busy.
+ *    c) Call hsa_queue_inactivate and time the call.
+ *    d) Poll the completion signal for INACTIVATE_LATENCY_SETTLE_MS milliseconds,
+ *    recording when it last changed and how many packets completed after the
+ *    call returned.
+ *    e) Destroy the queue.
+ * 3) Report the call latency, the time from the call to the last completion
+ * (the fence latency), and the number of packets that completed after the call.
+ *
+ * Expected Results: hsa_queue_inactivate should succeed for both the idle and
+ * the loaded queue.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <queue_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARGUMENT_ALIGN_BYTES 16
+#define INACTIVATE_LATENCY_QUEUE_SIZE 1024
+#define INACTIVATE_LATENCY_IN_FLIGHT 256
+#define INACTIVATE_LATENCY_GRID_SIZE 1024*1024
+#define INACTIVATE_LATENCY_ITERATIONS 20
+#define INACTIVATE_LATENCY_SETTLE_MS 100
+
+int test_queue_inactivate_latency() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("init_data.brig", &module));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t in_flight = (uint32_t) perf_get_env_uint("INACTIVATE_LATENCY_IN_FLIGHT", INACTIVATE_LATENCY_IN_FLIGHT);
+    uint32_t grid_size = (uint32_t) perf_get_env_uint("INACTIVATE_LATENCY_GRID_SIZE", INACTIVATE_LATENCY_GRID_SIZE);
+    uint32_t num_iterations = (uint32_t) perf_get_env_uint("INACTIVATE_LATENCY_ITERATIONS", INACTIVATE_LATENCY_ITERATIONS);
+    uint64_t settle_ns = perf_get_env_uint("INACTIVATE_LATENCY_SETTLE_MS", INACTIVATE_LATENCY_SETTLE_MS) * 1000000;
+    ASSERT(0 < grid_size && 0 < num_iterations);
+
+    double* call_samples = (double*) malloc(num_iterations * sizeof(double));
+    double* fence_samples = (double*) malloc(num_iterations * sizeof(double));
+    double* tail_samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != call_samples && NULL != fence_samples && NULL != tail_samples);
+
+    int ii, jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        uint32_t queue_max;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUES_MAX, &queue_max);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (queue_max < 1) {
+            continue;
+        }
+
+        uint32_t queue_size = INACTIVATE_LATENCY_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // All of the packets must fit in the queue, the producer never waits
+        uint32_t agent_in_flight = (in_flight > queue_size) ? queue_size : in_flight;
+
+        uint32_t workgroup_max;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_SIZE, &workgroup_max);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Find a global region for the data buffer
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        ASSERT((uint64_t)-1 != global_region.handle);
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // Finalize the executable
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__init_int_data_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Allocate the data buffer shared by all of the dispatches
+        uint32_t* data = NULL;
+        status = hsa_memory_allocate(global_region, grid_size * sizeof(uint32_t), (void**) &data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        struct __attribute__((aligned(ARGUMENT_ALIGN_BYTES))) args_t {
+            void* data;
+            uint32_t value;
+            uint32_t row_pitch;
+            uint32_t slice_pitch;
+        } args;
+        args.data = data;
+        args.value = 1;
+        args.row_pitch = 0;
+        args.slice_pitch = 0;
+
+        // Size the kernarg buffer for the kernel, which may be padded beyond the arguments
+        size_t kernarg_size = symbol_record.kernarg_segment_size;
+        void* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, kernarg_size, &kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        memset(kernarg_buffer, 0, kernarg_size);
+        memcpy(kernarg_buffer, &args, (sizeof(args) < kernarg_size) ? sizeof(args) : kernarg_size);
+
+        hsa_signal_t signal;
+        status = hsa_signal_create(0, 0, NULL, &signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Serialize the dispatches so the queue stays loaded for as long as possible
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_AGENT << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_AGENT << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_packet.header |= 1 << HSA_PACKET_HEADER_BARRIER;
+        dispatch_packet.setup |= 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        dispatch_packet.workgroup_size_x = (uint16_t) ((grid_size < workgroup_max) ? grid_size : workgroup_max);
+        dispatch_packet.workgroup_size_y = 1;
+        dispatch_packet.workgroup_size_z = 1;
+        dispatch_packet.grid_size_x = grid_size;
+        dispatch_packet.grid_size_y = 1;
+        dispatch_packet.grid_size_z = 1;
+        dispatch_packet.group_segment_size = symbol_record.group_segment_size;
+        dispatch_packet.private_segment_size = symbol_record.private_segment_size;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+        dispatch_packet.kernarg_address = kernarg_buffer;
+        dispatch_packet.completion_signal = signal;
+
+        printf("\nAgent %d: queue of %u packets, %u in flight of %u work-items, %u iterations\n",
+               ii, queue_size, agent_in_flight, grid_size, num_iterations);
+
+        // Load 0 is an idle queue
+        for (kk = 0; kk < 2; ++kk) {
+            uint32_t num_packets = (0 == kk) ? 0 : agent_in_flight;
+            if (1 == kk && 0 == num_packets) {
+                break;
+            }
+
+            for (jj = 0; jj < num_iterations; ++jj) {
+                hsa_queue_t* queue;
+                status = hsa_queue_create(agent_list.agents[ii], queue_size, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+                ASSERT(HSA_STATUS_SUCCESS == status);
+
+                hsa_signal_store_relaxed(signal, num_packets);
+
+                uint32_t pp;
+                for (pp = 0; pp < num_packets; ++pp) {
+                    enqueue_dispatch_packet(queue, &dispatch_packet);
+                }
+
+                // Wait for the first packet to complete
+                if (0 < num_packets) {
+                    hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_LT, num_packets, UINT64_MAX, HSA_WAIT_STATE_ACTIVE);
+                }
+
+                hsa_signal_value_t value = hsa_signal_load_acquire(signal);
+                uint64_t start_ns = perf_get_time_ns();
+                status = hsa_queue_inactivate(queue);
+                uint64_t end_ns = perf_get_time_ns();
+                ASSERT(HSA_STATUS_SUCCESS == status);
+
+                // Watch for packets that still complete after the call returned
+                hsa_signal_value_t returned_value = hsa_signal_load_acquire(signal);
+                uint64_t last_change_ns = (returned_value != value) ? end_ns : start_ns;
+                value = returned_value;
+                uint64_t now_ns = end_ns;
+                while (now_ns - end_ns < settle_ns && 0 != value) {
+                    hsa_signal_value_t current = hsa_signal_load_acquire(signal);
+                    now_ns = perf_get_time_ns();
+                    if (current != value) {
+                        value = current;
+                        last_change_ns = now_ns;
+                    }
+                }
+
+                call_samples[jj] = (double) (end_ns - start_ns) * 1e-3;
+                fence_samples[jj] = (double) (last_change_ns - start_ns) * 1e-3;
+                tail_samples[jj] = (double) (returned_value - value);
+
+                status = hsa_queue_destroy(queue);
+                ASSERT(HSA_STATUS_SUCCESS == status);
+            }
+
+            const char* load = (0 == kk) ? "idle" : "loaded";
+            char label[64];
+            perf_stats_t stats;
+            perf_compute_stats(call_samples, num_iterations, &stats);
+            snprintf(label, sizeof(label), "%s inactivate call", load);
+            perf_print_stats(label, "us", &stats);
+
+            if (0 < num_packets) {
+                perf_compute_stats(fence_samples, num_iterations, &stats);
+                snprintf(label, sizeof(label), "%s inactivate to last completion", load);
+                perf_print_stats(label, "us", &stats);
+
+                perf_compute_stats(tail_samples, num_iterations, &stats);
+                snprintf(label, sizeof(label), "%s completions after the call", load);
+                perf_print_stats(label, "packets", &stats);
+            }
+        }
+
+        status = hsa_signal_destroy(signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        status = hsa_memory_free(data);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(tail_samples);
+    free(fence_samples);
+    free(call_samples);
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,475 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_multi_gap_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures the cost of a gap in a multi producer queue, i.e. a slot
+ * that has been reserved but not yet published. It measures how quickly the
+ * packet processor resumes once the gap is published, how much the packets
+ * queued behind the gap are delayed, and how out of order publication by a
+ * slow producer compares with in order publication.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH, create a
+ *    queue of type HSA_QUEUE_TYPE_MULTI and finalize the init_data kernel.
+ * 2) Resume latency, repeated MULTI_GAP_LATENCY_ITERATIONS times:
+ *    a) Reserve one gap slot followed by MULTI_GAP_LATENCY_BEHIND slots.
+ *    b) Publish the packets behind the gap and ring the doorbell. The header
+ *       of the gap slot stays HSA_PACKET_TYPE_INVALID.
+ *    c) Wait MULTI_GAP_LATENCY_STALL_US and verify that none of the packets
+ *       behind the gap have completed.
+ *    d) Publish the gap packet, ring the doorbell, and record when the gap
+ *       packet and the packets behind it complete.
+ *    e) Repeat the same packets published in order without a gap, as a baseline.
+ * 3) Publication order, repeated MULTI_GAP_LATENCY_ITERATIONS times for in
+ *    order, reverse and shuffled publication:
+ *    a) Reserve MULTI_GAP_LATENCY_BATCH slots.
+ *    b) Publish the packets one at a time in the given order, ringing the
+ *       doorbell after each and waiting MULTI_GAP_LATENCY_PUBLISH_DELAY_US
+ *       between them to model a slow producer.
+ *    c) Record how many packets had completed when the last one was published,
+ *       and when the batch completed.
+ * 4) Verify the data written by every packet.
+ * 5) Report the resume latency against the baseline dispatch latency, the
+ *    extra delay of the packets behind the gap, and for each publication order
+ *    the batch time, the drain time after the last publication and the overlap
+ *    of publication and execution.
+ *
+ * Expected Results: No packet behind an unpublished slot should complete
+ * before the slot is published. All dispatches should finish and all of the
+ * data should be initialized correctly.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARGUMENT_ALIGN_BYTES 16
+#define MULTI_GAP_LATENCY_QUEUE_SIZE 256
+#define MULTI_GAP_LATENCY_BEHIND 32
+#define MULTI_GAP_LATENCY_BATCH 32
+#define MULTI_GAP_LATENCY_ITERATIONS 50
+#define MULTI_GAP_LATENCY_STALL_US 100
+#define MULTI_GAP_LATENCY_PUBLISH_DELAY_US 10
+#define MULTI_GAP_LATENCY_DATA_SIZE 1024
+
+// Publish a packet in an already reserved slot, without ringing the doorbell
+static void publish_gap_packet(hsa_queue_t* queue, uint64_t index, hsa_kernel_dispatch_packet_t* packet) {
+    hsa_kernel_dispatch_packet_t* queue_base = (hsa_kernel_dispatch_packet_t*) queue->base_address;
+    hsa_kernel_dispatch_packet_t* slot = &queue_base[index & (queue->size - 1)];
+    memcpy((uint8_t*) slot + sizeof(packet->header), (uint8_t*) packet + sizeof(packet->header),
+           sizeof(hsa_kernel_dispatch_packet_t) - sizeof(packet->header));
+    __atomic_store_n(&slot->header, packet->header, __ATOMIC_RELEASE);
+    return;
+}
+
+static void spin_ns(uint64_t duration_ns) {
+    uint64_t start_ns = perf_get_time_ns();
+    while (perf_get_time_ns() - start_ns < duration_ns) {}
+    return;
+}
+
+static void wait_signal_zero(hsa_signal_t signal) {
+    while (0 != hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_ACTIVE)) {}
+    return;
+}
+
+static void verify_gap_data(uint32_t** data_blocks, uint32_t num_blocks) {
+    uint32_t ii, jj;
+    for (ii = 0; ii < num_blocks; ++ii) {
+        for (jj = 0; jj < MULTI_GAP_LATENCY_DATA_SIZE; ++jj) {
+            ASSERT(ii + 1 == data_blocks[ii][jj]);
+        }
+        memset(data_blocks[ii], 0, MULTI_GAP_LATENCY_DATA_SIZE * sizeof(uint32_t));
+    }
+    return;
+}
+
+int test_queue_multi_gap_latency() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("init_data.brig", &module));
+
+    // Get a list of agents
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    uint32_t num_behind = (uint32_t) perf_get_env_uint("MULTI_GAP_LATENCY_BEHIND", MULTI_GAP_LATENCY_BEHIND);
+    uint32_t batch_size = (uint32_t) perf_get_env_uint("MULTI_GAP_LATENCY_BATCH", MULTI_GAP_LATENCY_BATCH);
+    uint32_t num_iterations = (uint32_t) perf_get_env_uint("MULTI_GAP_LATENCY_ITERATIONS", MULTI_GAP_LATENCY_ITERATIONS);
+    uint64_t stall_ns = perf_get_env_uint("MULTI_GAP_LATENCY_STALL_US", MULTI_GAP_LATENCY_STALL_US) * 1000;
+    uint64_t publish_delay_ns = perf_get_env_uint("MULTI_GAP_LATENCY_PUBLISH_DELAY_US", MULTI_GAP_LATENCY_PUBLISH_DELAY_US) * 1000;
+    ASSERT(0 < batch_size && 0 < num_iterations);
+
+    // One data block and kernarg per packet slot that is used
+    uint32_t num_blocks = (num_behind + 1 > batch_size) ? num_behind + 1 : batch_size;
+
+    double* samples[4];
+    int ii, jj, kk;
+    for (kk = 0; kk < 4; ++kk) {
+        samples[kk] = (double*) malloc(num_iterations * sizeof(double));
+        ASSERT(NULL != samples[kk]);
+    }
+    uint32_t* order = (uint32_t*) malloc(batch_size * sizeof(uint32_t));
+    ASSERT(NULL != order);
+
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Gaps only occur in queues with several producers
+        hsa_queue_type_t queue_type;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_TYPE, &queue_type);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (HSA_QUEUE_TYPE_MULTI != queue_type) {
+            continue;
+        }
+
+        // Find a memory region in the global segment that supports fine grained memory
+        hsa_region_t global_region;
+        global_region.handle=(uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t)-1 == global_region.handle) {
+            // Skip this agent if it doesn't support fine grained memory
+            continue;
+        }
+
+        // Find a memory region that supports kernel arguments
+        hsa_region_t kernarg_region;
+        kernarg_region.handle = (uint64_t)-1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
+        ASSERT((uint64_t)-1 != kernarg_region.handle);
+
+        // Get the maximum number of queues that is supported on this agent
+        uint32_t queues_max;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUES_MAX, &queues_max);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (queues_max < 1) {
+            continue;
+        }
+
+        uint32_t queue_size = MULTI_GAP_LATENCY_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // Every reservation must fit in the queue at once
+        ASSERT(num_blocks <= queue_size);
+
+        // Create the queue
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], queue_size, HSA_QUEUE_TYPE_MULTI, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__init_int_data_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Allocate memory blocks used by the kernel arg
+        uint32_t** data_blocks = (uint32_t**) malloc(num_blocks * sizeof(uint32_t*));
+        ASSERT(NULL != data_blocks);
+        for (jj = 0; jj < num_blocks; ++jj) {
+            status = hsa_memory_allocate(global_region, MULTI_GAP_LATENCY_DATA_SIZE * sizeof(uint32_t), (void**) &data_blocks[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            memset(data_blocks[jj], 0, MULTI_GAP_LATENCY_DATA_SIZE * sizeof(uint32_t));
+        }
+
+        // The kernarg data structure
+        typedef struct __attribute__ ((aligned(ARGUMENT_ALIGN_BYTES))) queue_multi_gap_arg {
+            void* data;
+            uint32_t value;
+            uint32_t row_pitch;
+            uint32_t slice_pitch;
+        } queue_multi_gap_arg_t;
+        queue_multi_gap_arg_t args;
+
+        // Allocate the kernel argument buffer from the correct region
+        queue_multi_gap_arg_t* kernarg_buffer = NULL;
+        status = hsa_memory_allocate(kernarg_region, num_blocks * sizeof(args), (void**)(&kernarg_buffer));
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Packet N of a reservation writes N + 1 to data block N
+        for (jj = 0; jj < num_blocks; ++jj) {
+            args.data = data_blocks[jj];
+            args.value = jj + 1;
+            args.row_pitch = 0;
+            args.slice_pitch = 0;
+            memcpy(kernarg_buffer + jj, &args, sizeof(queue_multi_gap_arg_t));
+        }
+
+        hsa_signal_t gap_signal, behind_signal;
+        status = hsa_signal_create(1, 0, NULL, &gap_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_signal_create(1, 0, NULL, &behind_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Setup the dispatch packet.
+        hsa_kernel_dispatch_packet_t dispatch_packet;
+        memset(&dispatch_packet, 0, sizeof(hsa_kernel_dispatch_packet_t));
+        dispatch_packet.header |= HSA_PACKET_TYPE_KERNEL_DISPATCH << HSA_PACKET_HEADER_TYPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+        dispatch_packet.header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+        dispatch_packet.header |= 1 << HSA_PACKET_HEADER_BARRIER;
+        dispatch_packet.setup  |= 1 << HSA_KERNEL_DISPATCH_PACKET_SETUP_DIMENSIONS;
+        dispatch_packet.workgroup_size_x = MULTI_GAP_LATENCY_DATA_SIZE;
+        dispatch_packet.workgroup_size_y = 1;
+        dispatch_packet.workgroup_size_z = 1;
+        dispatch_packet.grid_size_x = MULTI_GAP_LATENCY_DATA_SIZE;
+        dispatch_packet.grid_size_y = 1;
+        dispatch_packet.grid_size_z = 1;
+        dispatch_packet.group_segment_size = symbol_record.group_segment_size;
+        dispatch_packet.private_segment_size = symbol_record.private_segment_size;
+        dispatch_packet.kernel_object = symbol_record.kernel_object;
+        dispatch_packet.kernarg_address = 0;
+        dispatch_packet.completion_signal.handle = 0;
+
+        printf("\nAgent %d: queue of %u packets, %u packets behind the gap, stall %lu us, batch of %u packets, publish delay %lu us\n",
+               ii, queue_size, num_behind, (unsigned long) (stall_ns / 1000), batch_size, (unsigned long) (publish_delay_ns / 1000));
+
+        // Mode 0 publishes the first slot last (the gap), mode 1 is the in order baseline
+        int mode;
+        for (mode = 0; mode < 2; ++mode) {
+            for (jj = 0; jj < num_iterations; ++jj) {
+                uint64_t base = hsa_queue_add_write_index_relaxed(queue, num_behind + 1);
+                while (base + num_behind + 1 - hsa_queue_load_read_index_acquire(queue) > queue_size) {}
+
+                hsa_signal_store_relaxed(gap_signal, 1);
+                hsa_signal_store_relaxed(behind_signal, num_behind);
+
+                uint64_t start_ns = 0;
+                if (1 == mode) {
+                    start_ns = perf_get_time_ns();
+                    dispatch_packet.completion_signal = gap_signal;
+                    dispatch_packet.kernarg_address = (void*) kernarg_buffer;
+                    publish_gap_packet(queue, base, &dispatch_packet);
+                }
+
+                uint32_t pp;
+                dispatch_packet.completion_signal = behind_signal;
+                for (pp = 1; pp <= num_behind; ++pp) {
+                    dispatch_packet.kernarg_address = (void*) (kernarg_buffer + pp);
+                    publish_gap_packet(queue, base + pp, &dispatch_packet);
+                }
+                hsa_signal_store_release(queue->doorbell_signal, base + num_behind);
+
+                if (0 == mode) {
+                    // Give the packet processor time to reach the gap
+                    spin_ns(stall_ns);
+                    ASSERT(1 == hsa_signal_load_acquire(gap_signal));
+                    ASSERT(num_behind == hsa_signal_load_acquire(behind_signal));
+
+                    start_ns = perf_get_time_ns();
+                    dispatch_packet.completion_signal = gap_signal;
+                    dispatch_packet.kernarg_address = (void*) kernarg_buffer;
+                    publish_gap_packet(queue, base, &dispatch_packet);
+                    hsa_signal_store_release(queue->doorbell_signal, base);
+                }
+
+                wait_signal_zero(gap_signal);
+                uint64_t gap_ns = perf_get_time_ns();
+                wait_signal_zero(behind_signal);
+                uint64_t behind_ns = perf_get_time_ns();
+
+                verify_gap_data(data_blocks, num_behind + 1);
+
+                samples[0][jj] = (double) (gap_ns - start_ns) * 1e-3;
+                samples[1][jj] = (double) (behind_ns - start_ns) * 1e-3;
+            }
+
+            perf_stats_t stats;
+            perf_compute_stats(samples[0], num_iterations, &stats);
+            perf_print_stats((0 == mode) ? "gap publish to gap completion" : "baseline publish to first completion", "us", &stats);
+            perf_compute_stats(samples[1], num_iterations, &stats);
+            perf_print_stats((0 == mode) ? "gap publish to last completion" : "baseline publish to last completion", "us", &stats);
+        }
+
+        // Publication orders: in order, reverse and shuffled
+        const char* order_names[3] = {"in order", "reverse", "shuffled"};
+        dispatch_packet.completion_signal = behind_signal;
+        srand(1);
+        for (kk = 0; kk < 3; ++kk) {
+            double overlap = 0.0;
+            for (jj = 0; jj < num_iterations; ++jj) {
+                uint32_t pp;
+                for (pp = 0; pp < batch_size; ++pp) {
+                    order[pp] = (1 == kk) ? batch_size - 1 - pp : pp;
+                }
+                if (2 == kk) {
+                    for (pp = batch_size - 1; pp > 0; --pp) {
+                        uint32_t swap = (uint32_t) rand() % (pp + 1);
+                        uint32_t tmp = order[pp];
+                        order[pp] = order[swap];
+                        order[swap] = tmp;
+                    }
+                }
+
+                uint64_t base = hsa_queue_add_write_index_relaxed(queue, batch_size);
+                while (base + batch_size - hsa_queue_load_read_index_acquire(queue) > queue_size) {}
+                hsa_signal_store_relaxed(behind_signal, batch_size);
+
+                uint64_t start_ns = perf_get_time_ns();
+                uint64_t last_publish_ns = start_ns;
+                for (pp = 0; pp < batch_size; ++pp) {
+                    if (0 < pp) {
+                        spin_ns(publish_delay_ns);
+                    }
+                    dispatch_packet.kernarg_address = (void*) (kernarg_buffer + order[pp]);
+                    last_publish_ns = perf_get_time_ns();
+                    publish_gap_packet(queue, base + order[pp], &dispatch_packet);
+                    hsa_signal_store_release(queue->doorbell_signal, base + order[pp]);
+                }
+                overlap += (double) (batch_size - hsa_signal_load_acquire(behind_signal));
+
+                wait_signal_zero(behind_signal);
+                uint64_t end_ns = perf_get_time_ns();
+
+                verify_gap_data(data_blocks, batch_size);
+
+                samples[2][jj] = (double) (end_ns - start_ns) * 1e-3;
+                samples[3][jj] = (double) (end_ns - last_publish_ns) * 1e-3;
+            }
+
+            char label[64];
+            perf_stats_t stats;
+            perf_compute_stats(samples[2], num_iterations, &stats);
+            snprintf(label, sizeof(label), "%s batch time", order_names[kk]);
+            perf_print_stats(label, "us", &stats);
+            perf_compute_stats(samples[3], num_iterations, &stats);
+            snprintf(label, sizeof(label), "%s drain after last publish", order_names[kk]);
+            perf_print_stats(label, "us", &stats);
+            printf("%-40s %.2f of %u packets complete at the last publish\n", order_names[kk],
+                   overlap / num_iterations, batch_size);
+        }
+
+        status = hsa_signal_destroy(gap_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        status = hsa_signal_destroy(behind_signal);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        status = hsa_memory_free(kernarg_buffer);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Free the memory addresses used by kernel arg
+        for (jj = 0; jj < num_blocks; ++jj) {
+            status = hsa_memory_free(data_blocks[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        free(data_blocks);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the queue
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(order);
+    for (kk = 0; kk < 4; ++kk) {
+        free(samples[kk]);
+    }
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    // Shutdown runtime
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_soft_queue_processor
+ * Scope: Conformance
+ *
+ * Purpose: Verifies that a soft queue created with hsa_soft_queue_create
+ * can be serviced by a host packet processor, and that agent dispatch,
+ * barrier bit and barrier packet semantics are preserved end to end.
+ *
+ * Test Description:
+ * 1) Find a CPU agent and a fine grained global memory region
+ * associated with it.
+ * 2) Create a doorbell signal and a soft queue in the region that supports
+ * HSA_QUEUE_FEATURE_AGENT_DISPATCH.
+ * 3) Start a packet processor with several worker threads for the queue.
+ * Register an agent dispatch function that adds its two arguments and
+ * stores the result at the return address, and one that stores the number
+ * of add packets executed so far.
+ * 4) Enqueue several add packets from the host and wait on their shared
+ * completion signal. Verify all of the results.
+ * 5) Enqueue several add packets followed by a count packet with the barrier
+ * bit set. Verify that the count packet observed all of the add packets.
+ * 6) Enqueue a Barrier-AND packet with an unresolved dependency followed by a
+ * count packet. Verify the count packet doesn't execute until the dependency
+ * is resolved.
+ * 7) Repeat step 6 with a Barrier-OR packet with two dependencies, resolving
+ * only one of them.
+ * 8) Stop the processor and verify that all packets were processed.
+ *
+ * Expected Results: All packets should be executed with the correct ordering.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <soft_queue_utils.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOFT_QUEUE_SIZE 64
+#define SOFT_QUEUE_NUM_WORKERS 4
+#define SOFT_QUEUE_NUM_PACKETS 1024
+#define SOFT_QUEUE_TYPE_ADD 1
+#define SOFT_QUEUE_TYPE_COUNT 2
+
+// Agent dispatch function, adds the two arguments
+static void soft_queue_add(hsa_agent_dispatch_packet_t* packet, void* data) {
+    *((uint64_t*) packet->return_address) = packet->arg[0] + packet->arg[1];
+    __atomic_add_fetch((uint64_t*) data, 1, __ATOMIC_RELEASE);
+    return;
+}
+
+// Agent dispatch function, returns the number of add packets executed
+static void soft_queue_count(hsa_agent_dispatch_packet_t* packet, void* data) {
+    *((uint64_t*) packet->return_address) = __atomic_load_n((uint64_t*) data, __ATOMIC_ACQUIRE);
+    return;
+}
+
+// Reserve a packet slot, waiting until it is free
+static void* soft_queue_reserve(hsa_queue_t* queue, uint64_t* write_index) {
+    *write_index = hsa_queue_add_write_index_relaxed(queue, 1);
+    while (*write_index - hsa_queue_load_read_index_acquire(queue) >= queue->size);
+    return &((hsa_agent_dispatch_packet_t*)(queue->base_address))[*write_index & (queue->size - 1)];
+}
+
+// Publish a packet header and ring the doorbell
+static void soft_queue_publish(hsa_queue_t* queue, uint64_t write_index, void* packet, uint16_t header) {
+    __atomic_store_n((uint16_t*) packet, header, __ATOMIC_RELEASE);
+    hsa_signal_store_release(queue->doorbell_signal, write_index);
+    return;
+}
+
+static void enqueue_agent_dispatch(hsa_queue_t* queue, uint16_t type, uint64_t arg0, uint64_t arg1,
+                                   void* return_address, int barrier, hsa_signal_t completion_signal) {
+    uint64_t write_index;
+    hsa_agent_dispatch_packet_t* packet = (hsa_agent_dispatch_packet_t*) soft_queue_reserve(queue, &write_index);
+    memset(((uint8_t*) packet) + sizeof(packet->header), 0, sizeof(hsa_agent_dispatch_packet_t) - sizeof(packet->header));
+    packet->type = type;
+    packet->arg[0] = arg0;
+    packet->arg[1] = arg1;
+    packet->return_address = return_address;
+    packet->completion_signal = completion_signal;
+
+    uint16_t header = 0;
+    header |= HSA_PACKET_TYPE_AGENT_DISPATCH << HSA_PACKET_HEADER_TYPE;
+    header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+    header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+    header |= (barrier ? 1 : 0) << HSA_PACKET_HEADER_BARRIER;
+    soft_queue_publish(queue, write_index, packet, header);
+    return;
+}
+
+static void enqueue_barrier(hsa_queue_t* queue, hsa_packet_type_t type, hsa_signal_t* dep_signals,
+                            int num_dep_signals, hsa_signal_t completion_signal) {
+    uint64_t write_index;
+    hsa_barrier_and_packet_t* packet = (hsa_barrier_and_packet_t*) soft_queue_reserve(queue, &write_index);
+    memset(((uint8_t*) packet) + sizeof(packet->header), 0, sizeof(hsa_barrier_and_packet_t) - sizeof(packet->header));
+    int ii;
+    for (ii = 0; ii < num_dep_signals; ++ii) {
+        packet->dep_signal[ii] = dep_signals[ii];
+    }
+    packet->completion_signal = completion_signal;
+
+    uint16_t header = 0;
+    header |= type << HSA_PACKET_HEADER_TYPE;
+    header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+    soft_queue_publish(queue, write_index, packet, header);
+    return;
+}
+
+int test_queue_soft_queue_processor() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Find a CPU agent
+    hsa_agent_t agent;
+    agent.handle = (uint64_t)-1;
+    hsa_iterate_agents(get_cpu_agent, &agent);
+    ASSERT((uint64_t)-1 != agent.handle);
+
+    // Find a fine grained region for the soft queue
+    hsa_region_t region;
+    region.handle = (uint64_t)-1;
+    hsa_agent_iterate_regions(agent, get_global_memory_region_fine_grained, &region);
+    ASSERT((uint64_t)-1 != region.handle);
+
+    // Create the soft queue
+    hsa_signal_t doorbell_signal;
+    status = hsa_signal_create(0, 0, NULL, &doorbell_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_queue_t* queue;
+    status = hsa_soft_queue_create(region, SOFT_QUEUE_SIZE, HSA_QUEUE_TYPE_MULTI,
+                                   HSA_QUEUE_FEATURE_AGENT_DISPATCH, doorbell_signal, &queue);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Create and start the packet processor
+    uint64_t add_count = 0;
+    soft_queue_processor_t* processor = soft_queue_processor_create(queue, SOFT_QUEUE_NUM_WORKERS, HSA_WAIT_STATE_BLOCKED);
+    ASSERT(NULL != processor);
+    ASSERT(0 == soft_queue_processor_register(processor, SOFT_QUEUE_TYPE_ADD, soft_queue_add, &add_count));
+    ASSERT(0 == soft_queue_processor_register(processor, SOFT_QUEUE_TYPE_COUNT, soft_queue_count, &add_count));
+    ASSERT(0 != soft_queue_processor_register(processor, SOFT_QUEUE_DISPATCH_TABLE_SIZE, soft_queue_add, NULL));
+    soft_queue_processor_start(processor);
+
+    // Create the signals
+    hsa_signal_t signals[4];
+    int ii;
+    for (ii = 0; ii < 4; ++ii) {
+        status = hsa_signal_create(1, 0, NULL, &signals[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+    hsa_signal_t no_signal;
+    no_signal.handle = 0;
+
+    uint64_t* results = (uint64_t*) malloc(SOFT_QUEUE_NUM_PACKETS * sizeof(uint64_t));
+    ASSERT(NULL != results);
+    memset(results, 0, SOFT_QUEUE_NUM_PACKETS * sizeof(uint64_t));
+    uint64_t count_result = 0;
+    uint64_t expected_packets = 0;
+
+    // Execute the add packets, which share a completion signal
+    hsa_signal_store_relaxed(signals[0], SOFT_QUEUE_NUM_PACKETS);
+    for (ii = 0; ii < SOFT_QUEUE_NUM_PACKETS; ++ii) {
+        enqueue_agent_dispatch(queue, SOFT_QUEUE_TYPE_ADD, ii, 2 * ii, &results[ii], 0, signals[0]);
+    }
+    expected_packets += SOFT_QUEUE_NUM_PACKETS;
+    while (0 != hsa_signal_wait_acquire(signals[0], HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED));
+    for (ii = 0; ii < SOFT_QUEUE_NUM_PACKETS; ++ii) {
+        ASSERT(3 * (uint64_t) ii == results[ii]);
+    }
+
+    // A packet with the barrier bit set observes all previous packets
+    for (ii = 0; ii < SOFT_QUEUE_NUM_PACKETS; ++ii) {
+        enqueue_agent_dispatch(queue, SOFT_QUEUE_TYPE_ADD, ii, 0, &results[ii], 0, no_signal);
+    }
+    hsa_signal_store_relaxed(signals[0], 1);
+    enqueue_agent_dispatch(queue, SOFT_QUEUE_TYPE_COUNT, 0, 0, &count_result, 1, signals[0]);
+    expected_packets += SOFT_QUEUE_NUM_PACKETS + 1;
+    while (0 != hsa_signal_wait_acquire(signals[0], HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED));
+    ASSERT(2 * SOFT_QUEUE_NUM_PACKETS == count_result);
+
+    // Barrier-AND and Barrier-OR packets block the queue until resolved
+    hsa_packet_type_t barrier_types[2] = {HSA_PACKET_TYPE_BARRIER_AND, HSA_PACKET_TYPE_BARRIER_OR};
+    int tt;
+    for (tt = 0; tt < 2; ++tt) {
+        for (ii = 0; ii < 4; ++ii) {
+            hsa_signal_store_relaxed(signals[ii], 1);
+        }
+
+        int num_deps = (HSA_PACKET_TYPE_BARRIER_AND == barrier_types[tt]) ? 1 : 2;
+        enqueue_barrier(queue, barrier_types[tt], &signals[0], num_deps, signals[2]);
+        enqueue_agent_dispatch(queue, SOFT_QUEUE_TYPE_COUNT, 0, 0, &count_result, 0, signals[3]);
+        expected_packets += 2;
+
+        // Give the processor a chance to (incorrectly) run past the barrier
+        hsa_signal_wait_acquire(signals[3], HSA_SIGNAL_CONDITION_EQ, 0, 1000000, HSA_WAIT_STATE_BLOCKED);
+        ASSERT(1 == hsa_signal_load_acquire(signals[2]));
+        ASSERT(1 == hsa_signal_load_acquire(signals[3]));
+
+        // Resolve the last dependency
+        hsa_signal_store_release(signals[num_deps - 1], 0);
+        while (0 != hsa_signal_wait_acquire(signals[3], HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED));
+        ASSERT(0 == hsa_signal_load_acquire(signals[2]));
+    }
+
+    // Stop the processor, all packets should have been processed
+    status = soft_queue_processor_stop(processor);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    ASSERT(expected_packets == processor->packets_processed);
+    ASSERT(expected_packets == hsa_queue_load_read_index_acquire(queue));
+    soft_queue_processor_destroy(processor);
+
+    free(results);
+
+    for (ii = 0; ii < 4; ++ii) {
+        status = hsa_signal_destroy(signals[ii]);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    // Destroy the soft queue and the doorbell signal
+    status = hsa_queue_destroy(queue);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_signal_destroy(doorbell_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_soft_queue_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the end to end throughput of the queue protocol
+ * (write index reservation, packet publication, doorbell, read index and
+ * completion signal updates) without a GPU, using a host packet processor
+ * servicing a soft queue.
+ *
+ * Test Description:
+ * 1) Find a CPU agent and a fine grained global memory region associated with it.
+ * 2) Measure the single thread throughput of the primitives used by the
+ * protocol: hsa_queue_add_write_index_relaxed, hsa_signal_store_release
+ * and hsa_signal_subtract_release.
+ * 3) For 1 producer thread and powers of two up to
+ * SOFT_QUEUE_PERF_MAX_PRODUCERS producer threads, finishing at the maximum,
+ * and for 0, 1, 2, 4 and 8 processor worker threads:
+ *    a) Create a soft queue of SOFT_QUEUE_PERF_QUEUE_SIZE packets and a packet
+ *    processor with the worker threads.
+ *    b) Each producer enqueues SOFT_QUEUE_PERF_NUM_PACKETS empty agent
+ *    dispatch packets, sharing one completion signal.
+ *    c) Time the enqueue of the packets until the completion signal reaches 0.
+ * 4) Report the packets per second for each configuration.
+ *
+ * Expected Results: All packets should be processed.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <soft_queue_utils.h>
+#include <stdio.h>
+#include <string.h>
+
+#define SOFT_QUEUE_PERF_QUEUE_SIZE 256
+#define SOFT_QUEUE_PERF_NUM_PACKETS 100000
+#define SOFT_QUEUE_PERF_MAX_PRODUCERS 4
+#define SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS 1000000
+#define SOFT_QUEUE_PERF_TYPE_EMPTY 0
+
+typedef struct soft_queue_producer_s {
+    hsa_queue_t* queue;
+    hsa_signal_t completion_signal;
+    uint32_t num_packets;
+} soft_queue_producer_t;
+
+// Agent dispatch function that does nothing
+static void soft_queue_empty(hsa_agent_dispatch_packet_t* packet, void* data) {
+    return;
+}
+
+// Work function for the producer threads
+void thread_proc_soft_queue_producer(void* data) {
+    soft_queue_producer_t* producer = (soft_queue_producer_t*) data;
+    hsa_queue_t* queue = producer->queue;
+    const uint32_t queue_mask = queue->size - 1;
+
+    uint16_t header = 0;
+    header |= HSA_PACKET_TYPE_AGENT_DISPATCH << HSA_PACKET_HEADER_TYPE;
+    header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE;
+    header |= HSA_FENCE_SCOPE_SYSTEM << HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE;
+
+    uint32_t ii;
+    for (ii = 0; ii < producer->num_packets; ++ii) {
+        uint64_t write_index = hsa_queue_add_write_index_relaxed(queue, 1);
+        while (write_index - hsa_queue_load_read_index_acquire(queue) >= queue->size);
+
+        hsa_agent_dispatch_packet_t* packet = &((hsa_agent_dispatch_packet_t*)(queue->base_address))[write_index & queue_mask];
+        memset(((uint8_t*) packet) + sizeof(packet->header), 0, sizeof(hsa_agent_dispatch_packet_t) - sizeof(packet->header));
+        packet->type = SOFT_QUEUE_PERF_TYPE_EMPTY;
+        packet->completion_signal = producer->completion_signal;
+
+        __atomic_store_n(&packet->header, header, __ATOMIC_RELEASE);
+        hsa_signal_store_release(queue->doorbell_signal, write_index);
+    }
+
+    return;
+}
+
+int test_queue_soft_queue_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Find a CPU agent
+    hsa_agent_t agent;
+    agent.handle = (uint64_t)-1;
+    hsa_iterate_agents(get_cpu_agent, &agent);
+    ASSERT((uint64_t)-1 != agent.handle);
+
+    // Find a fine grained region for the soft queue
+    hsa_region_t region;
+    region.handle = (uint64_t)-1;
+    hsa_agent_iterate_regions(agent, get_global_memory_region_fine_grained, &region);
+    ASSERT((uint64_t)-1 != region.handle);
+
+    uint32_t num_packets = (uint32_t) perf_get_env_uint("SOFT_QUEUE_PERF_NUM_PACKETS", SOFT_QUEUE_PERF_NUM_PACKETS);
+    uint32_t max_producers = (uint32_t) perf_get_env_uint("SOFT_QUEUE_PERF_MAX_PRODUCERS", SOFT_QUEUE_PERF_MAX_PRODUCERS);
+    ASSERT(0 < num_packets && 0 < max_producers);
+
+    hsa_signal_t doorbell_signal;
+    status = hsa_signal_create(0, 0, NULL, &doorbell_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_signal_t completion_signal;
+    status = hsa_signal_create(0, 0, NULL, &completion_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Measure the primitives on an idle queue
+    hsa_queue_t* queue;
+    status = hsa_soft_queue_create(region, SOFT_QUEUE_PERF_QUEUE_SIZE, HSA_QUEUE_TYPE_MULTI,
+                                   HSA_QUEUE_FEATURE_AGENT_DISPATCH, doorbell_signal, &queue);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    int ii;
+    uint64_t start_ns = perf_get_time_ns();
+    for (ii = 0; ii < SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS; ++ii) {
+        hsa_queue_add_write_index_relaxed(queue, 1);
+    }
+    double add_ns = (double) (perf_get_time_ns() - start_ns) / SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS;
+
+    start_ns = perf_get_time_ns();
+    for (ii = 0; ii < SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS; ++ii) {
+        hsa_signal_store_release(completion_signal, ii);
+    }
+    double store_ns = (double) (perf_get_time_ns() - start_ns) / SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS;
+
+    start_ns = perf_get_time_ns();
+    for (ii = 0; ii < SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS; ++ii) {
+        hsa_signal_subtract_release(completion_signal, 1);
+    }
+    double subtract_ns = (double) (perf_get_time_ns() - start_ns) / SOFT_QUEUE_PERF_PRIMITIVE_ITERATIONS;
+
+    status = hsa_queue_destroy(queue);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    printf("\nhsa_queue_add_write_index_relaxed %.1f ns, hsa_signal_store_release %.1f ns, hsa_signal_subtract_release %.1f ns\n",
+           add_ns, store_ns, subtract_ns);
+
+    const uint32_t worker_counts[5] = {0, 1, 2, 4, 8};
+    soft_queue_producer_t producers[max_producers];
+
+    uint32_t num_producers = 1;
+    while (num_producers <= max_producers) {
+        int ww;
+        for (ww = 0; ww < 5; ++ww) {
+            hsa_signal_store_relaxed(doorbell_signal, 0);
+            status = hsa_soft_queue_create(region, SOFT_QUEUE_PERF_QUEUE_SIZE, HSA_QUEUE_TYPE_MULTI,
+                                           HSA_QUEUE_FEATURE_AGENT_DISPATCH, doorbell_signal, &queue);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+
+            soft_queue_processor_t* processor = soft_queue_processor_create(queue, worker_counts[ww], HSA_WAIT_STATE_ACTIVE);
+            ASSERT(NULL != processor);
+            ASSERT(0 == soft_queue_processor_register(processor, SOFT_QUEUE_PERF_TYPE_EMPTY, soft_queue_empty, NULL));
+            soft_queue_processor_start(processor);
+
+            hsa_signal_store_relaxed(completion_signal, (hsa_signal_value_t) num_producers * num_packets);
+
+            struct test_group* tg_producers = test_group_create(num_producers);
+            for (ii = 0; ii < num_producers; ++ii) {
+                producers[ii].queue = queue;
+                producers[ii].completion_signal = completion_signal;
+                producers[ii].num_packets = num_packets;
+                test_group_add(tg_producers, &thread_proc_soft_queue_producer, &producers[ii], 1);
+            }
+            test_group_thread_create(tg_producers);
+
+            start_ns = perf_get_time_ns();
+            test_group_start(tg_producers);
+            test_group_wait(tg_producers);
+            while (0 != hsa_signal_wait_acquire(completion_signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_ACTIVE));
+            double elapsed_s = (double) (perf_get_time_ns() - start_ns) * 1e-9;
+
+            test_group_exit(tg_producers);
+            test_group_destroy(tg_producers);
+
+            status = soft_queue_processor_stop(processor);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            ASSERT((uint64_t) num_producers * num_packets == processor->packets_processed);
+
+            printf("%u producers %u workers: %10.0f packets/s, %llu doorbell waits\n",
+                   num_producers, worker_counts[ww],
+                   (double) num_producers * num_packets / elapsed_s,
+                   (unsigned long long) processor->doorbell_waits);
+
+            soft_queue_processor_destroy(processor);
+
+            status = hsa_queue_destroy(queue);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        // Step through powers of two, finishing at the maximum
+        if (num_producers == max_producers) {
+            break;
+        }
+        num_producers = (num_producers * 2 < max_producers) ? num_producers * 2 : max_producers;
+    }
+
+    status = hsa_signal_destroy(completion_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_signal_destroy(doorbell_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: queue_write_index_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the throughput of the queue write index APIs under
+ * multi-producer contention, for every memory ordering variant, and reports
+ * how often compare and swap based packet slot reservation has to retry.
+ *
+ * Test Description:
+ * 1) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH, create a
+ * queue. If the agent supports HSA_QUEUE_TYPE_MULTI the queue is a multi
+ * producer queue, otherwise only a single thread is used.
+ * 2) For each of the hsa_queue_add_write_index, hsa_queue_cas_write_index,
+ * hsa_queue_load_write_index and hsa_queue_store_write_index variants, and
+ * for 1, 2, 4, ... up to WRITE_INDEX_MAX_THREADS threads:
+ *    a) Create the threads, pinning thread N to CPU N modulo the number of
+ *    online CPUs.
+ *    b) Each thread performs WRITE_INDEX_OPS_PER_THREAD operations. The
+ *    compare and swap threads reserve one slot per operation, retrying with
+ *    the observed value until the swap succeeds.
+ *    c) Verify that the add and compare and swap operations advanced the
+ *    write index by exactly the total number of operations.
+ *    d) Restore the write index to 0.
+ * 3) Report the aggregate operations per second, the mean per thread latency,
+ * and for compare and swap the failure rate, the mean number of retries per
+ * reservation and the worst number of retries of a single reservation.
+ *
+ * Expected Results: The write index should be advanced by exactly the number
+ * of reservations made.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define WRITE_INDEX_QUEUE_SIZE 1024
+#define WRITE_INDEX_MAX_THREADS 64
+#define WRITE_INDEX_OPS_PER_THREAD 1024*1024
+
+typedef enum write_index_op_kind_e {
+    WRITE_INDEX_OP_ADD,
+    WRITE_INDEX_OP_CAS,
+    WRITE_INDEX_OP_LOAD,
+    WRITE_INDEX_OP_STORE
+} write_index_op_kind_t;
+
+typedef struct write_index_op_s {
+    const char* name;
+    write_index_op_kind_t kind;
+    uint64_t (*add)(const hsa_queue_t* queue, uint64_t value);
+    uint64_t (*cas)(const hsa_queue_t* queue, uint64_t expected, uint64_t value);
+    uint64_t (*load)(const hsa_queue_t* queue);
+    void (*store)(const hsa_queue_t* queue, uint64_t value);
+} write_index_op_t;
+
+static const write_index_op_t write_index_ops[] = {
+    {"add_acq_rel", WRITE_INDEX_OP_ADD, hsa_queue_add_write_index_acq_rel, NULL, NULL, NULL},
+    {"add_acquire", WRITE_INDEX_OP_ADD, hsa_queue_add_write_index_acquire, NULL, NULL, NULL},
+    {"add_relaxed", WRITE_INDEX_OP_ADD, hsa_queue_add_write_index_relaxed, NULL, NULL, NULL},
+    {"add_release", WRITE_INDEX_OP_ADD, hsa_queue_add_write_index_release, NULL, NULL, NULL},
+    {"cas_acq_rel", WRITE_INDEX_OP_CAS, NULL, hsa_queue_cas_write_index_acq_rel, NULL, NULL},
+    {"cas_acquire", WRITE_INDEX_OP_CAS, NULL, hsa_queue_cas_write_index_acquire, NULL, NULL},
+    {"cas_relaxed", WRITE_INDEX_OP_CAS, NULL, hsa_queue_cas_write_index_relaxed, NULL, NULL},
+    {"cas_release", WRITE_INDEX_OP_CAS, NULL, hsa_queue_cas_write_index_release, NULL, NULL},
+    {"load_acquire", WRITE_INDEX_OP_LOAD, NULL, NULL, hsa_queue_load_write_index_acquire, NULL},
+    {"load_relaxed", WRITE_INDEX_OP_LOAD, NULL, NULL, hsa_queue_load_write_index_relaxed, NULL},
+    {"store_relaxed", WRITE_INDEX_OP_STORE, NULL, NULL, NULL, hsa_queue_store_write_index_relaxed},
+    {"store_release", WRITE_INDEX_OP_STORE, NULL, NULL, NULL, hsa_queue_store_write_index_release}
+};
+
+#define WRITE_INDEX_NUM_OPS (sizeof(write_index_ops) / sizeof(write_index_ops[0]))
+
+typedef struct write_index_thread_s {
+    hsa_queue_t* queue;
+    const write_index_op_t* op;
+    uint64_t num_ops;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint64_t cas_failures;
+    uint64_t cas_max_retries;
+    uint64_t sink;
+} write_index_thread_t;
+
+// Work function for the write index threads
+void thread_proc_write_index_throughput(void* data) {
+    write_index_thread_t* thread = (write_index_thread_t*) data;
+    const write_index_op_t* op = thread->op;
+    hsa_queue_t* queue = thread->queue;
+    uint64_t sink = 0;
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint64_t ii;
+    switch (op->kind) {
+    case WRITE_INDEX_OP_ADD:
+        for (ii = 0; ii < thread->num_ops; ++ii) {
+            sink += op->add(queue, 1);
+        }
+        break;
+    case WRITE_INDEX_OP_CAS: {
+        uint64_t expected = hsa_queue_load_write_index_relaxed(queue);
+        for (ii = 0; ii < thread->num_ops; ++ii) {
+            uint64_t retries = 0;
+            uint64_t observed;
+            while (expected != (observed = op->cas(queue, expected, expected + 1))) {
+                expected = observed;
+                ++retries;
+            }
+            ++expected;
+            thread->cas_failures += retries;
+            if (retries > thread->cas_max_retries) {
+                thread->cas_max_retries = retries;
+            }
+        }
+        break;
+    }
+    case WRITE_INDEX_OP_LOAD:
+        for (ii = 0; ii < thread->num_ops; ++ii) {
+            sink += op->load(queue);
+        }
+        break;
+    case WRITE_INDEX_OP_STORE:
+        for (ii = 0; ii < thread->num_ops; ++ii) {
+            op->store(queue, ii);
+        }
+        break;
+    }
+
+    thread->end_ns = perf_get_time_ns();
+    thread->sink = sink;
+
+    return;
+}
+
+int test_queue_write_index_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus < 1) {
+        num_cpus = 1;
+    }
+
+    uint32_t max_threads = (uint32_t) perf_get_env_uint("WRITE_INDEX_MAX_THREADS",
+            (num_cpus < WRITE_INDEX_MAX_THREADS) ? (uint64_t) num_cpus : WRITE_INDEX_MAX_THREADS);
+    uint64_t num_ops = perf_get_env_uint("WRITE_INDEX_OPS_PER_THREAD", WRITE_INDEX_OPS_PER_THREAD);
+    ASSERT(0 < max_threads && 0 < num_ops);
+
+    write_index_thread_t* threads = (write_index_thread_t*) malloc(max_threads * sizeof(write_index_thread_t));
+    double* samples = (double*) malloc(max_threads * sizeof(double));
+    ASSERT(NULL != threads && NULL != samples);
+
+    int ii, jj;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        uint32_t queue_max;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUES_MAX, &queue_max);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (queue_max < 1) {
+            continue;
+        }
+
+        // Several producers are only allowed on a multi producer queue
+        hsa_queue_type_t queue_type;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_TYPE, &queue_type);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        uint32_t agent_max_threads = (HSA_QUEUE_TYPE_MULTI == queue_type) ? max_threads : 1;
+
+        uint32_t queue_size = WRITE_INDEX_QUEUE_SIZE;
+        uint32_t queue_max_size;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_QUEUE_MAX_SIZE, &queue_max_size);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        while (queue_size > queue_max_size) {
+            queue_size /= 2;
+        }
+
+        // The doorbell is never rung, so the packet processor never consumes
+        // the slots that are reserved by the threads.
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], queue_size, queue_type, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        printf("\nAgent %d: %s queue, up to %u threads on %ld cpus, %lu operations per thread\n",
+               ii, (HSA_QUEUE_TYPE_MULTI == queue_type) ? "multi" : "single",
+               agent_max_threads, num_cpus, (unsigned long) num_ops);
+
+        int kk;
+        for (kk = 0; kk < WRITE_INDEX_NUM_OPS; ++kk) {
+            const write_index_op_t* op = &write_index_ops[kk];
+
+            uint32_t num_threads = 1;
+            while (num_threads <= agent_max_threads) {
+                hsa_queue_store_write_index_release(queue, 0);
+
+                struct test_group* tg_write_index = test_group_create(num_threads);
+                for (jj = 0; jj < num_threads; ++jj) {
+                    write_index_thread_t* thread = &threads[jj];
+                    memset(thread, 0, sizeof(write_index_thread_t));
+                    thread->queue = queue;
+                    thread->op = op;
+                    thread->num_ops = num_ops;
+                    test_group_add(tg_write_index, &thread_proc_write_index_throughput, thread, 1);
+                }
+                test_group_thread_create(tg_write_index);
+                for (jj = 0; jj < num_threads; ++jj) {
+                    test_group_thread_affinity(tg_write_index, jj, jj % num_cpus);
+                }
+                test_group_start(tg_write_index);
+                test_group_wait(tg_write_index);
+                test_group_exit(tg_write_index);
+                test_group_destroy(tg_write_index);
+
+                // Every reservation must have advanced the write index exactly once
+                if (WRITE_INDEX_OP_ADD == op->kind || WRITE_INDEX_OP_CAS == op->kind) {
+                    ASSERT((uint64_t) num_threads * num_ops == hsa_queue_load_write_index_relaxed(queue));
+                }
+
+                uint64_t first_start = UINT64_MAX, last_end = 0;
+                uint64_t cas_failures = 0, cas_max_retries = 0;
+                for (jj = 0; jj < num_threads; ++jj) {
+                    first_start = (threads[jj].start_ns < first_start) ? threads[jj].start_ns : first_start;
+                    last_end = (threads[jj].end_ns > last_end) ? threads[jj].end_ns : last_end;
+                    cas_failures += threads[jj].cas_failures;
+                    cas_max_retries = (threads[jj].cas_max_retries > cas_max_retries) ? threads[jj].cas_max_retries : cas_max_retries;
+                    samples[jj] = (double) (threads[jj].end_ns - threads[jj].start_ns) / (double) num_ops;
+                }
+
+                perf_stats_t stats;
+                perf_compute_stats(samples, num_threads, &stats);
+                double total_ops = (double) num_threads * (double) num_ops;
+                double elapsed_s = (double) (last_end - first_start) * 1e-9;
+                printf("%-13s %3u threads: %12.0f ops/s, %8.2f ns/op per thread (max %.2f)",
+                       op->name, num_threads, total_ops / elapsed_s, stats.mean, stats.max);
+                if (WRITE_INDEX_OP_CAS == op->kind) {
+                    printf(", cas failure rate %.2f%%, %.3f retries per reservation (max %lu)",
+                           100.0 * (double) cas_failures / (total_ops + (double) cas_failures),
+                           (double) cas_failures / total_ops,
+                           (unsigned long) cas_max_retries);
+                }
+                printf("\n");
+
+                // Step through powers of two, finishing at the thread maximum
+                if (num_threads == agent_max_threads) {
+                    break;
+                }
+                num_threads = (num_threads * 2 < agent_max_threads) ? num_threads * 2 : agent_max_threads;
+            }
+        }
+
+        // Restore the write_index of the queue
+        hsa_queue_store_write_index_release(queue, 0);
+
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(samples);
+    free(threads);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -135,6 +135,7 @@ DEFINE_TEST(signal_xor_atomic_acq_rel);
 DEFINE_TEST(signal_xor_atomic_acquire);
 DEFINE_TEST(signal_xor_atomic_release);
 DEFINE_TEST(signal_xor_atomic_relaxed);
+DEFINE_TEST(signal_pool_dispatch);
 
 int main(int argc, char* argv[]) {
     INITIALIZE_TESTSUITE();
@@ -227,5 +228,6 @@ int main(int argc, char* argv[]) {
     ADD_TEST(signal_xor_atomic_acquire);
     ADD_TEST(signal_xor_atomic_release);
     ADD_TEST(signal_xor_atomic_relaxed);
+    ADD_TEST(signal_pool_dispatch);
     RUN_TESTS();
 }
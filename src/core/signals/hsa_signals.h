@@ -134,4 +134,5 @@ extern int test_signal_xor_atomic_acq_rel();
 extern int test_signal_xor_atomic_acquire();
 extern int test_signal_xor_atomic_release();
 extern int test_signal_xor_atomic_relaxed();
+extern int test_signal_pool_dispatch();
 #endif  // _HSA_SIGNALS_H_
@@ -0,0 +1,353 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+/*
+ * Test Name: signal_pool_dispatch
+ * Scope: Performance
+ *
+ * Purpose: Measures the cost of getting a completion signal from the signal
+ * pool of signal_pool_utils compared to creating and destroying one, both
+ * on its own over several threads and as part of a dispatch loop.
+ *
+ * Test Description:
+ * 1) For 1, 2, 4, ... up to SIGNAL_POOL_MAX_THREADS threads, and for both
+ * the create/destroy and the pool mode:
+ *    a) Each thread performs SIGNAL_POOL_ITERATIONS iterations, each getting
+ *    SIGNAL_POOL_IN_FLIGHT signals initialized to a value unique to the
+ *    thread and the signal, checking the values and giving the signals back.
+ *    b) In the pool mode the pool is created with enough signals for every
+ *    thread's signals in flight and cache.
+ * 2) For each agent that supports HSA_AGENT_FEATURE_KERNEL_DISPATCH,
+ * dispatch the no_op kernel SIGNAL_POOL_DISPATCHES times with
+ * dispatch_kernel_1d_data and with dispatch_kernel_1d_data_pooled.
+ * 3) Report the latency statistics of each mode, and the pool counters
+ * including the high-water mark.
+ *
+ * Expected Results: Every signal should be handed out to a single user at
+ * a time, with the requested initial value, and the pool should never be
+ * exhausted.
+ */
+
+#include <hsa.h>
+#include <agent_utils.h>
+#include <concurrent_utils.h>
+#include <dispatch_utils.h>
+#include <finalize_utils.h>
+#include <framework.h>
+#include <perf_utils.h>
+#include <signal_pool_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIGNAL_POOL_MAX_THREADS 16
+#define SIGNAL_POOL_ITERATIONS 10000
+#define SIGNAL_POOL_IN_FLIGHT 4
+#define SIGNAL_POOL_DISPATCHES 1000
+
+typedef struct signal_pool_thread_s {
+    signal_pool_t* pool;
+    uint32_t thread_id;
+    uint64_t num_iterations;
+    double* samples;
+    uint64_t start_ns;
+    uint64_t end_ns;
+    uint64_t failures;
+    uint64_t errors;
+} signal_pool_thread_t;
+
+// Work function of the signal threads, a NULL pool creates and destroys the signals
+void thread_proc_signal_pool(void* data) {
+    signal_pool_thread_t* thread = (signal_pool_thread_t*) data;
+    hsa_signal_t signals[SIGNAL_POOL_IN_FLIGHT];
+    int held[SIGNAL_POOL_IN_FLIGHT];
+
+    thread->start_ns = perf_get_time_ns();
+
+    uint64_t ii;
+    int jj;
+    for (ii = 0; ii < thread->num_iterations; ++ii) {
+        uint64_t start = perf_get_time_ns();
+        for (jj = 0; jj < SIGNAL_POOL_IN_FLIGHT; ++jj) {
+            hsa_signal_value_t value = (hsa_signal_value_t) thread->thread_id * SIGNAL_POOL_IN_FLIGHT + jj + 1;
+            hsa_status_t status;
+            if (NULL != thread->pool) {
+                status = signal_pool_acquire(thread->pool, value, &signals[jj]);
+            } else {
+                status = hsa_signal_create(value, 0, NULL, &signals[jj]);
+            }
+            held[jj] = (HSA_STATUS_SUCCESS == status);
+            thread->failures += !held[jj];
+        }
+        uint64_t elapsed = perf_get_time_ns() - start;
+
+        // A signal handed out twice would have been reset by the other user
+        for (jj = 0; jj < SIGNAL_POOL_IN_FLIGHT; ++jj) {
+            hsa_signal_value_t value = (hsa_signal_value_t) thread->thread_id * SIGNAL_POOL_IN_FLIGHT + jj + 1;
+            if (held[jj] && value != hsa_signal_load_relaxed(signals[jj])) {
+                ++thread->errors;
+            }
+        }
+
+        start = perf_get_time_ns();
+        for (jj = 0; jj < SIGNAL_POOL_IN_FLIGHT; ++jj) {
+            if (!held[jj]) {
+                continue;
+            }
+            if (NULL != thread->pool) {
+                signal_pool_release(thread->pool, signals[jj]);
+            } else {
+                hsa_signal_destroy(signals[jj]);
+            }
+        }
+        elapsed += perf_get_time_ns() - start;
+        thread->samples[ii] = (double) elapsed / SIGNAL_POOL_IN_FLIGHT;
+    }
+
+    thread->end_ns = perf_get_time_ns();
+
+    return;
+}
+
+static void print_pool_counters(signal_pool_t* pool) {
+    signal_pool_counters_t counters;
+    signal_pool_get_counters(pool, &counters);
+    printf("%-40s %lu acquisitions, %lu cache hits, %lu refills, %lu flushes, %lu exhausted, high-water %lu\n", "",
+           (unsigned long) counters.acquisitions, (unsigned long) counters.cache_hits,
+           (unsigned long) counters.cache_refills, (unsigned long) counters.cache_flushes,
+           (unsigned long) counters.exhausted, (unsigned long) counters.high_water);
+    ASSERT(0 == counters.exhausted);
+    ASSERT(0 == counters.in_use);
+    return;
+}
+
+int test_signal_pool_dispatch() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Load the BRIG module
+    hsa_ext_module_t module;
+    ASSERT(0 == load_module_from_file("no_op.brig", &module));
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    long num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_cpus < 1) {
+        num_cpus = 1;
+    }
+
+    uint32_t max_threads = (uint32_t) perf_get_env_uint("SIGNAL_POOL_MAX_THREADS",
+            (num_cpus < SIGNAL_POOL_MAX_THREADS) ? (uint64_t) num_cpus : SIGNAL_POOL_MAX_THREADS);
+    uint64_t num_iterations = perf_get_env_uint("SIGNAL_POOL_ITERATIONS", SIGNAL_POOL_ITERATIONS);
+    uint64_t num_dispatches = perf_get_env_uint("SIGNAL_POOL_DISPATCHES", SIGNAL_POOL_DISPATCHES);
+    ASSERT(0 < max_threads && 0 < num_iterations && 0 < num_dispatches);
+
+    signal_pool_thread_t* threads = (signal_pool_thread_t*) malloc(max_threads * sizeof(signal_pool_thread_t));
+    uint64_t num_samples = (max_threads * num_iterations > num_dispatches) ? max_threads * num_iterations : num_dispatches;
+    double* samples = (double*) malloc(num_samples * sizeof(double));
+    ASSERT(NULL != threads && NULL != samples);
+
+    printf("\nSignals: %d in flight per thread, %lu iterations per thread\n",
+           SIGNAL_POOL_IN_FLIGHT, (unsigned long) num_iterations);
+
+    // Mode 0 creates and destroys the signals, mode 1 uses the pool
+    int ii, jj, mm;
+    for (mm = 0; mm < 2; ++mm) {
+        uint32_t num_threads = 1;
+        while (num_threads <= max_threads) {
+            signal_pool_t* pool = NULL;
+            if (1 == mm) {
+                pool = signal_pool_create(num_threads * (SIGNAL_POOL_IN_FLIGHT + SIGNAL_POOL_CACHE_SIZE));
+                ASSERT(NULL != pool);
+            }
+
+            struct test_group* tg_signal = test_group_create(num_threads);
+            for (jj = 0; jj < num_threads; ++jj) {
+                signal_pool_thread_t* thread = &threads[jj];
+                memset(thread, 0, sizeof(signal_pool_thread_t));
+                thread->pool = pool;
+                thread->thread_id = jj;
+                thread->num_iterations = num_iterations;
+                thread->samples = &samples[jj * num_iterations];
+                test_group_add(tg_signal, &thread_proc_signal_pool, thread, 1);
+            }
+            test_group_thread_create(tg_signal);
+            for (jj = 0; jj < num_threads; ++jj) {
+                test_group_thread_affinity(tg_signal, jj, jj % num_cpus);
+            }
+            test_group_start(tg_signal);
+            test_group_wait(tg_signal);
+            // The exiting threads return their caches to the pool
+            test_group_exit(tg_signal);
+            test_group_destroy(tg_signal);
+
+            uint64_t first_start = UINT64_MAX, last_end = 0;
+            uint64_t failures = 0, errors = 0;
+            for (jj = 0; jj < num_threads; ++jj) {
+                first_start = (threads[jj].start_ns < first_start) ? threads[jj].start_ns : first_start;
+                last_end = (threads[jj].end_ns > last_end) ? threads[jj].end_ns : last_end;
+                failures += threads[jj].failures;
+                errors += threads[jj].errors;
+            }
+            ASSERT(0 == failures);
+            ASSERT(0 == errors);
+
+            char label[64];
+            snprintf(label, sizeof(label), "%s, %u threads", (0 == mm) ? "create/destroy" : "pool", num_threads);
+            perf_stats_t stats;
+            perf_compute_stats(samples, num_threads * num_iterations, &stats);
+            perf_print_stats(label, "ns", &stats);
+            printf("%-40s %.0f signals/s\n", "",
+                   (double) num_threads * num_iterations * SIGNAL_POOL_IN_FLIGHT / ((double) (last_end - first_start) * 1e-9));
+
+            if (NULL != pool) {
+                print_pool_counters(pool);
+                signal_pool_destroy(pool);
+            }
+
+            // Step through powers of two, finishing at the thread maximum
+            if (num_threads == max_threads) {
+                break;
+            }
+            num_threads = (num_threads * 2 < max_threads) ? num_threads * 2 : max_threads;
+        }
+    }
+
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        // Check if the queue supports dispatch
+        uint32_t features = 0;
+        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 == (features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
+            continue;
+        }
+
+        // Create a queue
+        hsa_queue_t* queue;
+        status = hsa_queue_create(agent_list.agents[ii], 1024, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+        hsa_code_object_t code_object;
+        hsa_executable_t executable;
+
+        status = finalize_executable(agent_list.agents[ii],
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &code_object,
+                                     &executable);
+
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Get the symbol and the symbol info
+        symbol_record_t symbol_record;
+        memset(&symbol_record, 0, sizeof(symbol_record_t));
+
+        char* symbol_names[1];
+        symbol_names[0] = "&__no_op_kernel";
+        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, symbol_names, &symbol_record);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        signal_pool_t* pool = signal_pool_create(SIGNAL_POOL_CACHE_SIZE);
+        ASSERT(NULL != pool);
+
+        printf("\nAgent %d: %lu dispatches of the no_op kernel\n", ii, (unsigned long) num_dispatches);
+
+        for (mm = 0; mm < 2; ++mm) {
+            for (jj = 0; jj < num_dispatches; ++jj) {
+                uint64_t start = perf_get_time_ns();
+                if (0 == mm) {
+                    dispatch_kernel_1d_data(queue, 256, symbol_record.kernel_object, NULL);
+                } else {
+                    dispatch_kernel_1d_data_pooled(queue, pool, 256, symbol_record.kernel_object, NULL);
+                }
+                samples[jj] = (double) (perf_get_time_ns() - start);
+            }
+
+            perf_stats_t stats;
+            perf_compute_stats(samples, num_dispatches, &stats);
+            perf_print_stats((0 == mm) ? "dispatch, create/destroy" : "dispatch, pool", "ns", &stats);
+        }
+        print_pool_counters(pool);
+        signal_pool_destroy(pool);
+
+        // Destroy the queue
+        status = hsa_queue_destroy(queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the executable
+        status = hsa_executable_destroy(executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Destroy the code object
+        status = hsa_code_object_destroy(code_object);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    free(samples);
+    free(threads);
+
+    // Destroy the loaded module
+    destroy_module(module);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
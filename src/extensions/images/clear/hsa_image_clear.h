@@ -48,723 +48,8 @@
 
 #include <hsa.h>
 #include <hsa_ext_image.h>
-#include <stdio.h>
-#include <framework.h>
-
-#define DEFINE_IMAGE_CLEAR_TEST(__type__, __order__, __geometry__, __sep__) \
-DEFINE_TEST(image_clear_##__type__##__sep__##__order__##__sep__##__geometry__)
-
-#define ADD_IMAGE_CLEAR_TEST(__type__, __order__, __geometry__, __sep__) \
-ADD_TEST(image_clear_##__type__##__sep__##__order__##__sep__##__geometry__)
-
-#define IMAGE_CLEAR_TEST(__type__, __order__, __geometry__, __sep__) \
-int test_image_clear_##__type__##__sep__##__order__##__sep__##__geometry__() { \
-    hsa_ext_image_format_t image_format; \
-    hsa_ext_image_geometry_t image_geometry; \
-    image_format.channel_type = HSA_EXT_IMAGE_CHANNEL_TYPE_##__type__; \
-    image_format.channel_order = HSA_EXT_IMAGE_CHANNEL_ORDER_##__order__; \
-    image_geometry = HSA_EXT_IMAGE_GEOMETRY_##__geometry__; \
-    printf("\nTesting channel type = %s, channel order = %s, geometry = %s\n", #__type__, #__order__, #__geometry__); \
-    test_image_clear(&image_format, image_geometry); \
-    return 0; \
-}
 
 extern int test_image_clear(hsa_ext_image_format_t* image_format,
                             hsa_ext_image_geometry_t image_geometry);
 
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, A, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, R, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RX, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RG, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RA, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, BGRA, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ARGB, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, ABGR, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(SNORM_INT8, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, A, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, R, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RX, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RG, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RA, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(SNORM_INT16, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, A, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, R, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RG, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, BGRA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ARGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, ABGR, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SRGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, SBGRA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT8, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, A, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, R, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RG, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, DEPTH, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT16, DEPTH, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT24, DEPTH, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT24, DEPTH, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT24, DEPTH_STENCIL, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_INT24, DEPTH_STENCIL, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_555, RGBX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_565, RGBX, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 1D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 2D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 3D, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 1DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 2DA, _);
-IMAGE_CLEAR_TEST(UNORM_SHORT_101010, RGBX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, A, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, R, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RG, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, BGRA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ARGB, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT8, ABGR, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, A, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, R, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RG, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT16, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, A, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, R, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RG, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RA, 1DB, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(SIGNED_INT32, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, A, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, R, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RG, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, BGRA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ARGB, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT8, ABGR, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, A, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, R, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RG, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT16, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, A, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, R, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RG, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RA, 1DB, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(UNSIGNED_INT32, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, A, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, R, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RX, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RG, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RA, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(HALF_FLOAT, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, A, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, R, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RX, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RG, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RGX, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RA, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, RGBA, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 1D, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 2D, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 3D, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 1DA, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 2DA, _);
-IMAGE_CLEAR_TEST(FLOAT, INTENSITY, 1DB, _);
-IMAGE_CLEAR_TEST(FLOAT, LUMINANCE, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, LUMINANCE, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, DEPTH, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, DEPTH, 2DADEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, DEPTH_STENCIL, 2DDEPTH, _);
-IMAGE_CLEAR_TEST(FLOAT, DEPTH_STENCIL, 2DADEPTH, _);
-
 #endif  // _HSA_IMAGE_CLEAR_H_
@@ -44,5131 +44,32 @@
  */
 
 #include <framework.h>
+#include <image_capability_utils.h>
+#include <image_matrix_utils.h>
+#include <stdio.h>
 #include "hsa_image_import_export.h"
 
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DADEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,3D, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DA, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1DB, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DDEPTH, _);
-DEFINE_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DADEPTH, _);
+// The valid channel types, orders and geometries, generated by
+// image_test_matrix in cmake/image_data.cmake
+static const image_matrix_entry_t image_matrix[] = {
+#include <image_matrix.h>
+};
+
+DEFINE_IMAGE_MATRIX_TEST(image_import_export, image_matrix)
 
 int main(int argc, char* argv[]) {
     INITIALIZE_TESTSUITE();
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT8,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SNORM_INT16,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT8,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT16,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_INT24,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_555,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_565,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNORM_SHORT_101010,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT8,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT16,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(SIGNED_INT32,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT8,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT16,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(UNSIGNED_INT32,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(HALF_FLOAT,DEPTH_STENCIL,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,A,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,R,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RG,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,RGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,BGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ARGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,ABGR,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGB,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBX,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SRGBA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,SBGRA,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,INTENSITY,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,LUMINANCE,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH,2DADEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,3D, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DA, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,1DB, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DDEPTH, _);
-    ADD_IMAGE_IMPORT_EXPORT_TEST(FLOAT,DEPTH_STENCIL,2DADEPTH, _);
+    image_matrix_filter_t filter;
+    image_matrix_parse_filter(argc, argv, &filter);
+
+    // Skip the entries no agent supports, before any of their setup
+    uint8_t supported[sizeof(image_matrix) / sizeof(image_matrix[0])];
+    uint32_t num_unsupported = image_capability_get_supported(image_matrix, sizeof(image_matrix) / sizeof(image_matrix[0]), supported);
+    if (0 < num_unsupported) {
+        printf("Skipping %u image formats no agent supports.\n", num_unsupported);
+    }
+    filter.supported = supported;
 
-    RUN_TESTS();
+    ADD_IMAGE_MATRIX_TESTS(image_import_export, image_matrix, &filter);
+    RUN_IMAGE_MATRIX_TESTS();
 }
@@ -71,6 +71,15 @@
  * 9) Use the hsa_ext_image_export API to export that portion of the image. Verify
  * that the portion of the data just exported matches the original export data.
  * 10) Repeat steps 8 to 9 until the entire image has been imported/exported.
+ * Up to IMAGE_REGION_PIPELINE_DEPTH images, each with its own export buffer, are
+ * used in turn, so that the import and export of the next region overlap the
+ * verification of the previous ones. A reaper thread checks the error word of
+ * each region as its verification kernel completes.
+ * Agents that cannot dispatch the verification kernels, and all agents when
+ * IMAGE_VERIFY_HOST is set, export the image and verify the region on the host.
+ * The queue, verification kernels, slots and backing buffers of each agent are
+ * kept in an image test context and reused by the following test cases run in
+ * the same process, so only the images are created by each test case.
  *
  * Expected results: The import/export API calls should succeed and the data should remain
  * unchanged.
@@ -82,7 +91,9 @@
 #include <agent_utils.h>
 #include <finalize_utils.h>
 #include <framework.h>
+#include <image_format_utils.h>
 #include <image_utils.h>
+#include <perf_utils.h>
 #include <queue_utils.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -99,10 +110,6 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
     status = get_image_fnc_tbl(&pfn);
     ASSERT(HSA_STATUS_SUCCESS == status);
 
-    // Load the BRIG module
-    hsa_ext_module_t module;
-    ASSERT(0 == load_module_from_file("verify_image_region.brig", &module));
-
     // Get the list of agents
     struct agent_list_s agent_list;
     get_agent_list(&agent_list);
@@ -113,13 +120,6 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
     // Repeat the test for each agent
     int ii;
     for (ii = 0; ii < agent_list.num_agents; ++ii) {
-        uint32_t features = 0;
-        status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_FEATURE, &features);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        if (!(features & HSA_AGENT_FEATURE_KERNEL_DISPATCH)) {
-            continue;
-        }
-
         // Get format capability mask.
         status = pfn.hsa_ext_image_get_capability(agent_list.agents[ii],
                                                   image_geometry,
@@ -140,33 +140,28 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
             continue;
         }
 
-        uint32_t grid_max_size;
-        hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_SIZE, &grid_max_size);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        uint32_t grid_max_dim[3];
-        hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_DIM, &grid_max_dim);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        uint32_t work_group_max_size;
-        hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_SIZE, &work_group_max_size);
-        ASSERT(HSA_STATUS_SUCCESS == status);
+        // Get the queue, verification kernels and buffers kept for the agent
+        image_test_context_t* context = image_test_context_get(agent_list.agents[ii], "verify_image_region.brig");
+        int verify_on_host = context->verify_on_host;
+
+        // The dispatch limits do not apply when verifying on the host
+        uint32_t grid_max_size = UINT32_MAX;
+        uint32_t grid_max_dim[3] = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+        uint32_t work_group_max_size = UINT32_MAX;
+        uint32_t work_group_max_dim[3] = {UINT32_MAX, UINT32_MAX, UINT32_MAX};
+        if (!verify_on_host) {
+            status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_SIZE, &grid_max_size);
+            ASSERT(HSA_STATUS_SUCCESS == status);
 
-        uint32_t work_group_max_dim[3];
-        hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_DIM, &work_group_max_dim);
-        ASSERT(HSA_STATUS_SUCCESS == status);
+            status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_GRID_MAX_DIM, &grid_max_dim);
+            ASSERT(HSA_STATUS_SUCCESS == status);
 
-        // Find a global memory region for the image backing buffer
-        hsa_region_t global_region;
-        global_region.handle = (uint64_t) -1;
-        status = hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
-        ASSERT(global_region.handle != (uint64_t) -1);
+            status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_SIZE, &work_group_max_size);
+            ASSERT(HSA_STATUS_SUCCESS == status);
 
-        // Find a memory region that supports kernel arguments
-        hsa_region_t kernarg_region;
-        kernarg_region.handle = (uint64_t) -1;
-        hsa_agent_iterate_regions(agent_list.agents[ii], get_kernarg_memory_region, &kernarg_region);
-        ASSERT((uint64_t) -1 != kernarg_region.handle);
+            status = hsa_agent_get_info(agent_list.agents[ii], HSA_AGENT_INFO_WORKGROUP_MAX_DIM, &work_group_max_dim);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
 
         // Get information regarding the image on this agent using the specified
         // geometry.
@@ -207,125 +202,20 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
         work_group_max_dim[2] = (work_group_max_dim[2] < max_elements[2]) ? work_group_max_dim[2] : max_elements[2];
         ASSERT((work_group_max_dim[0] * work_group_max_dim[1] * work_group_max_dim[2]) <= work_group_max_size);
 
-        // Create a queue to execute validation kernels.
-        hsa_queue_t *queue;
-        status = hsa_queue_create(agent_list.agents[ii], 1024, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &queue);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Finalize the executable
-        hsa_ext_control_directives_t control_directives;
-        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
-        hsa_code_object_t code_object;
-        hsa_executable_t executable;
-
-        status = finalize_executable(agent_list.agents[ii],
-                                     1,
-                                     &module,
-                                     HSA_MACHINE_MODEL_LARGE,
-                                     HSA_PROFILE_FULL,
-                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
-                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
-                                     0,
-                                     control_directives,
-                                     &code_object,
-                                     &executable);
-
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Get the symbol and the symbol info
+        // Get the symbol and the symbol info of the verification kernel
         symbol_record_t symbol_record;
         memset(&symbol_record, 0, sizeof(symbol_record_t));
-
-        status = get_executable_symbols(executable, agent_list.agents[ii], 0, 1, &validation_kernel[0], &symbol_record);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Define the validation kernel arguments
-        typedef struct __attribute__ ((aligned(16))) validate_args_s {
-            hsa_ext_image_t image;  // The image handle
-            void* rgn_values;  // The floating point pixel pattern in the specified region
-            void* bkg_values;  // The floating point pixel pattern in the rest of the image
-            uint32_t* start_region;  // The regions starting coords
-            uint32_t* end_region;  // The regions ending coords
-            uint32_t* bits;  // The channel values to compare
-            uint32_t* cmp_mask;  // The channel values to compare
-            uint32_t* error;  // An error field representing different rbga channel errors
-        } validate_args_t;
-
-
-        // Allocate the kernel argument buffer from the correct region
-        validate_args_t* kernarg_buffer = NULL;
-        status = hsa_memory_allocate(kernarg_region,
-                                     symbol_record.kernarg_segment_size,
-                                     (void**)(&kernarg_buffer));
-
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Create the pattern buffers
-        void* bg_pattern;
-        void* clr_pattern;
-
-        if (image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8  ||
-           image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 ||
-           image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32) {
-            status = hsa_memory_allocate(global_region, 4 * sizeof(uint32_t), (void**) &bg_pattern);
-            ASSERT(HSA_STATUS_SUCCESS == status);
-            status = hsa_memory_allocate(global_region, 4 * sizeof(uint32_t), (void**) &clr_pattern);
-            ASSERT(HSA_STATUS_SUCCESS == status);
-            uint32_t *bg = (uint32_t*) bg_pattern;
-            uint32_t *clr = (uint32_t*) clr_pattern;
-            bg[0] = bg[1] = bg[2] = bg[3] = 0;
-            clr[0] = clr[1] = clr[2] = clr[3] = 255;
-        } else if (image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8  ||
-           image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 ||
-           image_format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32) {
-            status = hsa_memory_allocate(global_region, 4 * sizeof(int32_t), (void**) &bg_pattern);
-            ASSERT(HSA_STATUS_SUCCESS == status);
-            status = hsa_memory_allocate(global_region, 4 * sizeof(int32_t), (void**) &clr_pattern);
-            ASSERT(HSA_STATUS_SUCCESS == status);
-            int32_t *bg = (int32_t*) bg_pattern;
-            int32_t *clr = (int32_t*) clr_pattern;
-            bg[0] = bg[1] = bg[2] = bg[3] = 0;
-            clr[0] = clr[1] = clr[2] = clr[3] = 127;
-        } else {
-            status = hsa_memory_allocate(global_region, 4 * sizeof(float), (void**) &bg_pattern);
+        if (!verify_on_host) {
+            status = get_executable_symbols(context->executable, agent_list.agents[ii], 0, 1, &validation_kernel[0], &symbol_record);
             ASSERT(HSA_STATUS_SUCCESS == status);
-            status = hsa_memory_allocate(global_region, 4 * sizeof(float), (void**) &clr_pattern);
-            ASSERT(HSA_STATUS_SUCCESS == status);
-            float *bg = (float*) bg_pattern;
-            float *clr = (float*) clr_pattern;
-            bg[0] = bg[1] = bg[2] = bg[3] = 0.0f;
-            clr[0] = clr[1] = clr[2] = clr[3] = 0.5f;
         }
+        hsa_queue_t* queue = context->queue;
+        reaper_t* reaper = context->reaper;
 
-        // Create the start and end region buffers
-        uint32_t* start_region;
-        uint32_t* end_region;
-        status = hsa_memory_allocate(global_region, 3 * sizeof(uint32_t), (void**) &start_region);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_allocate(global_region, 3 * sizeof(uint32_t), (void**) &end_region);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Create the error, mask and bits buffers
-        uint32_t* error;
-        uint32_t* cmp_mask;
-        uint32_t* bits;
-        status = hsa_memory_allocate(global_region, sizeof(uint32_t), (void**) &error);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_allocate(global_region, sizeof(uint32_t), (void**) &cmp_mask);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_allocate(global_region, sizeof(uint32_t), (void**) &bits);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Add all of the components to the argument buffer
-        *cmp_mask = get_cmp_info(image_format->channel_order);
-        *bits = get_channel_type_bits(image_format->channel_type);
-        kernarg_buffer->rgn_values = clr_pattern;
-        kernarg_buffer->bkg_values = bg_pattern;
-        kernarg_buffer->start_region = start_region;
-        kernarg_buffer->end_region = end_region;
-        kernarg_buffer->bits = bits;
-        kernarg_buffer->cmp_mask = cmp_mask;
-        kernarg_buffer->error = error;
+        // Set the patterns, bits and mask for the format
+        image_test_context_set_format(context, image_format);
+        void* bg_pattern = context->bg_pattern;
+        void* clr_pattern = context->clr_pattern;
 
         // Determine the size and alignment for the image backing buffer
         hsa_ext_image_descriptor_t image_descriptor;
@@ -349,31 +239,33 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
         // Verify that the memory region will correctly align the
         // image data.
         size_t region_align;
-        status = hsa_region_get_info(global_region, HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT, &region_align);
+        status = hsa_region_get_info(context->global_region, HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT, &region_align);
 
         ASSERT((region_align >= image_info.alignment) && (region_align % image_info.alignment == 0));
 
-        // Allocate the backing buffer
-        void* image_data;
-        status = hsa_memory_allocate(global_region, image_info.size, (void**) &image_data);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Allocate the export buffer
-        void* export_buffer;
-        status = hsa_memory_allocate(global_region, image_info.size, (void**) &export_buffer);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Create an image with the backing buffer.
-        status = pfn.hsa_ext_image_create(agent_list.agents[ii],
-                                          &image_descriptor,
-                                          image_data,
-                                          access_permissions,
-                                          &(kernarg_buffer->image));
-
-        // Create a completion signal
-        hsa_signal_t completion_signal;
-        status = hsa_signal_create(1, 0, NULL, &completion_signal);
-        ASSERT(HSA_STATUS_SUCCESS == status);
+        // Each region in flight gets its own image, backing buffer, export
+        // buffer, kernel arguments and signals. The backing buffers, export
+        // buffers and slots are kept by the context, only the images are created.
+        // The export buffers also hold the exported images when verifying on the host
+        size_t export_size = image_format_get_element_size(image_format) * max_elements[0] * max_elements[1] * max_elements[2];
+        export_size = (export_size > image_info.size) ? export_size : image_info.size;
+        uint32_t depth = get_image_region_pipeline_depth(image_info.size + export_size);
+        void* image_data[IMAGE_REGION_PIPELINE_DEPTH];
+        void* export_buffers[IMAGE_REGION_PIPELINE_DEPTH];
+        hsa_ext_image_t images[IMAGE_REGION_PIPELINE_DEPTH];
+        image_region_slot_t* slots = image_test_context_get_slots(context, symbol_record.kernarg_segment_size);
+        image_test_context_get_image_data(context, image_info.size, image_info.alignment, depth, image_data);
+        image_test_context_get_export_buffers(context, export_size, depth, export_buffers);
+        int jj;
+        for (jj = 0; jj < depth; ++jj) {
+            // Create an image with the backing buffer.
+            status = image_test_context_create_image(context,
+                                                     &image_descriptor,
+                                                     image_data[jj],
+                                                     access_permissions,
+                                                     &images[jj]);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
 
         // Setup the dispatch packet
         hsa_kernel_dispatch_packet_t dispatch_packet;
@@ -386,8 +278,6 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
         dispatch_packet.kernel_object = symbol_record.kernel_object;
         dispatch_packet.group_segment_size = symbol_record.group_segment_size;
         dispatch_packet.private_segment_size = symbol_record.private_segment_size;
-        dispatch_packet.kernarg_address = (void*) kernarg_buffer;
-        dispatch_packet.completion_signal = completion_signal;
         dispatch_packet.workgroup_size_x = work_group_max_dim[0];
         dispatch_packet.workgroup_size_y = work_group_max_dim[1];
         dispatch_packet.workgroup_size_z = work_group_max_dim[2];
@@ -406,6 +296,7 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
         region_all.range.z = max_elements[2];
 
         size_t x_offset, y_offset, z_offset;
+        uint32_t num_regions = 0;
 
         // Clear various regions of the image, checking for validity each iteration
         for (x_offset = 0; x_offset < max_elements[0]; x_offset += region_step[0]) {
@@ -414,8 +305,6 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
             if (region_partial.range.x <= 0) {
                 continue;
             }
-            start_region[0] = region_partial.offset.x;
-            end_region[0] = start_region[0] + region_partial.range.x;
 
             for (y_offset = 0; y_offset < max_elements[1]; y_offset += region_step[1]) {
                 region_partial.offset.y = y_offset;
@@ -423,8 +312,6 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
                 if (region_partial.range.y <= 0) {
                     continue;
                 }
-                start_region[1] = region_partial.offset.y;
-                end_region[1] = start_region[1] + region_partial.range.y;
 
                 for (z_offset = 0; z_offset < max_elements[2]; z_offset += region_step[2]) {
                     region_partial.offset.z = z_offset;
@@ -432,12 +319,18 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
                     if (region_partial.range.z <= 0) {
                         continue;
                     }
-                    start_region[2] = region_partial.offset.z;
-                    end_region[2] = start_region[2] + region_partial.range.z;
+
+                    // Wait for the previous region of this slot to be verified
+                    image_region_slot_t* slot = &slots[num_regions % depth];
+                    hsa_ext_image_t image = images[num_regions % depth];
+                    void* export_buffer = export_buffers[num_regions % depth];
+                    ++num_regions;
+                    image_region_slot_wait(slot);
+                    ASSERT(0 == context->failures);
 
                     // Clear the entire image to the bg_pattern.
                     status = pfn.hsa_ext_image_clear(agent_list.agents[ii],
-                                                     kernarg_buffer->image,
+                                                     image,
                                                      bg_pattern,
                                                      &region_all);
 
@@ -445,7 +338,7 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
 
                     // Clear the partial region of the image with the clr_pattern.
                     status = pfn.hsa_ext_image_clear(agent_list.agents[ii],
-                                                     kernarg_buffer->image,
+                                                     image,
                                                      clr_pattern,
                                                      &region_partial);
 
@@ -456,7 +349,7 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
                     size_t dst_slice_pitch = region_all.range.x * region_all.range.y;
                
                     status = pfn.hsa_ext_image_export(agent_list.agents[ii],
-                                                      kernarg_buffer->image,
+                                                      image,
                                                       export_buffer,
                                                       dst_row_pitch,
                                                       dst_slice_pitch,
@@ -466,7 +359,7 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
 
                     // Clear the image
                     status = pfn.hsa_ext_image_clear(agent_list.agents[ii],
-                                                 kernarg_buffer->image,
+                                                 image,
                                                  bg_pattern,
                                                  &region_all);
                       
@@ -477,87 +370,32 @@ int test_image_import_export(hsa_ext_image_format_t* image_format,
                                                   export_buffer,
                                                   dst_row_pitch,
                                                   dst_slice_pitch,
-                                                  kernarg_buffer->image,
+                                                  image,
                                                   &region_all);
 
                     ASSERT(HSA_STATUS_SUCCESS == status);
 
-                    *kernarg_buffer->error = 0;
-
-                    // Dispatch the kernel
-                    enqueue_dispatch_packet(queue, &dispatch_packet);
-
-                    // Wait on the completion signal
-                    hsa_signal_value_t value;
-                    do {
-                        value = hsa_signal_wait_relaxed(completion_signal, HSA_SIGNAL_CONDITION_LT, 1, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
-                    } while (0 != value);
-
-                    // Verify that no errors occured.
-                    if (0 != *kernarg_buffer->error) {
-                        printf("\nRegion: (%d,%d,%d) -> (%d,%d,%d) Error: %d\n",
-                                                                    start_region[0],
-                                                                    start_region[1],
-                                                                    start_region[2],
-                                                                    end_region[0],
-                                                                    end_region[1],
-                                                                    end_region[2],
-                                                                    *kernarg_buffer->error);
-                        ASSERT(0 == *kernarg_buffer->error);
+                    // Verify the region while the next one is being imported
+                    if (verify_on_host) {
+                        image_region_slot_verify_host(slot,
+                                                      &pfn,
+                                                      agent_list.agents[ii],
+                                                      image,
+                                                      image_format,
+                                                      &region_all,
+                                                      &region_partial,
+                                                      export_buffer);
+                    } else {
+                        image_region_slot_verify(slot, image, &region_partial, queue, &dispatch_packet, reaper);
                     }
-
-                    printf(".");
-
-                    // Reset the signal value
-                    hsa_signal_store_release(completion_signal, 1);
                 }
             }
         }
 
-        // Destroy the completion signal
-        hsa_signal_destroy(completion_signal);
-
-        // Destroy the image
-        status = pfn.hsa_ext_image_destroy(agent_list.agents[ii], kernarg_buffer->image);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Free the backing buffer
-        status = hsa_memory_free(image_data);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Free the kernarg_buffer
-        status = hsa_memory_free(kernarg_buffer);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Destroy the executable
-        status = hsa_executable_destroy(executable);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Destroy the code object
-        status = hsa_code_object_destroy(code_object);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Free the clear and background patterns
-        status = hsa_memory_free(bg_pattern);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_free(clr_pattern);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Free all the utility buffers
-        status = hsa_memory_free(start_region);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_free(end_region);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_free(error);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_free(cmp_mask);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-        status = hsa_memory_free(bits);
-        ASSERT(HSA_STATUS_SUCCESS == status);
-
-        // Destroy the queue
-        status = hsa_queue_destroy(queue);
-        ASSERT(HSA_STATUS_SUCCESS == status);
+        // Wait for the last regions to be verified and destroy the images,
+        // the rest is kept for the next test case
+        image_test_context_release_images(context);
+        ASSERT(0 == context->failures);
     }
 
     // Shutdown HSA
@@ -0,0 +1,233 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_clear_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the fill rate and the fixed cost per call of
+ * hsa_ext_image_clear, for regions from a single texel up to the whole
+ * image, to tell when small clears are worth batching and when a large
+ * clear is better done with a kernel.
+ *
+ * Test Description:
+ * 1) For each agent, find a fine grained global memory region for the image
+ * backing buffers.
+ * 2) For each format of IMAGE_PERF_FORMATS and each geometry the agent
+ * supports with read write access:
+ *    a) Create an image of about IMAGE_CLEAR_TEXELS texels, spread evenly
+ *    over its dimensions.
+ *    b) For regions of 1 texel, and 4x more texels at each step up to the
+ *    whole image, time IMAGE_CLEAR_ITERATIONS clears of the region and
+ *    report the time per call and the fill rate in texels/s.
+ *    c) Report the median time per call of the single texel region as the
+ *    fixed overhead per call, the fill rate from the difference in time with
+ *    the whole image, and the region size where the overhead is half of the
+ *    time per call.
+ *
+ * Expected Results: Every clear should succeed. The time per call of the
+ * smallest regions is the fixed overhead of the runtime, the fill rate of
+ * the largest ones should approach the memory bandwidth of the agent.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <image_format_utils.h>
+#include <image_utils.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_CLEAR_TEXELS (1024 * 1024)
+#define IMAGE_CLEAR_ITERATIONS 20
+
+// Number of region sizes of the sweep, 1 texel up to 4^(N-1) texels
+#define IMAGE_CLEAR_MAX_STEPS 32
+
+// Get the clear values of a format, a value all of its channels can hold
+static void get_clear_data(const hsa_ext_image_format_t* format, uint32_t* data) {
+    int ii;
+    for (ii = 0; ii < 4; ++ii) {
+        if (IMAGE_FORMAT_VALUE_FLOAT == image_format_get_value_type(format->channel_type)) {
+            float value = 0.5f;
+            memcpy(&data[ii], &value, sizeof(float));
+        } else {
+            data[ii] = 1;
+        }
+    }
+
+    return;
+}
+
+int test_image_clear_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_ext_image_pfn_t pfn;
+    status = get_image_fnc_tbl(&pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t image_texels = perf_get_env_uint("IMAGE_CLEAR_TEXELS", IMAGE_CLEAR_TEXELS);
+    uint64_t num_iterations = perf_get_env_uint("IMAGE_CLEAR_ITERATIONS", IMAGE_CLEAR_ITERATIONS);
+    ASSERT(0 < image_texels && 0 < num_iterations);
+
+    double* samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    int ii;
+    uint32_t jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t) -1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t) -1 == global_region.handle) {
+            continue;
+        }
+
+        printf("\nAgent %d: image clear, %lu texel images, %lu iterations\n",
+               ii, (unsigned long) image_texels, (unsigned long) num_iterations);
+
+        for (jj = 0; jj < IMAGE_PERF_NUM_FORMATS; ++jj) {
+            const hsa_ext_image_format_t* format = &IMAGE_PERF_FORMATS[jj].format;
+            uint32_t clear_data[4];
+            get_clear_data(format, clear_data);
+
+            for (kk = 0; kk < IMAGE_PERF_NUM_GEOMETRIES; ++kk) {
+                hsa_ext_image_geometry_t geometry = IMAGE_PERF_GEOMETRIES[kk].geometry;
+                if (!image_perf_is_supported(&pfn, agent_list.agents[ii], format, geometry)) {
+                    continue;
+                }
+
+                hsa_ext_image_descriptor_t descriptor;
+                image_perf_init_descriptor(agent_list.agents[ii], format, geometry, image_texels, &descriptor);
+
+                hsa_ext_image_t image;
+                void* image_data;
+                status = image_perf_create_image(&pfn, agent_list.agents[ii], global_region, &descriptor,
+                                                 &image, &image_data);
+                ASSERT(HSA_STATUS_SUCCESS == status);
+
+                hsa_ext_image_region_t region;
+                image_perf_get_region(&descriptor, 1, &region);
+                uint64_t max_texels = image_perf_get_region_texels(&region);
+
+                // The median time per call of each region size
+                double step_texels[IMAGE_CLEAR_MAX_STEPS];
+                double step_ns[IMAGE_CLEAR_MAX_STEPS];
+                int num_steps = 0;
+
+                uint64_t num_texels = 1;
+                while (num_steps < IMAGE_CLEAR_MAX_STEPS) {
+                    image_perf_get_sized_region(&descriptor, num_texels, &region);
+                    uint64_t region_texels = image_perf_get_region_texels(&region);
+
+                    // The first clear is not timed
+                    status = pfn.hsa_ext_image_clear(agent_list.agents[ii], image, clear_data, &region);
+                    ASSERT(HSA_STATUS_SUCCESS == status);
+
+                    uint64_t mm;
+                    for (mm = 0; mm < num_iterations; ++mm) {
+                        uint64_t start = perf_get_time_ns();
+                        status = pfn.hsa_ext_image_clear(agent_list.agents[ii], image, clear_data, &region);
+                        uint64_t elapsed = perf_get_time_ns() - start;
+                        ASSERT(HSA_STATUS_SUCCESS == status);
+                        samples[mm] = (double) elapsed;
+                    }
+
+                    char label[96];
+                    perf_stats_t stats;
+                    snprintf(label, sizeof(label), "%s %s %ux%ux%u",
+                             IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name,
+                             region.range.x, region.range.y, region.range.z);
+                    perf_compute_stats(samples, num_iterations, &stats);
+                    perf_print_stats(label, "ns", &stats);
+                    printf("%-40s %.3e texels/s\n", "",
+                           (double) region_texels / (((0.0 < stats.p50) ? stats.p50 : 1.0) * 1e-9));
+
+                    step_texels[num_steps] = (double) region_texels;
+                    step_ns[num_steps] = stats.p50;
+                    ++num_steps;
+
+                    if (region_texels >= max_texels) {
+                        break;
+                    }
+                    num_texels = (num_texels * 4 < max_texels) ? num_texels * 4 : max_texels;
+                }
+
+                // The single texel clear is all overhead, the difference with the
+                // whole image clear is the cost of the texels
+                if (1 < num_steps && step_ns[num_steps - 1] > step_ns[0]) {
+                    double overhead_ns = step_ns[0];
+                    double ns_per_texel = (step_ns[num_steps - 1] - step_ns[0]) /
+                                          (step_texels[num_steps - 1] - step_texels[0]);
+                    printf("%s %s: %.0f ns per call, %.3e texels/s, overhead is half of the time at %.0f texels\n",
+                           IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name, overhead_ns,
+                           1e9 / ns_per_texel, overhead_ns / ns_per_texel);
+                }
+
+                image_perf_destroy_image(&pfn, agent_list.agents[ii], image, image_data);
+            }
+        }
+    }
+
+    free(samples);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
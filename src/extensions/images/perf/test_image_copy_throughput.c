@@ -0,0 +1,354 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_copy_throughput
+ * Scope: Performance
+ *
+ * Purpose: Measures the latency per call and the bandwidth of
+ * hsa_ext_image_copy for regions from a single texel up to the whole image,
+ * between images of the same format, within a single image as when building
+ * a texture atlas, between images of compatible formats and between images
+ * of different geometries.
+ *
+ * Test Description:
+ * 1) For each agent, find a fine grained global memory region for the image
+ * backing buffers.
+ * 2) For each format of IMAGE_PERF_FORMATS and each geometry the agent
+ * supports with read write access, create two images of about
+ * IMAGE_COPY_TEXELS texels. For regions of 1 texel, and 4x more texels at
+ * each step up to the whole image:
+ *    a) Time IMAGE_COPY_ITERATIONS copies of the region from one image to
+ *    the other.
+ *    b) When the region is at most half of the image wide, also time copies
+ *    of the region to the right edge of the same image.
+ * 3) Repeat 2a) for the pairs of compatible formats of COPY_FORMAT_PAIRS,
+ * which only differ in their linear or sRGB channel order, with 2D images.
+ * 4) Repeat 2a) for the pairs of geometries of COPY_GEOMETRY_PAIRS, copying
+ * regions of a single row, layer or slice.
+ * 5) Report the time per call, and the bandwidth at the median time in GB/s
+ * of texel data.
+ *
+ * Expected Results: Every copy should succeed. The time per call of the
+ * smallest regions is the fixed overhead of the runtime, the bandwidth of
+ * the largest ones should approach the memory bandwidth of the agent.
+ * Overlapping copies within an image are undefined, and are not measured.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <image_format_utils.h>
+#include <image_utils.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_COPY_TEXELS (1024 * 1024)
+#define IMAGE_COPY_ITERATIONS 20
+
+// Formats that image copies convert between, the linear and sRGB orders of
+// the same channels
+static const image_perf_format_t COPY_FORMAT_PAIRS[][2] = {
+    {{{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA}, "UNORM_INT8/RGBA"},
+     {{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBA}, "UNORM_INT8/SRGBA"}},
+    {{{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBA}, "UNORM_INT8/SRGBA"},
+     {{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA}, "UNORM_INT8/RGBA"}},
+    {{{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_BGRA}, "UNORM_INT8/BGRA"},
+     {{HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_SBGRA}, "UNORM_INT8/SBGRA"}}
+};
+
+#define NUM_COPY_FORMAT_PAIRS (sizeof(COPY_FORMAT_PAIRS) / sizeof(COPY_FORMAT_PAIRS[0]))
+
+// Geometries that image copies go between, through a row, layer or slice
+static const image_perf_geometry_t COPY_GEOMETRY_PAIRS[][2] = {
+    {{HSA_EXT_IMAGE_GEOMETRY_1DA, "1DA"}, {HSA_EXT_IMAGE_GEOMETRY_1D, "1D"}},
+    {{HSA_EXT_IMAGE_GEOMETRY_2DA, "2DA"}, {HSA_EXT_IMAGE_GEOMETRY_2D, "2D"}},
+    {{HSA_EXT_IMAGE_GEOMETRY_2D, "2D"}, {HSA_EXT_IMAGE_GEOMETRY_2DA, "2DA"}},
+    {{HSA_EXT_IMAGE_GEOMETRY_3D, "3D"}, {HSA_EXT_IMAGE_GEOMETRY_2D, "2D"}},
+    {{HSA_EXT_IMAGE_GEOMETRY_2D, "2D"}, {HSA_EXT_IMAGE_GEOMETRY_3D, "3D"}}
+};
+
+#define NUM_COPY_GEOMETRY_PAIRS (sizeof(COPY_GEOMETRY_PAIRS) / sizeof(COPY_GEOMETRY_PAIRS[0]))
+
+// The format of the copies between geometries
+static const hsa_ext_image_format_t COPY_GEOMETRY_FORMAT = {
+    HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8, HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA
+};
+
+// The images and the sizes of a copy sweep
+typedef struct image_copy_sweep_s {
+    hsa_ext_image_pfn_t* pfn;
+    hsa_agent_t agent;
+    hsa_ext_image_t src_image;
+    hsa_ext_image_t dst_image;
+    // The regions of the sweep are taken from this descriptor, and have
+    // to fit in both images
+    hsa_ext_image_descriptor_t region_descriptor;
+    // Copy the regions to the right edge of the destination image
+    int to_right_edge;
+    size_t element_size;
+    uint64_t num_iterations;
+    double* samples;
+} image_copy_sweep_t;
+
+// Time the copies of regions from 1 texel to the whole region descriptor
+static void sweep_copies(image_copy_sweep_t* sweep, const char* name) {
+    hsa_ext_image_region_t region;
+    image_perf_get_region(&sweep->region_descriptor, 1, &region);
+    uint64_t max_texels = image_perf_get_region_texels(&region);
+
+    uint64_t num_texels = 1;
+    while (1) {
+        image_perf_get_sized_region(&sweep->region_descriptor, num_texels, &region);
+        uint64_t region_texels = image_perf_get_region_texels(&region);
+
+        // Copies within an image must not overlap, the region goes to the
+        // right edge when it is at most half of the image wide
+        hsa_dim3_t dst_offset = region.offset;
+        if (sweep->to_right_edge) {
+            if (2 * region.range.x > sweep->region_descriptor.width) {
+                break;
+            }
+            dst_offset.x = (uint32_t) sweep->region_descriptor.width - region.range.x;
+        }
+
+        // The first copy is not timed
+        hsa_status_t status = sweep->pfn->hsa_ext_image_copy(sweep->agent, sweep->src_image, &region.offset,
+                                                             sweep->dst_image, &dst_offset, &region.range);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        uint64_t ii;
+        for (ii = 0; ii < sweep->num_iterations; ++ii) {
+            uint64_t start = perf_get_time_ns();
+            status = sweep->pfn->hsa_ext_image_copy(sweep->agent, sweep->src_image, &region.offset,
+                                                    sweep->dst_image, &dst_offset, &region.range);
+            uint64_t elapsed = perf_get_time_ns() - start;
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            sweep->samples[ii] = (double) elapsed;
+        }
+
+        char label[96];
+        perf_stats_t stats;
+        snprintf(label, sizeof(label), "%s %ux%ux%u", name, region.range.x, region.range.y, region.range.z);
+        perf_compute_stats(sweep->samples, sweep->num_iterations, &stats);
+        perf_print_stats(label, "ns", &stats);
+        printf("%-40s %.3f GB/s\n", "",
+               (double) (region_texels * sweep->element_size) / ((0.0 < stats.p50) ? stats.p50 : 1.0));
+
+        if (region_texels >= max_texels) {
+            break;
+        }
+        num_texels = (num_texels * 4 < max_texels) ? num_texels * 4 : max_texels;
+    }
+
+    return;
+}
+
+// Create the images of a copy, and time the copies between them
+static void measure_copies(image_copy_sweep_t* sweep,
+                           hsa_region_t global_region,
+                           const hsa_ext_image_format_t* src_format,
+                           hsa_ext_image_geometry_t src_geometry,
+                           const hsa_ext_image_format_t* dst_format,
+                           hsa_ext_image_geometry_t dst_geometry,
+                           uint64_t image_texels,
+                           const char* name) {
+    hsa_ext_image_descriptor_t src_descriptor;
+    hsa_ext_image_descriptor_t dst_descriptor;
+    image_perf_init_descriptor(sweep->agent, src_format, src_geometry, image_texels, &src_descriptor);
+    image_perf_init_descriptor(sweep->agent, dst_format, dst_geometry, image_texels, &dst_descriptor);
+
+    void* src_data;
+    void* dst_data;
+    hsa_status_t status;
+    status = image_perf_create_image(sweep->pfn, sweep->agent, global_region, &src_descriptor,
+                                     &sweep->src_image, &src_data);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = image_perf_create_image(sweep->pfn, sweep->agent, global_region, &dst_descriptor,
+                                     &sweep->dst_image, &dst_data);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // The regions fit in both images. Between geometries they are a single
+    // row, layer or slice of the smaller of the two.
+    sweep->element_size = image_format_get_element_size(src_format);
+    if (src_geometry == dst_geometry) {
+        sweep->region_descriptor = src_descriptor;
+    } else {
+        hsa_ext_image_region_t src_region;
+        hsa_ext_image_region_t dst_region;
+        image_perf_get_region(&src_descriptor, 1, &src_region);
+        image_perf_get_region(&dst_descriptor, 1, &dst_region);
+
+        memset(&sweep->region_descriptor, 0, sizeof(hsa_ext_image_descriptor_t));
+        sweep->region_descriptor.format = *src_format;
+        sweep->region_descriptor.width = (src_region.range.x < dst_region.range.x) ?
+                                         src_region.range.x : dst_region.range.x;
+        sweep->region_descriptor.height = 1;
+        sweep->region_descriptor.depth = 1;
+        sweep->region_descriptor.array_size = 1;
+        sweep->region_descriptor.geometry = HSA_EXT_IMAGE_GEOMETRY_1D;
+        if (1 < src_descriptor.height && 1 < dst_descriptor.height) {
+            sweep->region_descriptor.height = (src_descriptor.height < dst_descriptor.height) ?
+                                              src_descriptor.height : dst_descriptor.height;
+            sweep->region_descriptor.geometry = HSA_EXT_IMAGE_GEOMETRY_2D;
+        }
+    }
+
+    sweep->to_right_edge = 0;
+    sweep_copies(sweep, name);
+
+    image_perf_destroy_image(sweep->pfn, sweep->agent, sweep->dst_image, dst_data);
+
+    // Copy within the source image, as when building a texture atlas
+    if (src_geometry == dst_geometry && 0 == memcmp(src_format, dst_format, sizeof(hsa_ext_image_format_t))) {
+        char within_name[80];
+        snprintf(within_name, sizeof(within_name), "%s within", name);
+        sweep->dst_image = sweep->src_image;
+        sweep->to_right_edge = 1;
+        sweep_copies(sweep, within_name);
+    }
+
+    image_perf_destroy_image(sweep->pfn, sweep->agent, sweep->src_image, src_data);
+
+    return;
+}
+
+int test_image_copy_throughput() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_ext_image_pfn_t pfn;
+    status = get_image_fnc_tbl(&pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t image_texels = perf_get_env_uint("IMAGE_COPY_TEXELS", IMAGE_COPY_TEXELS);
+    uint64_t num_iterations = perf_get_env_uint("IMAGE_COPY_ITERATIONS", IMAGE_COPY_ITERATIONS);
+    ASSERT(0 < image_texels && 0 < num_iterations);
+
+    double* samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    int ii;
+    uint32_t jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t) -1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t) -1 == global_region.handle) {
+            continue;
+        }
+
+        printf("\nAgent %d: image copy, %lu texel images, %lu iterations\n",
+               ii, (unsigned long) image_texels, (unsigned long) num_iterations);
+
+        image_copy_sweep_t sweep;
+        memset(&sweep, 0, sizeof(image_copy_sweep_t));
+        sweep.pfn = &pfn;
+        sweep.agent = agent_list.agents[ii];
+        sweep.num_iterations = num_iterations;
+        sweep.samples = samples;
+
+        char name[80];
+
+        // Same format and geometry
+        for (jj = 0; jj < IMAGE_PERF_NUM_FORMATS; ++jj) {
+            const hsa_ext_image_format_t* format = &IMAGE_PERF_FORMATS[jj].format;
+            for (kk = 0; kk < IMAGE_PERF_NUM_GEOMETRIES; ++kk) {
+                hsa_ext_image_geometry_t geometry = IMAGE_PERF_GEOMETRIES[kk].geometry;
+                if (!image_perf_is_supported(&pfn, sweep.agent, format, geometry)) {
+                    continue;
+                }
+                snprintf(name, sizeof(name), "%s %s", IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name);
+                measure_copies(&sweep, global_region, format, geometry, format, geometry, image_texels, name);
+            }
+        }
+
+        // Compatible formats
+        for (jj = 0; jj < NUM_COPY_FORMAT_PAIRS; ++jj) {
+            const hsa_ext_image_format_t* src_format = &COPY_FORMAT_PAIRS[jj][0].format;
+            const hsa_ext_image_format_t* dst_format = &COPY_FORMAT_PAIRS[jj][1].format;
+            if (!image_perf_is_supported(&pfn, sweep.agent, src_format, HSA_EXT_IMAGE_GEOMETRY_2D) ||
+                !image_perf_is_supported(&pfn, sweep.agent, dst_format, HSA_EXT_IMAGE_GEOMETRY_2D)) {
+                continue;
+            }
+            snprintf(name, sizeof(name), "%s -> %s 2D", COPY_FORMAT_PAIRS[jj][0].name, COPY_FORMAT_PAIRS[jj][1].name);
+            measure_copies(&sweep, global_region, src_format, HSA_EXT_IMAGE_GEOMETRY_2D,
+                           dst_format, HSA_EXT_IMAGE_GEOMETRY_2D, image_texels, name);
+        }
+
+        // Different geometries
+        for (jj = 0; jj < NUM_COPY_GEOMETRY_PAIRS; ++jj) {
+            hsa_ext_image_geometry_t src_geometry = COPY_GEOMETRY_PAIRS[jj][0].geometry;
+            hsa_ext_image_geometry_t dst_geometry = COPY_GEOMETRY_PAIRS[jj][1].geometry;
+            if (!image_perf_is_supported(&pfn, sweep.agent, &COPY_GEOMETRY_FORMAT, src_geometry) ||
+                !image_perf_is_supported(&pfn, sweep.agent, &COPY_GEOMETRY_FORMAT, dst_geometry)) {
+                continue;
+            }
+            snprintf(name, sizeof(name), "UNORM_INT8/RGBA %s -> %s",
+                     COPY_GEOMETRY_PAIRS[jj][0].name, COPY_GEOMETRY_PAIRS[jj][1].name);
+            measure_copies(&sweep, global_region, &COPY_GEOMETRY_FORMAT, src_geometry,
+                           &COPY_GEOMETRY_FORMAT, dst_geometry, image_texels, name);
+        }
+    }
+
+    free(samples);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_format_conversion
+ * Scope: Performance
+ *
+ * Purpose: Measures the throughput of packing RGBA values into the elements
+ * of every image format, and unpacking them back, with the host conversions
+ * of image_format_utils that generate and check image data.
+ *
+ * Test Description:
+ * 1) For every valid combination of channel type and channel order:
+ *    a) Fill IMAGE_FORMAT_CONVERSION_ELEMENTS elements worth of values
+ *    covering the range of the channel type, and a few values outside of
+ *    it that saturate.
+ *    b) Check that image_format_pack and image_format_unpack give the same
+ *    bits as their scalar references, and that unpacking and packing again
+ *    gives back the same elements.
+ *    c) Pack and unpack the elements IMAGE_FORMAT_CONVERSION_ITERATIONS
+ *    times and report the throughput in GB/s of image data.
+ *    d) For the formats with a vector path, also report the throughput of
+ *    the scalar references over IMAGE_FORMAT_CONVERSION_SCALAR_ITERATIONS.
+ *
+ * Expected Results: The vector paths should match the scalar references bit
+ * for bit. With IMAGE_FORMAT_CONVERSION_ELEMENTS large enough to spill the
+ * caches, the conversions of the 8 and 16 bit formats with a vector path
+ * should approach the memory bandwidth of the host.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <framework.h>
+#include <image_format_utils.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMAGE_FORMAT_CONVERSION_ELEMENTS (256 * 1024)
+#define IMAGE_FORMAT_CONVERSION_ITERATIONS 10
+#define IMAGE_FORMAT_CONVERSION_SCALAR_ITERATIONS 3
+
+static const char* CHANNEL_TYPE_NAMES[] = {
+    "SNORM_INT8", "SNORM_INT16", "UNORM_INT8", "UNORM_INT16", "UNORM_INT24",
+    "UNORM_SHORT_555", "UNORM_SHORT_565", "UNORM_SHORT_101010", "SIGNED_INT8",
+    "SIGNED_INT16", "SIGNED_INT32", "UNSIGNED_INT8", "UNSIGNED_INT16",
+    "UNSIGNED_INT32", "HALF_FLOAT", "FLOAT"
+};
+
+static const char* CHANNEL_ORDER_NAMES[] = {
+    "A", "R", "RX", "RG", "RGX", "RA", "RGB", "RGBX", "RGBA", "BGRA", "ARGB",
+    "ABGR", "SRGB", "SRGBX", "SRGBA", "SBGRA", "INTENSITY", "LUMINANCE",
+    "DEPTH", "DEPTH_STENCIL"
+};
+
+#define NUM_CHANNEL_TYPES (sizeof(CHANNEL_TYPE_NAMES) / sizeof(CHANNEL_TYPE_NAMES[0]))
+#define NUM_CHANNEL_ORDERS (sizeof(CHANNEL_ORDER_NAMES) / sizeof(CHANNEL_ORDER_NAMES[0]))
+
+// Fill the values of count elements. One value in sixteen is outside of
+// the range of the channels, to exercise the saturation.
+static void fill_values(image_format_value_t value_type, void* values, size_t count) {
+    size_t ii;
+    for (ii = 0; ii < 4 * count; ++ii) {
+        uint32_t hash = (uint32_t) ii * 2654435761u;
+        int out_of_range = (0 == (hash >> 28));
+        if (IMAGE_FORMAT_VALUE_FLOAT == value_type) {
+            float value = (float) (hash >> 8) / (float) (1 << 24);
+            ((float*) values)[ii] = out_of_range ? 4.0f * value - 2.0f : 2.0f * value - 1.0f;
+        } else if (IMAGE_FORMAT_VALUE_INT32 == value_type) {
+            ((int32_t*) values)[ii] = out_of_range ? (int32_t) hash : (int32_t) (hash >> 16) - 32768;
+        } else {
+            ((uint32_t*) values)[ii] = out_of_range ? hash : (hash >> 16);
+        }
+    }
+
+    return;
+}
+
+// Convert the elements num_iterations times with the pack or unpack
+// function and record the throughput of each conversion in GB/s
+static void measure_conversion(hsa_status_t (*convert_fn)(const hsa_ext_image_format_t*, const void*, void*, size_t),
+                               const hsa_ext_image_format_t* format,
+                               const void* src,
+                               void* dst,
+                               size_t count,
+                               size_t num_bytes,
+                               uint64_t num_iterations,
+                               double* samples) {
+    uint64_t ii;
+    for (ii = 0; ii < num_iterations; ++ii) {
+        uint64_t start = perf_get_time_ns();
+        hsa_status_t status = convert_fn(format, src, dst, count);
+        uint64_t elapsed = perf_get_time_ns() - start;
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        samples[ii] = (double) num_bytes / (double) ((0 == elapsed) ? 1 : elapsed);
+    }
+
+    return;
+}
+
+// Print the statistics of a set of throughput samples
+static void print_conversion(const char* format_name,
+                             const char* mode,
+                             double* samples,
+                             uint64_t num_samples) {
+    char label[64];
+    perf_stats_t stats;
+
+    snprintf(label, sizeof(label), "%s %s", format_name, mode);
+    perf_compute_stats(samples, num_samples, &stats);
+    perf_print_stats(label, "GB/s", &stats);
+
+    return;
+}
+
+int test_image_format_conversion() {
+    size_t num_elements = (size_t) perf_get_env_uint("IMAGE_FORMAT_CONVERSION_ELEMENTS",
+                                                     IMAGE_FORMAT_CONVERSION_ELEMENTS);
+    uint64_t num_iterations = perf_get_env_uint("IMAGE_FORMAT_CONVERSION_ITERATIONS",
+                                                IMAGE_FORMAT_CONVERSION_ITERATIONS);
+    uint64_t num_scalar_iterations = perf_get_env_uint("IMAGE_FORMAT_CONVERSION_SCALAR_ITERATIONS",
+                                                       IMAGE_FORMAT_CONVERSION_SCALAR_ITERATIONS);
+    uint64_t num_samples = (num_iterations > num_scalar_iterations) ? num_iterations : num_scalar_iterations;
+    uint32_t ii, jj;
+
+    ASSERT(0 != num_elements);
+    ASSERT(0 != num_iterations);
+
+    // Four 32 bit values per element, and up to 16 bytes per element
+    void* values = malloc(num_elements * 16);
+    void* unpacked = malloc(num_elements * 16);
+    void* elements = malloc(num_elements * 16);
+    void* repacked = malloc(num_elements * 16);
+    double* samples = (double*) malloc(num_samples * sizeof(double));
+    ASSERT(NULL != values && NULL != unpacked && NULL != elements && NULL != repacked && NULL != samples);
+
+    printf("\nImage format conversions: %lu elements, %lu iterations, vector path %s\n",
+           (unsigned long) num_elements, (unsigned long) num_iterations, image_format_get_isa());
+
+    for (ii = 0; ii < NUM_CHANNEL_TYPES; ++ii) {
+        for (jj = 0; jj < NUM_CHANNEL_ORDERS; ++jj) {
+            hsa_ext_image_format_t format;
+            format.channel_type = (hsa_ext_image_channel_type_t) ii;
+            format.channel_order = (hsa_ext_image_channel_order_t) jj;
+            // Skip the channel types and orders that don't form a valid format
+            image_format_layout_t layout;
+            if (HSA_STATUS_SUCCESS != image_format_get_layout(&format, &layout)) {
+                continue;
+            }
+            size_t image_size = num_elements * layout.element_size;
+            size_t values_size = num_elements * 16;
+
+            char format_name[48];
+            snprintf(format_name, sizeof(format_name), "%s/%s", CHANNEL_TYPE_NAMES[ii], CHANNEL_ORDER_NAMES[jj]);
+
+            // The vector paths match the scalar references bit for bit
+            fill_values(layout.value_type, values, num_elements);
+            ASSERT(HSA_STATUS_SUCCESS == image_format_pack(&format, values, elements, num_elements));
+            ASSERT(HSA_STATUS_SUCCESS == image_format_pack_scalar(&format, values, repacked, num_elements));
+            ASSERT(0 == memcmp(elements, repacked, image_size));
+            ASSERT(HSA_STATUS_SUCCESS == image_format_unpack(&format, elements, unpacked, num_elements));
+            ASSERT(HSA_STATUS_SUCCESS == image_format_unpack_scalar(&format, elements, values, num_elements));
+            ASSERT(0 == memcmp(unpacked, values, values_size));
+
+            // Unpacked values are exact, so packing them again gives back the
+            // same elements. Intensity and luminance replicate red, so their
+            // packed elements only hold red in the first place.
+            ASSERT(HSA_STATUS_SUCCESS == image_format_pack(&format, unpacked, repacked, num_elements));
+            ASSERT(0 == memcmp(elements, repacked, image_size));
+
+            fill_values(layout.value_type, values, num_elements);
+            measure_conversion(image_format_pack, &format, values, elements, num_elements, image_size,
+                               num_iterations, samples);
+            print_conversion(format_name, "pack", samples, num_iterations);
+            measure_conversion(image_format_unpack, &format, elements, unpacked, num_elements, image_size,
+                               num_iterations, samples);
+            print_conversion(format_name, "unpack", samples, num_iterations);
+
+            if (image_format_has_vector_path(&format) && 0 != num_scalar_iterations) {
+                measure_conversion(image_format_pack_scalar, &format, values, elements, num_elements, image_size,
+                                   num_scalar_iterations, samples);
+                print_conversion(format_name, "pack scalar", samples, num_scalar_iterations);
+                measure_conversion(image_format_unpack_scalar, &format, elements, unpacked, num_elements, image_size,
+                                   num_scalar_iterations, samples);
+                print_conversion(format_name, "unpack scalar", samples, num_scalar_iterations);
+            }
+        }
+    }
+
+    free(samples);
+    free(repacked);
+    free(elements);
+    free(unpacked);
+    free(values);
+
+    return 0;
+}
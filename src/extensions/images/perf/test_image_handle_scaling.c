@@ -0,0 +1,427 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_handle_scaling
+ * Scope: Performance
+ *
+ * Purpose: Measures the latency of creating and destroying samplers and
+ * images as the number of live handles grows up to the limits advertised by
+ * the agent, to find handle tables whose cost per call grows with the number
+ * of handles.
+ *
+ * Test Description:
+ * 1) For each agent that supports the images extension, query
+ * HSA_EXT_AGENT_INFO_MAX_SAMPLER_HANDLERS,
+ * HSA_EXT_AGENT_INFO_MAX_IMAGE_RD_HANDLES and
+ * HSA_EXT_AGENT_INFO_MAX_IMAGE_RORW_HANDLES, skipping the agent if a query
+ * fails. Each limit is capped at IMAGE_HANDLE_LIMIT handles.
+ * 2) For samplers, read-only images and read-write images:
+ *    a) Create handles one at a time up to the limit, timing each create.
+ *    The images are small 2D images which all share one backing buffer.
+ *    b) Try to create one more handle, and report whether it fails.
+ *    c) Destroy the handles in the order they were created, timing each
+ *    destroy.
+ *    d) Repeat IMAGE_HANDLE_ROUNDS times.
+ * 3) Group the calls by the number of live handles, in power of two
+ * buckets, and report the median and 99th percentile latency of each
+ * bucket. Report how the median latency grows with the number of live
+ * handles, and flag it when the median of the largest bucket is more than
+ * IMAGE_HANDLE_SLOWDOWN times the median of the smallest, that is when the
+ * total cost of the handles is super-linear.
+ *
+ * Expected Results: Every handle up to the advertised limits should be
+ * created. The latency of a create and destroy should not depend on the
+ * number of live handles.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <image_utils.h>
+#include <math.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_HANDLE_LIMIT (64 * 1024)
+#define IMAGE_HANDLE_ROUNDS 3
+#define IMAGE_HANDLE_SLOWDOWN 4
+
+// Width and height of the images
+#define IMAGE_HANDLE_IMAGE_SIZE 16
+
+// Buckets of live handles, bucket N holds 2^N to 2^(N+1) - 1 live handles
+#define IMAGE_HANDLE_MAX_BUCKETS 32
+
+// Buckets with fewer calls are not compared
+#define IMAGE_HANDLE_MIN_SAMPLES 8
+
+// The kinds of handles
+typedef enum handle_kind_e {
+    HANDLE_SAMPLER = 0,
+    HANDLE_IMAGE_RO,
+    HANDLE_IMAGE_RW,
+    NUM_HANDLE_KINDS
+} handle_kind_t;
+
+static const char* HANDLE_NAMES[NUM_HANDLE_KINDS] = {"sampler", "read-only image", "read-write image"};
+
+static const int HANDLE_LIMIT_ATTRIBUTES[NUM_HANDLE_KINDS] = {HSA_EXT_AGENT_INFO_MAX_SAMPLER_HANDLERS,
+                                                             HSA_EXT_AGENT_INFO_MAX_IMAGE_RD_HANDLES,
+                                                             HSA_EXT_AGENT_INFO_MAX_IMAGE_RORW_HANDLES};
+
+// What the handles of a kind are created with
+typedef struct handle_args_s {
+    hsa_ext_image_pfn_t* pfn;
+    hsa_agent_t agent;
+    hsa_ext_sampler_descriptor_t sampler_descriptor;
+    hsa_ext_image_descriptor_t image_descriptor;
+    void* image_data;
+} handle_args_t;
+
+// Create a handle of a kind
+static hsa_status_t create_handle(handle_kind_t kind, const handle_args_t* args, uint64_t* handle) {
+    hsa_status_t status;
+    if (HANDLE_SAMPLER == kind) {
+        hsa_ext_sampler_t sampler;
+        status = args->pfn->hsa_ext_sampler_create(args->agent, &args->sampler_descriptor, &sampler);
+        *handle = sampler.handle;
+    } else {
+        hsa_ext_image_t image;
+        status = args->pfn->hsa_ext_image_create(args->agent,
+                                                 &args->image_descriptor,
+                                                 args->image_data,
+                                                 (HANDLE_IMAGE_RO == kind) ? HSA_ACCESS_PERMISSION_RO : HSA_ACCESS_PERMISSION_RW,
+                                                 &image);
+        *handle = image.handle;
+    }
+
+    return status;
+}
+
+// Destroy a handle of a kind
+static hsa_status_t destroy_handle(handle_kind_t kind, const handle_args_t* args, uint64_t handle) {
+    if (HANDLE_SAMPLER == kind) {
+        hsa_ext_sampler_t sampler;
+        sampler.handle = handle;
+        return args->pfn->hsa_ext_sampler_destroy(args->agent, sampler);
+    } else {
+        hsa_ext_image_t image;
+        image.handle = handle;
+        return args->pfn->hsa_ext_image_destroy(args->agent, image);
+    }
+}
+
+// Get the bucket of a number of live handles
+static int get_bucket(uint64_t live) {
+    int bucket = 0;
+    while (live > 1) {
+        live >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+// Print the growth of the median latency of the buckets with enough calls,
+// as the exponent of a power law fit and the ratio of the largest bucket to
+// the smallest
+static void report_growth(const char* name,
+                          const char* operation,
+                          const double* bucket_p50,
+                          const size_t* bucket_count,
+                          int num_buckets,
+                          uint64_t slowdown_limit) {
+    double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+    int first = -1, last = -1, count = 0;
+    int bb;
+    for (bb = 0; bb < num_buckets; ++bb) {
+        if (IMAGE_HANDLE_MIN_SAMPLES > bucket_count[bb] || 0.0 >= bucket_p50[bb]) {
+            continue;
+        }
+        first = (0 > first) ? bb : first;
+        last = bb;
+
+        // The middle of the bucket, on a log scale
+        double x = ((double) bb + 0.5) * log(2.0);
+        double y = log(bucket_p50[bb]);
+        sum_x += x;
+        sum_y += y;
+        sum_xx += x * x;
+        sum_xy += x * y;
+        ++count;
+    }
+
+    if (2 > count) {
+        printf("%s %s: not enough live handle buckets to measure the growth\n", name, operation);
+        return;
+    }
+
+    double exponent = (count * sum_xy - sum_x * sum_y) / (count * sum_xx - sum_x * sum_x);
+    double ratio = bucket_p50[last] / bucket_p50[first];
+    printf("%s %s: median latency grows as live^%.2f, x%.2f from %u to %u live handles%s\n",
+           name, operation, exponent, ratio, 1u << first, 1u << last,
+           (ratio > (double) slowdown_limit) ? ", SUPER-LINEAR" : "");
+
+    return;
+}
+
+int test_image_handle_scaling() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_ext_image_pfn_t pfn;
+    status = get_image_fnc_tbl(&pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t handle_limit = perf_get_env_uint("IMAGE_HANDLE_LIMIT", IMAGE_HANDLE_LIMIT);
+    uint64_t num_rounds = perf_get_env_uint("IMAGE_HANDLE_ROUNDS", IMAGE_HANDLE_ROUNDS);
+    uint64_t slowdown_limit = perf_get_env_uint("IMAGE_HANDLE_SLOWDOWN", IMAGE_HANDLE_SLOWDOWN);
+    ASSERT(0 < handle_limit && 0 < num_rounds);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    int ii;
+    int kind;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t) -1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t) -1 == global_region.handle) {
+            continue;
+        }
+
+        // Skip the agents without image support
+        bool images_supported = false;
+        status = hsa_agent_extension_supported(HSA_EXTENSION_IMAGES, agent_list.agents[ii], 1, 0, &images_supported);
+        if (HSA_STATUS_SUCCESS != status || !images_supported) {
+            continue;
+        }
+
+        uint32_t limits[NUM_HANDLE_KINDS];
+        for (kind = 0; kind < NUM_HANDLE_KINDS; ++kind) {
+            status = hsa_agent_get_info(agent_list.agents[ii], (hsa_agent_info_t) HANDLE_LIMIT_ATTRIBUTES[kind], &limits[kind]);
+            if (HSA_STATUS_SUCCESS != status) {
+                break;
+            }
+        }
+        if (NUM_HANDLE_KINDS != kind) {
+            continue;
+        }
+        printf("\nAgent %d: %u samplers, %u read-only images, %u read-write images, %lu rounds\n",
+               ii, limits[HANDLE_SAMPLER], limits[HANDLE_IMAGE_RO], limits[HANDLE_IMAGE_RW],
+               (unsigned long) num_rounds);
+
+        handle_args_t args;
+        memset(&args, 0, sizeof(handle_args_t));
+        args.pfn = &pfn;
+        args.agent = agent_list.agents[ii];
+        args.sampler_descriptor.coordinate_mode = HSA_EXT_SAMPLER_COORDINATE_MODE_UNNORMALIZED;
+        args.sampler_descriptor.filter_mode = HSA_EXT_SAMPLER_FILTER_MODE_NEAREST;
+        args.sampler_descriptor.address_mode = HSA_EXT_SAMPLER_ADDRESSING_MODE_CLAMP_TO_EDGE;
+        args.image_descriptor.geometry = HSA_EXT_IMAGE_GEOMETRY_2D;
+        args.image_descriptor.width = IMAGE_HANDLE_IMAGE_SIZE;
+        args.image_descriptor.height = IMAGE_HANDLE_IMAGE_SIZE;
+        args.image_descriptor.depth = 1;
+        args.image_descriptor.array_size = 1;
+        args.image_descriptor.format.channel_type = HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8;
+        args.image_descriptor.format.channel_order = HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA;
+
+        // The images of both permissions share one backing buffer, large
+        // enough for either
+        uint32_t capability_mask = 0;
+        status = image_query_cache_get_capability(&pfn, args.agent, args.image_descriptor.geometry,
+                                                  &args.image_descriptor.format, &capability_mask);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        size_t image_size = 0;
+        size_t image_alignment = 0;
+        for (kind = HANDLE_IMAGE_RO; kind <= HANDLE_IMAGE_RW; ++kind) {
+            uint32_t access_capability = (HANDLE_IMAGE_RO == kind) ? HSA_EXT_IMAGE_CAPABILITY_READ_ONLY :
+                                                                     HSA_EXT_IMAGE_CAPABILITY_READ_WRITE;
+            if (0 == (access_capability & capability_mask)) {
+                limits[kind] = 0;
+                printf("%s: %s is not supported\n", HANDLE_NAMES[kind], "UNORM_INT8/RGBA 2D");
+                continue;
+            }
+
+            hsa_ext_image_data_info_t image_info;
+            status = image_query_cache_data_get_info(&pfn, args.agent, &args.image_descriptor,
+                                                     (HANDLE_IMAGE_RO == kind) ? HSA_ACCESS_PERMISSION_RO : HSA_ACCESS_PERMISSION_RW,
+                                                     &image_info);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            image_size = (image_info.size > image_size) ? image_info.size : image_size;
+            image_alignment = (image_info.alignment > image_alignment) ? image_info.alignment : image_alignment;
+        }
+        if (0 < image_size) {
+            size_t region_align;
+            status = hsa_region_get_info(global_region, HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT, &region_align);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            ASSERT(0 == image_alignment || 0 == region_align % image_alignment);
+
+            status = hsa_memory_allocate(global_region, image_size, &args.image_data);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+
+        for (kind = 0; kind < NUM_HANDLE_KINDS; ++kind) {
+            uint64_t num_handles = (limits[kind] < handle_limit) ? limits[kind] : handle_limit;
+            if (0 == num_handles) {
+                continue;
+            }
+
+            // The handles, and the latency of each create and destroy by round
+            // and number of live handles
+            uint64_t* handles = (uint64_t*) malloc(num_handles * sizeof(uint64_t));
+            double* create_ns = (double*) malloc(num_rounds * num_handles * sizeof(double));
+            double* destroy_ns = (double*) malloc(num_rounds * num_handles * sizeof(double));
+            uint64_t* num_created = (uint64_t*) malloc(num_rounds * sizeof(uint64_t));
+            double* samples = (double*) malloc(num_rounds * num_handles * sizeof(double));
+            ASSERT(NULL != handles && NULL != create_ns && NULL != destroy_ns && NULL != num_created && NULL != samples);
+
+            uint64_t rr, mm;
+            for (rr = 0; rr < num_rounds; ++rr) {
+                // Create the handles, the one at index n - 1 is the n-th live handle
+                for (mm = 0; mm < num_handles; ++mm) {
+                    uint64_t start = perf_get_time_ns();
+                    status = create_handle((handle_kind_t) kind, &args, &handles[mm]);
+                    uint64_t elapsed = perf_get_time_ns() - start;
+                    if (HSA_STATUS_SUCCESS != status) {
+                        printf("%s: create failed with status 0x%x at %lu live handles, round %lu\n",
+                               HANDLE_NAMES[kind], status, (unsigned long) mm, (unsigned long) rr);
+                        break;
+                    }
+                    create_ns[rr * num_handles + mm] = (double) elapsed;
+                }
+                num_created[rr] = mm;
+
+                // Try to go past the advertised limit
+                if (0 == rr && num_handles == limits[kind] && mm == num_handles) {
+                    uint64_t extra_handle;
+                    status = create_handle((handle_kind_t) kind, &args, &extra_handle);
+                    if (HSA_STATUS_SUCCESS == status) {
+                        printf("%s: create past the limit of %u handles succeeded\n", HANDLE_NAMES[kind], limits[kind]);
+                        status = destroy_handle((handle_kind_t) kind, &args, extra_handle);
+                        ASSERT(HSA_STATUS_SUCCESS == status);
+                    } else {
+                        printf("%s: create past the limit of %u handles failed with status 0x%x\n",
+                               HANDLE_NAMES[kind], limits[kind], status);
+                    }
+                }
+
+                // Destroy the oldest handle first, with num_created - mm live handles
+                for (mm = 0; mm < num_created[rr]; ++mm) {
+                    uint64_t start = perf_get_time_ns();
+                    status = destroy_handle((handle_kind_t) kind, &args, handles[mm]);
+                    uint64_t elapsed = perf_get_time_ns() - start;
+                    ASSERT(HSA_STATUS_SUCCESS == status);
+                    destroy_ns[rr * num_handles + num_created[rr] - mm - 1] = (double) elapsed;
+                }
+            }
+
+            // The statistics of each bucket of live handles
+            int num_buckets = get_bucket(num_handles) + 1;
+            double bucket_p50[2][IMAGE_HANDLE_MAX_BUCKETS];
+            size_t bucket_count[2][IMAGE_HANDLE_MAX_BUCKETS];
+            printf("%-18s %16s %14s %14s %14s %14s\n", HANDLE_NAMES[kind], "live handles",
+                   "create p50 ns", "create p99 ns", "destroy p50 ns", "destroy p99 ns");
+
+            int bb, op;
+            for (bb = 0; bb < num_buckets; ++bb) {
+                uint64_t bucket_start = (uint64_t) 1 << bb;
+                uint64_t bucket_end = bucket_start * 2;
+                perf_stats_t stats[2];
+                for (op = 0; op < 2; ++op) {
+                    const double* latency_ns = (0 == op) ? create_ns : destroy_ns;
+                    size_t count = 0;
+                    for (rr = 0; rr < num_rounds; ++rr) {
+                        for (mm = bucket_start; mm < bucket_end && mm <= num_created[rr]; ++mm) {
+                            samples[count++] = latency_ns[rr * num_handles + mm - 1];
+                        }
+                    }
+                    memset(&stats[op], 0, sizeof(perf_stats_t));
+                    if (0 < count) {
+                        perf_compute_stats(samples, count, &stats[op]);
+                    }
+                    bucket_p50[op][bb] = stats[op].p50;
+                    bucket_count[op][bb] = count;
+                }
+
+                uint64_t bucket_last = (bucket_end - 1 < num_handles) ? bucket_end - 1 : num_handles;
+                char live[32];
+                snprintf(live, sizeof(live), "%lu-%lu", (unsigned long) bucket_start, (unsigned long) bucket_last);
+                printf("%-18s %16s %14.0f %14.0f %14.0f %14.0f\n", "", live,
+                       stats[0].p50, stats[0].p99, stats[1].p50, stats[1].p99);
+            }
+
+            report_growth(HANDLE_NAMES[kind], "create", bucket_p50[0], bucket_count[0], num_buckets, slowdown_limit);
+            report_growth(HANDLE_NAMES[kind], "destroy", bucket_p50[1], bucket_count[1], num_buckets, slowdown_limit);
+
+            free(samples);
+            free(num_created);
+            free(destroy_ns);
+            free(create_ns);
+            free(handles);
+        }
+
+        if (NULL != args.image_data) {
+            status = hsa_memory_free(args.image_data);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+    }
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
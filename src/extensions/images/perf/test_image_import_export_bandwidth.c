@@ -0,0 +1,365 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_import_export_bandwidth
+ * Scope: Performance
+ *
+ * Purpose: Measures the bandwidth of hsa_ext_image_import and
+ * hsa_ext_image_export for whole images and sub-regions, with tight, padded
+ * and misaligned linear buffers, and compares it with a memcpy and an
+ * hsa_memory_copy of the same number of bytes to expose the tiling and
+ * conversion overheads of the runtime.
+ *
+ * Test Description:
+ * 1) For each agent, find a fine grained global memory region for the image
+ * backing buffers and the linear buffers.
+ * 2) For each format of IMAGE_PERF_FORMATS and each geometry the agent
+ * supports with read write access, and for images of
+ * IMAGE_IMPORT_EXPORT_MIN_TEXELS texels up to IMAGE_IMPORT_EXPORT_MAX_TEXELS
+ * texels in steps of 16x:
+ *    a) Create the image, spreading the texels evenly over its dimensions.
+ *    b) For the whole image, and for a region in its middle with half of
+ *    each of its dimensions:
+ *       i) Time IMAGE_IMPORT_EXPORT_ITERATIONS memcpy calls and
+ *       hsa_memory_copy calls of the number of bytes of the region.
+ *       ii) For tight linear buffers, padded ones whose rows are rounded up
+ *       to 256 bytes plus 256 bytes and whose slices are 4096 bytes longer,
+ *       and misaligned ones that start one element past a 64 byte boundary
+ *       and whose rows and slices are one element longer, time
+ *       IMAGE_IMPORT_EXPORT_ITERATIONS imports and exports of the region.
+ *    c) Report the bandwidth of each, in GB/s of texel data.
+ *
+ * Expected Results: Every import and export should succeed. Imports and
+ * exports of large images should get close to the hsa_memory_copy
+ * bandwidth, the padded and misaligned buffers should not be much slower
+ * than the tight ones.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <image_format_utils.h>
+#include <image_utils.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_IMPORT_EXPORT_MIN_TEXELS (4 * 1024)
+#define IMAGE_IMPORT_EXPORT_MAX_TEXELS (1024 * 1024)
+#define IMAGE_IMPORT_EXPORT_ITERATIONS 10
+
+// Padding of the rows and slices of the padded linear buffers
+#define IMAGE_IMPORT_EXPORT_ROW_ALIGNMENT 256
+#define IMAGE_IMPORT_EXPORT_SLICE_PADDING 4096
+
+// Alignment the misaligned linear buffers start one element past
+#define IMAGE_IMPORT_EXPORT_BUFFER_ALIGNMENT 64
+
+enum {
+    PITCH_TIGHT,
+    PITCH_PADDED,
+    PITCH_MISALIGNED,
+    NUM_PITCHES
+};
+
+static const char* PITCH_NAMES[NUM_PITCHES] = {"tight", "padded", "misaligned"};
+
+enum {
+    TRANSFER_IMPORT,
+    TRANSFER_EXPORT,
+    TRANSFER_MEMCPY,
+    TRANSFER_MEMORY_COPY
+};
+
+// The operands of the transfers of a region
+typedef struct image_transfer_s {
+    hsa_ext_image_pfn_t* pfn;
+    hsa_agent_t agent;
+    hsa_ext_image_t image;
+    const hsa_ext_image_region_t* region;
+    void* linear;
+    size_t row_pitch;
+    size_t slice_pitch;
+    // The source and destination of the memcpy and hsa_memory_copy calls
+    void* src;
+    void* dst;
+    size_t num_bytes;
+} image_transfer_t;
+
+// Get the linear buffer layout of a region for a pitch mode
+static void get_pitches(int pitch,
+                        const hsa_ext_image_region_t* region,
+                        size_t element_size,
+                        size_t* offset,
+                        size_t* row_pitch,
+                        size_t* slice_pitch) {
+    size_t row_size = region->range.x * element_size;
+
+    switch (pitch) {
+        case PITCH_PADDED:
+            *offset = 0;
+            *row_pitch = (row_size + IMAGE_IMPORT_EXPORT_ROW_ALIGNMENT - 1) / IMAGE_IMPORT_EXPORT_ROW_ALIGNMENT *
+                         IMAGE_IMPORT_EXPORT_ROW_ALIGNMENT + IMAGE_IMPORT_EXPORT_ROW_ALIGNMENT;
+            *slice_pitch = *row_pitch * region->range.y + IMAGE_IMPORT_EXPORT_SLICE_PADDING;
+            break;
+        case PITCH_MISALIGNED:
+            *offset = element_size;
+            *row_pitch = row_size + element_size;
+            *slice_pitch = *row_pitch * region->range.y + element_size;
+            break;
+        default:
+            *offset = 0;
+            *row_pitch = row_size;
+            *slice_pitch = row_size * region->range.y;
+            break;
+    }
+
+    return;
+}
+
+// Time the transfers of a region, in GB/s of texel data
+static void measure_transfer(int transfer,
+                             image_transfer_t* args,
+                             uint64_t num_iterations,
+                             double* samples) {
+    hsa_status_t status = HSA_STATUS_SUCCESS;
+    uint64_t ii;
+
+    // The first transfer warms up the caches and the page tables, and is
+    // not timed
+    for (ii = 0; ii <= num_iterations; ++ii) {
+        uint64_t start = perf_get_time_ns();
+        switch (transfer) {
+            case TRANSFER_IMPORT:
+                status = args->pfn->hsa_ext_image_import(args->agent, args->linear, args->row_pitch,
+                                                         args->slice_pitch, args->image, args->region);
+                break;
+            case TRANSFER_EXPORT:
+                status = args->pfn->hsa_ext_image_export(args->agent, args->image, args->linear, args->row_pitch,
+                                                         args->slice_pitch, args->region);
+                break;
+            case TRANSFER_MEMCPY:
+                memcpy(args->dst, args->src, args->num_bytes);
+                break;
+            default:
+                status = hsa_memory_copy(args->dst, args->src, args->num_bytes);
+                break;
+        }
+        uint64_t elapsed = perf_get_time_ns() - start;
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        if (0 < ii) {
+            samples[ii - 1] = (double) args->num_bytes / (double) ((0 == elapsed) ? 1 : elapsed);
+        }
+    }
+
+    return;
+}
+
+// Print the statistics of a set of bandwidth samples
+static void print_transfer(const char* case_name,
+                           const char* mode,
+                           double* samples,
+                           uint64_t num_samples) {
+    char label[96];
+    perf_stats_t stats;
+
+    snprintf(label, sizeof(label), "%s %s", case_name, mode);
+    perf_compute_stats(samples, num_samples, &stats);
+    perf_print_stats(label, "GB/s", &stats);
+
+    return;
+}
+
+int test_image_import_export_bandwidth() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_ext_image_pfn_t pfn;
+    status = get_image_fnc_tbl(&pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t min_texels = perf_get_env_uint("IMAGE_IMPORT_EXPORT_MIN_TEXELS", IMAGE_IMPORT_EXPORT_MIN_TEXELS);
+    uint64_t max_texels = perf_get_env_uint("IMAGE_IMPORT_EXPORT_MAX_TEXELS", IMAGE_IMPORT_EXPORT_MAX_TEXELS);
+    uint64_t num_iterations = perf_get_env_uint("IMAGE_IMPORT_EXPORT_ITERATIONS", IMAGE_IMPORT_EXPORT_ITERATIONS);
+    ASSERT(0 < min_texels && min_texels <= max_texels && 0 < num_iterations);
+
+    double* samples = (double*) malloc(num_iterations * sizeof(double));
+    ASSERT(NULL != samples);
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    int ii;
+    uint32_t jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        hsa_region_t global_region;
+        global_region.handle = (uint64_t) -1;
+        hsa_agent_iterate_regions(agent_list.agents[ii], get_global_memory_region_fine_grained, &global_region);
+        if ((uint64_t) -1 == global_region.handle) {
+            continue;
+        }
+
+        printf("\nAgent %d: image import/export, %lu to %lu texels, %lu iterations\n",
+               ii, (unsigned long) min_texels, (unsigned long) max_texels, (unsigned long) num_iterations);
+
+        for (jj = 0; jj < IMAGE_PERF_NUM_FORMATS; ++jj) {
+            const hsa_ext_image_format_t* format = &IMAGE_PERF_FORMATS[jj].format;
+            size_t element_size = image_format_get_element_size(format);
+
+            for (kk = 0; kk < IMAGE_PERF_NUM_GEOMETRIES; ++kk) {
+                hsa_ext_image_geometry_t geometry = IMAGE_PERF_GEOMETRIES[kk].geometry;
+                if (!image_perf_is_supported(&pfn, agent_list.agents[ii], format, geometry)) {
+                    continue;
+                }
+
+                uint64_t num_texels;
+                for (num_texels = min_texels; num_texels <= max_texels; num_texels *= 16) {
+                    hsa_ext_image_descriptor_t descriptor;
+                    image_perf_init_descriptor(agent_list.agents[ii], format, geometry, num_texels, &descriptor);
+
+                    hsa_ext_image_t image;
+                    void* image_data;
+                    status = image_perf_create_image(&pfn, agent_list.agents[ii], global_region, &descriptor,
+                                                     &image, &image_data);
+                    ASSERT(HSA_STATUS_SUCCESS == status);
+
+                    // The largest linear buffer is the padded one of the whole image
+                    hsa_ext_image_region_t region;
+                    image_perf_get_region(&descriptor, 1, &region);
+                    size_t offset, row_pitch, slice_pitch;
+                    get_pitches(PITCH_PADDED, &region, element_size, &offset, &row_pitch, &slice_pitch);
+                    size_t linear_size = slice_pitch * region.range.z + IMAGE_IMPORT_EXPORT_BUFFER_ALIGNMENT;
+                    uint64_t image_texels = image_perf_get_region_texels(&region);
+
+                    // The linear buffer, and the buffers of the memcpy and hsa_memory_copy calls
+                    char* linear;
+                    void* copy_dst;
+                    status = hsa_memory_allocate(global_region, linear_size, (void**) &linear);
+                    ASSERT(HSA_STATUS_SUCCESS == status);
+                    status = hsa_memory_allocate(global_region, linear_size, &copy_dst);
+                    ASSERT(HSA_STATUS_SUCCESS == status);
+                    void* host_src = malloc(linear_size);
+                    void* host_dst = malloc(linear_size);
+                    ASSERT(NULL != host_src && NULL != host_dst);
+                    memset(linear, 0x5a, linear_size);
+                    memset(host_src, 0x5a, linear_size);
+                    memset(host_dst, 0, linear_size);
+
+                    // The divisor 1 is the whole image, 2 the region in its middle
+                    uint32_t divisor;
+                    for (divisor = 1; divisor <= 2; ++divisor) {
+                        image_perf_get_region(&descriptor, divisor, &region);
+
+                        image_transfer_t args;
+                        args.pfn = &pfn;
+                        args.agent = agent_list.agents[ii];
+                        args.image = image;
+                        args.region = &region;
+                        args.num_bytes = image_perf_get_region_texels(&region) * element_size;
+
+                        char case_name[80];
+                        snprintf(case_name, sizeof(case_name), "%s %s %lux%lux%lu %s",
+                                 IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name,
+                                 (unsigned long) region.range.x, (unsigned long) region.range.y,
+                                 (unsigned long) region.range.z, (1 == divisor) ? "full" : "region");
+
+                        args.src = host_src;
+                        args.dst = host_dst;
+                        measure_transfer(TRANSFER_MEMCPY, &args, num_iterations, samples);
+                        print_transfer(case_name, "memcpy", samples, num_iterations);
+
+                        args.src = linear;
+                        args.dst = copy_dst;
+                        measure_transfer(TRANSFER_MEMORY_COPY, &args, num_iterations, samples);
+                        print_transfer(case_name, "hsa_memory_copy", samples, num_iterations);
+
+                        int pitch;
+                        for (pitch = 0; pitch < NUM_PITCHES; ++pitch) {
+                            get_pitches(pitch, &region, element_size, &offset, &args.row_pitch, &args.slice_pitch);
+                            // The allocations are at least 64 byte aligned
+                            args.linear = linear + offset;
+
+                            char mode[32];
+                            snprintf(mode, sizeof(mode), "%s import", PITCH_NAMES[pitch]);
+                            measure_transfer(TRANSFER_IMPORT, &args, num_iterations, samples);
+                            print_transfer(case_name, mode, samples, num_iterations);
+
+                            snprintf(mode, sizeof(mode), "%s export", PITCH_NAMES[pitch]);
+                            measure_transfer(TRANSFER_EXPORT, &args, num_iterations, samples);
+                            print_transfer(case_name, mode, samples, num_iterations);
+                        }
+                    }
+
+                    free(host_dst);
+                    free(host_src);
+                    hsa_memory_free(copy_dst);
+                    hsa_memory_free(linear);
+                    image_perf_destroy_image(&pfn, agent_list.agents[ii], image, image_data);
+
+                    // Stop once the image is as large as the agent allows
+                    if (image_texels * 2 < num_texels) {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    free(samples);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
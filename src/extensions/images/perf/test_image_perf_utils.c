@@ -0,0 +1,315 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <framework.h>
+#include <image_utils.h>
+#include <math.h>
+#include <stdlib.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_PERF_FORMAT(__type__, __order__) \
+    { { HSA_EXT_IMAGE_CHANNEL_TYPE_##__type__, HSA_EXT_IMAGE_CHANNEL_ORDER_##__order__ }, #__type__ "/" #__order__ }
+
+#define IMAGE_PERF_GEOMETRY(__geometry__) \
+    { HSA_EXT_IMAGE_GEOMETRY_##__geometry__, #__geometry__ }
+
+const image_perf_format_t IMAGE_PERF_FORMATS[] = {
+    IMAGE_PERF_FORMAT(UNORM_INT8, R),
+    IMAGE_PERF_FORMAT(UNORM_SHORT_565, RGB),
+    IMAGE_PERF_FORMAT(UNORM_INT8, RGBA),
+    IMAGE_PERF_FORMAT(UNSIGNED_INT32, R),
+    IMAGE_PERF_FORMAT(HALF_FLOAT, RGBA),
+    IMAGE_PERF_FORMAT(FLOAT, RGBA),
+    IMAGE_PERF_FORMAT(UNORM_INT16, DEPTH),
+    IMAGE_PERF_FORMAT(UNORM_INT24, DEPTH_STENCIL)
+};
+
+const uint32_t IMAGE_PERF_NUM_FORMATS = sizeof(IMAGE_PERF_FORMATS) / sizeof(IMAGE_PERF_FORMATS[0]);
+
+const image_perf_geometry_t IMAGE_PERF_GEOMETRIES[] = {
+    IMAGE_PERF_GEOMETRY(1D),
+    IMAGE_PERF_GEOMETRY(1DA),
+    IMAGE_PERF_GEOMETRY(1DB),
+    IMAGE_PERF_GEOMETRY(2D),
+    IMAGE_PERF_GEOMETRY(2DA),
+    IMAGE_PERF_GEOMETRY(2DDEPTH),
+    IMAGE_PERF_GEOMETRY(2DADEPTH),
+    IMAGE_PERF_GEOMETRY(3D)
+};
+
+const uint32_t IMAGE_PERF_NUM_GEOMETRIES = sizeof(IMAGE_PERF_GEOMETRIES) / sizeof(IMAGE_PERF_GEOMETRIES[0]);
+
+// Check if the geometry has layers
+static int is_array_geometry(hsa_ext_image_geometry_t geometry) {
+    return HSA_EXT_IMAGE_GEOMETRY_1DA == geometry ||
+           HSA_EXT_IMAGE_GEOMETRY_2DA == geometry ||
+           HSA_EXT_IMAGE_GEOMETRY_2DADEPTH == geometry;
+}
+
+int image_perf_is_supported(hsa_ext_image_pfn_t* pfn,
+                            hsa_agent_t agent,
+                            const hsa_ext_image_format_t* format,
+                            hsa_ext_image_geometry_t geometry) {
+    // The depth formats are only valid with the depth geometries, and the
+    // depth geometries only with them
+    int is_depth_format = HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH == format->channel_order ||
+                          HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH_STENCIL == format->channel_order;
+    int is_depth_geometry = HSA_EXT_IMAGE_GEOMETRY_2DDEPTH == geometry ||
+                            HSA_EXT_IMAGE_GEOMETRY_2DADEPTH == geometry;
+    if (is_depth_format != is_depth_geometry) {
+        return 0;
+    }
+
+    uint32_t capability_mask = 0;
+    hsa_status_t status = image_query_cache_get_capability(pfn, agent, geometry, format, &capability_mask);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return 0 != (HSA_EXT_IMAGE_CAPABILITY_READ_WRITE & capability_mask);
+}
+
+void image_perf_init_descriptor(hsa_agent_t agent,
+                                const hsa_ext_image_format_t* format,
+                                hsa_ext_image_geometry_t geometry,
+                                uint64_t num_texels,
+                                hsa_ext_image_descriptor_t* descriptor) {
+    int image_dimension = 0;
+    uint32_t max_elements[3];
+    char* validation_kernel;
+    get_geometry_info(agent, (hsa_ext_image_format_t*) format, geometry, &image_dimension, max_elements, &validation_kernel);
+
+    uint32_t array_size = 1;
+    if (is_array_geometry(geometry)) {
+        uint32_t max_layers = 0;
+        hsa_status_t status = hsa_agent_get_info(agent, (hsa_agent_info_t) HSA_EXT_AGENT_INFO_IMAGE_ARRAY_MAX_LAYERS, &max_layers);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        array_size = (IMAGE_PERF_ARRAY_SIZE < max_layers) ? IMAGE_PERF_ARRAY_SIZE : max_layers;
+        array_size = (0 < array_size) ? array_size : 1;
+        num_texels /= array_size;
+    }
+
+    // The edge of a square or a cube with the number of texels
+    uint64_t edge = num_texels;
+    if (2 == image_dimension) {
+        edge = (uint64_t) sqrt((double) num_texels);
+    } else if (3 == image_dimension) {
+        edge = (uint64_t) cbrt((double) num_texels);
+    }
+    edge = (0 < edge) ? edge : 1;
+
+    int ii;
+    size_t extent[3] = {1, 1, 1};
+    for (ii = 0; ii < image_dimension; ++ii) {
+        extent[ii] = (edge < max_elements[ii]) ? edge : max_elements[ii];
+    }
+
+    descriptor->geometry = geometry;
+    descriptor->width = extent[0];
+    descriptor->height = extent[1];
+    descriptor->depth = extent[2];
+    descriptor->array_size = array_size;
+    descriptor->format = *format;
+
+    return;
+}
+
+// Get the extent of each coordinate of an image region. The layers are the
+// y coordinate of the 1DA images, and the z coordinate of the 2DA images.
+static void get_region_extent(const hsa_ext_image_descriptor_t* descriptor,
+                              uint32_t* extent,
+                              int* is_layer) {
+    extent[0] = (uint32_t) descriptor->width;
+    extent[1] = (uint32_t) descriptor->height;
+    extent[2] = (uint32_t) descriptor->depth;
+    is_layer[0] = is_layer[1] = is_layer[2] = 0;
+    if (HSA_EXT_IMAGE_GEOMETRY_1DA == descriptor->geometry) {
+        extent[1] = (uint32_t) descriptor->array_size;
+        is_layer[1] = 1;
+    } else if (HSA_EXT_IMAGE_GEOMETRY_2DA == descriptor->geometry ||
+               HSA_EXT_IMAGE_GEOMETRY_2DADEPTH == descriptor->geometry) {
+        extent[2] = (uint32_t) descriptor->array_size;
+        is_layer[2] = 1;
+    }
+
+    int ii;
+    for (ii = 0; ii < 3; ++ii) {
+        extent[ii] = (0 < extent[ii]) ? extent[ii] : 1;
+    }
+
+    return;
+}
+
+void image_perf_get_region(const hsa_ext_image_descriptor_t* descriptor,
+                           uint32_t divisor,
+                           hsa_ext_image_region_t* region) {
+    uint32_t extent[3];
+    int is_layer[3];
+    get_region_extent(descriptor, extent, is_layer);
+
+    uint32_t range[3];
+    uint32_t offset[3];
+    int ii;
+    for (ii = 0; ii < 3; ++ii) {
+        range[ii] = is_layer[ii] ? extent[ii] : extent[ii] / divisor;
+        range[ii] = (0 < range[ii]) ? range[ii] : 1;
+        offset[ii] = (extent[ii] - range[ii]) / 2;
+    }
+
+    region->offset.x = offset[0];
+    region->offset.y = offset[1];
+    region->offset.z = offset[2];
+    region->range.x = range[0];
+    region->range.y = range[1];
+    region->range.z = range[2];
+
+    return;
+}
+
+void image_perf_get_sized_region(const hsa_ext_image_descriptor_t* descriptor,
+                                 uint64_t num_texels,
+                                 hsa_ext_image_region_t* region) {
+    uint32_t extent[3];
+    int is_layer[3];
+    get_region_extent(descriptor, extent, is_layer);
+
+    // Whole layers first, when there are more texels than a layer holds
+    uint64_t layer_texels = 1;
+    int num_dimensions = 0;
+    int ii;
+    for (ii = 0; ii < 3; ++ii) {
+        if (!is_layer[ii] && 1 < extent[ii]) {
+            layer_texels *= extent[ii];
+            ++num_dimensions;
+        }
+    }
+
+    uint32_t range[3] = {1, 1, 1};
+    uint64_t remaining = num_texels;
+    for (ii = 0; ii < 3; ++ii) {
+        if (is_layer[ii] && remaining > layer_texels) {
+            range[ii] = (uint32_t) (remaining / layer_texels);
+            range[ii] = (range[ii] < extent[ii]) ? range[ii] : extent[ii];
+            remaining = layer_texels;
+        }
+    }
+
+    // Then spread the texels of a layer evenly over its dimensions
+    for (ii = 0; ii < 3; ++ii) {
+        if (is_layer[ii] || 1 == extent[ii]) {
+            continue;
+        }
+        uint64_t edge = (uint64_t) (pow((double) remaining, 1.0 / num_dimensions) + 0.5);
+        edge = (0 < edge) ? edge : 1;
+        edge = (edge < extent[ii]) ? edge : extent[ii];
+        range[ii] = (uint32_t) edge;
+        remaining = (remaining + edge - 1) / edge;
+        --num_dimensions;
+    }
+
+    region->offset.x = 0;
+    region->offset.y = 0;
+    region->offset.z = 0;
+    region->range.x = range[0];
+    region->range.y = range[1];
+    region->range.z = range[2];
+
+    return;
+}
+
+uint64_t image_perf_get_region_texels(const hsa_ext_image_region_t* region) {
+    return (uint64_t) region->range.x * region->range.y * region->range.z;
+}
+
+hsa_status_t image_perf_create_image(hsa_ext_image_pfn_t* pfn,
+                                     hsa_agent_t agent,
+                                     hsa_region_t region,
+                                     const hsa_ext_image_descriptor_t* descriptor,
+                                     hsa_ext_image_t* image,
+                                     void** image_data) {
+    hsa_ext_image_data_info_t image_info;
+    hsa_status_t status;
+
+    status = image_query_cache_data_get_info(pfn, agent, descriptor, HSA_ACCESS_PERMISSION_RW, &image_info);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    // The runtime allocation alignment has to be enough for the image data
+    size_t region_align;
+    status = hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT, &region_align);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+    if (0 != image_info.alignment && (region_align < image_info.alignment || 0 != region_align % image_info.alignment)) {
+        return HSA_STATUS_ERROR_INVALID_ALLOCATION;
+    }
+
+    status = hsa_memory_allocate(region, image_info.size, image_data);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    status = pfn->hsa_ext_image_create(agent, descriptor, *image_data, HSA_ACCESS_PERMISSION_RW, image);
+    if (HSA_STATUS_SUCCESS != status) {
+        hsa_memory_free(*image_data);
+        *image_data = NULL;
+    }
+
+    return status;
+}
+
+void image_perf_destroy_image(hsa_ext_image_pfn_t* pfn,
+                              hsa_agent_t agent,
+                              hsa_ext_image_t image,
+                              void* image_data) {
+    hsa_status_t status = pfn->hsa_ext_image_destroy(agent, image);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    status = hsa_memory_free(image_data);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return;
+}
@@ -0,0 +1,129 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+#ifndef _TEST_IMAGE_PERF_UTILS_H_
+#define _TEST_IMAGE_PERF_UTILS_H_
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <image_utils.h>
+#include <stdint.h>
+
+// Number of layers of the images with an array geometry
+#define IMAGE_PERF_ARRAY_SIZE 4
+
+// A format of the image benchmarks
+typedef struct image_perf_format_s {
+    hsa_ext_image_format_t format;
+    const char* name;
+} image_perf_format_t;
+
+// A geometry of the image benchmarks
+typedef struct image_perf_geometry_s {
+    hsa_ext_image_geometry_t geometry;
+    const char* name;
+} image_perf_geometry_t;
+
+// Formats with 1 to 16 byte elements: 8, 16 and 32 bit channels, packed
+// channels and floating point channels, and the depth formats of the depth
+// geometries
+extern const image_perf_format_t IMAGE_PERF_FORMATS[];
+extern const uint32_t IMAGE_PERF_NUM_FORMATS;
+
+// Every image geometry
+extern const image_perf_geometry_t IMAGE_PERF_GEOMETRIES[];
+extern const uint32_t IMAGE_PERF_NUM_GEOMETRIES;
+
+// Check if the format and geometry are a valid combination, and the agent
+// supports images of them with read write access. The capability is queried
+// through the image query cache.
+int image_perf_is_supported(hsa_ext_image_pfn_t* pfn,
+                            hsa_agent_t agent,
+                            const hsa_ext_image_format_t* format,
+                            hsa_ext_image_geometry_t geometry);
+
+// Fill in the descriptor of an image with about num_texels texels, spread
+// evenly over the dimensions of the geometry and clamped to the maximum
+// size of the agent. The array geometries have IMAGE_PERF_ARRAY_SIZE layers.
+void image_perf_init_descriptor(hsa_agent_t agent,
+                                const hsa_ext_image_format_t* format,
+                                hsa_ext_image_geometry_t geometry,
+                                uint64_t num_texels,
+                                hsa_ext_image_descriptor_t* descriptor);
+
+// Get a region in the middle of the image, with 1 / divisor of each of its
+// dimensions and all of its layers. A divisor of 1 gives the whole image.
+void image_perf_get_region(const hsa_ext_image_descriptor_t* descriptor,
+                           uint32_t divisor,
+                           hsa_ext_image_region_t* region);
+
+// Get a region at the origin of the image with about num_texels texels, up
+// to the whole image. The region covers whole layers of the array geometries
+// before it covers more than one, and spreads its texels evenly over the
+// dimensions of a layer.
+void image_perf_get_sized_region(const hsa_ext_image_descriptor_t* descriptor,
+                                 uint64_t num_texels,
+                                 hsa_ext_image_region_t* region);
+
+// Get the number of texels of a region
+uint64_t image_perf_get_region_texels(const hsa_ext_image_region_t* region);
+
+// Allocate the backing buffer of an image from a memory region, and create
+// the image with read write access. The data info is queried through the
+// image query cache.
+hsa_status_t image_perf_create_image(hsa_ext_image_pfn_t* pfn,
+                                     hsa_agent_t agent,
+                                     hsa_region_t region,
+                                     const hsa_ext_image_descriptor_t* descriptor,
+                                     hsa_ext_image_t* image,
+                                     void** image_data);
+
+// Destroy an image and free its backing buffer
+void image_perf_destroy_image(hsa_ext_image_pfn_t* pfn,
+                              hsa_agent_t agent,
+                              hsa_ext_image_t image,
+                              void* image_data);
+
+#endif  // _TEST_IMAGE_PERF_UTILS_H_
@@ -0,0 +1,298 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+/*
+ * Test Name: image_query_latency
+ * Scope: Performance
+ *
+ * Purpose: Measures the time per call of hsa_ext_image_get_capability and
+ * hsa_ext_image_data_get_info, which are called for every image created, and
+ * of the same queries answered by the image query cache of image_utils.
+ *
+ * Test Description:
+ * 1) Empty the image query cache.
+ * 2) For each agent, each format of IMAGE_PERF_FORMATS and each geometry:
+ *    a) Time IMAGE_QUERY_ITERATIONS batches of IMAGE_QUERY_BATCH calls to
+ *    hsa_ext_image_get_capability, then to the cached capability query, and
+ *    report the median time per call of each.
+ *    b) If the agent supports the format and geometry with read write access,
+ *    do the same with hsa_ext_image_data_get_info for an image of about
+ *    IMAGE_QUERY_TEXELS texels.
+ * 3) Report the statistics of the median times per call of each query over
+ * all of the formats and geometries.
+ * 4) Time the cached data info query of IMAGE_QUERY_DESCRIPTORS images of
+ * different widths, as for the textures of an application, once when they
+ * miss the cache and once when they hit it.
+ * 5) Report the hits, misses and overflows of the cache.
+ *
+ * Expected Results: Every query should succeed. The cached queries should
+ * take a small fraction of the time of the runtime queries, also when
+ * several threads query the cache, since they take no lock. When
+ * IMAGE_QUERY_CACHE_CHECK is set, every cached result is checked against a
+ * fresh call to the runtime, and the cached times include that call.
+ */
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <framework.h>
+#include <image_utils.h>
+#include <perf_utils.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test_image_perf_utils.h"
+
+#define IMAGE_QUERY_ITERATIONS 100
+#define IMAGE_QUERY_BATCH 100
+#define IMAGE_QUERY_TEXELS (64 * 1024)
+#define IMAGE_QUERY_DESCRIPTORS 256
+
+// The queries timed by the benchmark
+typedef enum query_e {
+    QUERY_CAPABILITY = 0,
+    QUERY_CACHED_CAPABILITY,
+    QUERY_DATA_INFO,
+    QUERY_CACHED_DATA_INFO,
+    NUM_QUERIES
+} query_t;
+
+static const char* QUERY_NAMES[NUM_QUERIES] = {"get_capability", "cached get_capability",
+                                               "data_get_info", "cached data_get_info"};
+
+// Call a query for the format and geometry of a descriptor
+static hsa_status_t run_query(query_t query,
+                              hsa_ext_image_pfn_t* pfn,
+                              hsa_agent_t agent,
+                              const hsa_ext_image_descriptor_t* descriptor) {
+    uint32_t capability_mask;
+    hsa_ext_image_data_info_t image_info;
+
+    switch (query) {
+        case QUERY_CAPABILITY:
+            return pfn->hsa_ext_image_get_capability(agent, descriptor->geometry, &descriptor->format, &capability_mask);
+        case QUERY_CACHED_CAPABILITY:
+            return image_query_cache_get_capability(pfn, agent, descriptor->geometry, &descriptor->format, &capability_mask);
+        case QUERY_DATA_INFO:
+            return pfn->hsa_ext_image_data_get_info(agent, descriptor, HSA_ACCESS_PERMISSION_RW, &image_info);
+        case QUERY_CACHED_DATA_INFO:
+            return image_query_cache_data_get_info(pfn, agent, descriptor, HSA_ACCESS_PERMISSION_RW, &image_info);
+        default:
+            return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+}
+
+// Time batches of calls to a query, and return the median time per call in ns
+static double time_query(query_t query,
+                         hsa_ext_image_pfn_t* pfn,
+                         hsa_agent_t agent,
+                         const hsa_ext_image_descriptor_t* descriptor,
+                         double* samples,
+                         uint64_t num_iterations,
+                         uint64_t batch_size) {
+    hsa_status_t status;
+
+    // The first call is not timed, it fills the cache of the cached queries
+    status = run_query(query, pfn, agent, descriptor);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t mm, nn;
+    for (mm = 0; mm < num_iterations; ++mm) {
+        uint64_t start = perf_get_time_ns();
+        for (nn = 0; nn < batch_size; ++nn) {
+            status = run_query(query, pfn, agent, descriptor);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        samples[mm] = (double) (perf_get_time_ns() - start) / (double) batch_size;
+    }
+
+    perf_stats_t stats;
+    perf_compute_stats(samples, num_iterations, &stats);
+
+    return stats.p50;
+}
+
+int test_image_query_latency() {
+    hsa_status_t status;
+    status = hsa_init();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    hsa_ext_image_pfn_t pfn;
+    status = get_image_fnc_tbl(&pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint64_t num_iterations = perf_get_env_uint("IMAGE_QUERY_ITERATIONS", IMAGE_QUERY_ITERATIONS);
+    uint64_t batch_size = perf_get_env_uint("IMAGE_QUERY_BATCH", IMAGE_QUERY_BATCH);
+    uint64_t image_texels = perf_get_env_uint("IMAGE_QUERY_TEXELS", IMAGE_QUERY_TEXELS);
+    uint64_t num_descriptors = perf_get_env_uint("IMAGE_QUERY_DESCRIPTORS", IMAGE_QUERY_DESCRIPTORS);
+    ASSERT(0 < num_iterations && 0 < batch_size && 0 < image_texels && 0 < num_descriptors);
+
+    // The samples of a query, and the median time per call of each query for
+    // each format and geometry
+    uint32_t max_combinations = IMAGE_PERF_NUM_FORMATS * IMAGE_PERF_NUM_GEOMETRIES;
+    size_t num_samples = (num_iterations > num_descriptors) ? num_iterations : num_descriptors;
+    double* samples = (double*) malloc(num_samples * sizeof(double));
+    double* medians = (double*) malloc(NUM_QUERIES * max_combinations * sizeof(double));
+    ASSERT(NULL != samples && NULL != medians);
+
+    image_query_cache_reset();
+
+    struct agent_list_s agent_list;
+    get_agent_list(&agent_list);
+
+    int ii;
+    uint32_t jj, kk;
+    for (ii = 0; ii < agent_list.num_agents; ++ii) {
+        printf("\nAgent %d: image queries, %lu iterations of %lu calls\n",
+               ii, (unsigned long) num_iterations, (unsigned long) batch_size);
+
+        uint32_t num_combinations[NUM_QUERIES] = {0, 0, 0, 0};
+        hsa_ext_image_descriptor_t sweep_descriptor;
+        int has_sweep_descriptor = 0;
+
+        for (jj = 0; jj < IMAGE_PERF_NUM_FORMATS; ++jj) {
+            const hsa_ext_image_format_t* format = &IMAGE_PERF_FORMATS[jj].format;
+            for (kk = 0; kk < IMAGE_PERF_NUM_GEOMETRIES; ++kk) {
+                hsa_ext_image_geometry_t geometry = IMAGE_PERF_GEOMETRIES[kk].geometry;
+
+                hsa_ext_image_descriptor_t descriptor;
+                memset(&descriptor, 0, sizeof(hsa_ext_image_descriptor_t));
+                descriptor.geometry = geometry;
+                descriptor.format = *format;
+
+                // The capability can be queried for any format and geometry
+                int query;
+                double median_ns[NUM_QUERIES];
+                for (query = QUERY_CAPABILITY; query <= QUERY_CACHED_CAPABILITY; ++query) {
+                    median_ns[query] = time_query((query_t) query, &pfn, agent_list.agents[ii], &descriptor,
+                                                  samples, num_iterations, batch_size);
+                    medians[query * max_combinations + num_combinations[query]++] = median_ns[query];
+                }
+
+                if (!image_perf_is_supported(&pfn, agent_list.agents[ii], format, geometry)) {
+                    printf("%s %s: capability %.0f ns, cached %.0f ns\n",
+                           IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name,
+                           median_ns[QUERY_CAPABILITY], median_ns[QUERY_CACHED_CAPABILITY]);
+                    continue;
+                }
+
+                image_perf_init_descriptor(agent_list.agents[ii], format, geometry, image_texels, &descriptor);
+                for (query = QUERY_DATA_INFO; query <= QUERY_CACHED_DATA_INFO; ++query) {
+                    median_ns[query] = time_query((query_t) query, &pfn, agent_list.agents[ii], &descriptor,
+                                                  samples, num_iterations, batch_size);
+                    medians[query * max_combinations + num_combinations[query]++] = median_ns[query];
+                }
+
+                printf("%s %s: capability %.0f ns, cached %.0f ns, data info %.0f ns, cached %.0f ns\n",
+                       IMAGE_PERF_FORMATS[jj].name, IMAGE_PERF_GEOMETRIES[kk].name,
+                       median_ns[QUERY_CAPABILITY], median_ns[QUERY_CACHED_CAPABILITY],
+                       median_ns[QUERY_DATA_INFO], median_ns[QUERY_CACHED_DATA_INFO]);
+
+                // Sweep the widths of the widest supported image
+                if (!has_sweep_descriptor || descriptor.width > sweep_descriptor.width) {
+                    sweep_descriptor = descriptor;
+                    has_sweep_descriptor = 1;
+                }
+            }
+        }
+
+        // The median times per call over all of the formats and geometries
+        int query;
+        for (query = 0; query < NUM_QUERIES; ++query) {
+            if (0 == num_combinations[query]) {
+                continue;
+            }
+            perf_stats_t stats;
+            perf_compute_stats(&medians[query * max_combinations], num_combinations[query], &stats);
+            perf_print_stats(QUERY_NAMES[query], "ns", &stats);
+        }
+
+        if (!has_sweep_descriptor || 1 >= sweep_descriptor.width) {
+            continue;
+        }
+
+        // The data info of images of many widths, once when the queries miss
+        // the cache, once when they hit it. Only the width timed above is
+        // cached yet, the sweep starts with the next smaller one.
+        size_t max_width = sweep_descriptor.width - 1;
+        uint64_t sweep_count = (num_descriptors < max_width) ? num_descriptors : max_width;
+        int pass;
+        for (pass = 0; pass < 2; ++pass) {
+            uint64_t mm;
+            for (mm = 0; mm < sweep_count; ++mm) {
+                sweep_descriptor.width = max_width - mm;
+                uint64_t start = perf_get_time_ns();
+                status = run_query(QUERY_CACHED_DATA_INFO, &pfn, agent_list.agents[ii], &sweep_descriptor);
+                uint64_t elapsed = perf_get_time_ns() - start;
+                ASSERT(HSA_STATUS_SUCCESS == status);
+                samples[mm] = (double) elapsed;
+            }
+
+            char label[96];
+            perf_stats_t stats;
+            snprintf(label, sizeof(label), "cached data_get_info %s, %lu widths",
+                     (0 == pass) ? "miss" : "hit", (unsigned long) sweep_count);
+            perf_compute_stats(samples, sweep_count, &stats);
+            perf_print_stats(label, "ns", &stats);
+        }
+    }
+
+    image_query_cache_counters_t counters;
+    image_query_cache_get_counters(&counters);
+    printf("\nImage query cache: %lu hits, %lu misses, %lu overflows\n",
+           (unsigned long) counters.hits, (unsigned long) counters.misses, (unsigned long) counters.overflows);
+
+    free(medians);
+    free(samples);
+
+    status = hsa_shut_down();
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    free_agent_list(&agent_list);
+
+    return 0;
+}
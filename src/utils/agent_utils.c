@@ -401,6 +401,18 @@ hsa_status_t get_group_memory_region(hsa_region_t region, void* data) {
     return HSA_STATUS_SUCCESS;
 }
 
+hsa_status_t get_private_memory_region(hsa_region_t region, void* data) {
+    hsa_region_segment_t segment;
+    hsa_region_get_info(region, HSA_REGION_INFO_SEGMENT, &segment);
+    if (HSA_REGION_SEGMENT_PRIVATE == segment) {
+        hsa_region_t* ret = (hsa_region_t*) data;
+        *ret = region;
+        return HSA_STATUS_INFO_BREAK;
+    }
+
+    return HSA_STATUS_SUCCESS;
+}
+
 hsa_status_t get_global_memory_region(hsa_region_t region, void* data) {
     hsa_region_segment_t segment;
     hsa_region_get_info(region, HSA_REGION_INFO_SEGMENT, &segment);
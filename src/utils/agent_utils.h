@@ -103,6 +103,9 @@ hsa_status_t get_kernarg_memory_region(hsa_region_t region, void* data);
 // Callback to acquire a group memory region associated with the agent
 hsa_status_t get_group_memory_region(hsa_region_t region, void* data);
 
+// Callback to acquire a private memory region associated with the agent
+hsa_status_t get_private_memory_region(hsa_region_t region, void* data);
+
 // Callback to acquire a global memory region associated with the agent
 hsa_status_t get_global_memory_region(hsa_region_t region, void* data);
 
@@ -0,0 +1,360 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "arena_utils.h"
+
+// The counters of a thread are only written by the thread, but may be read by any
+static void counter_add(uint64_t *counter, uint64_t value) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+static void counter_add_signed(int64_t *counter, int64_t value) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+static void counters_sum(arena_counters_t *sum, arena_counters_t *counters) {
+    sum->allocations += __atomic_load_n(&counters->allocations, __ATOMIC_RELAXED);
+    sum->frees += __atomic_load_n(&counters->frees, __ATOMIC_RELAXED);
+    sum->cache_hits += __atomic_load_n(&counters->cache_hits, __ATOMIC_RELAXED);
+    sum->cache_refills += __atomic_load_n(&counters->cache_refills, __ATOMIC_RELAXED);
+    sum->cache_flushes += __atomic_load_n(&counters->cache_flushes, __ATOMIC_RELAXED);
+    sum->chunk_allocations += __atomic_load_n(&counters->chunk_allocations, __ATOMIC_RELAXED);
+    sum->large_allocations += __atomic_load_n(&counters->large_allocations, __ATOMIC_RELAXED);
+    sum->bytes_in_use += __atomic_load_n(&counters->bytes_in_use, __ATOMIC_RELAXED);
+    sum->bytes_reserved += __atomic_load_n(&counters->bytes_reserved, __ATOMIC_RELAXED);
+    return;
+}
+
+// Return the size class of a request, or -1 if it must be allocated directly from the region
+static int size_class(arena_t *arena, size_t size, size_t alignment) {
+    size_t needed = (size > alignment) ? size : alignment;
+    needed = (needed > arena->min_alignment) ? needed : arena->min_alignment;
+
+    int class_index = 0;
+    size_t block_size = ARENA_MIN_BLOCK_SIZE;
+    while (block_size < needed) {
+        block_size <<= 1;
+        ++class_index;
+    }
+
+    if (class_index >= ARENA_NUM_CLASSES || block_size > arena->region_alignment || block_size > arena->chunk_size) {
+        return -1;
+    }
+    return class_index;
+}
+
+// Move the blocks of a cache back to the free lists, the arena must be locked
+static void flush_cache(struct arena_cache_s *cache, int class_index, uint32_t count) {
+    arena_t *arena = cache->arena;
+    while (count > 0 && cache->count[class_index] > 0) {
+        void *block = cache->blocks[class_index][--cache->count[class_index]];
+        *(void**) block = arena->free_lists[class_index];
+        arena->free_lists[class_index] = block;
+        --count;
+    }
+    return;
+}
+
+// Move a batch of blocks to the cache, carving new ones if the free list is empty
+static void refill_cache(struct arena_cache_s *cache, int class_index) {
+    arena_t *arena = cache->arena;
+    size_t block_size = (size_t) ARENA_MIN_BLOCK_SIZE << class_index;
+
+    pthread_mutex_lock(&arena->mutex);
+    uint32_t count = 0;
+    while (count < ARENA_CACHE_BATCH) {
+        void *block = arena->free_lists[class_index];
+        if (NULL != block) {
+            arena->free_lists[class_index] = *(void**) block;
+        } else {
+            // Chunks are aligned to the region alignment, which is at least the block size
+            uintptr_t cursor = ((uintptr_t) arena->chunk_cursor + block_size - 1) & ~(uintptr_t)(block_size - 1);
+            if (NULL == arena->chunk_cursor || cursor + block_size > (uintptr_t) arena->chunk_end) {
+                if (arena->num_chunks == arena->max_chunks) {
+                    size_t max_chunks = (0 == arena->max_chunks) ? 16 : 2 * arena->max_chunks;
+                    void **chunks = (void**) realloc(arena->chunks, max_chunks * sizeof(void*));
+                    if (NULL == chunks) {
+                        break;
+                    }
+                    arena->chunks = chunks;
+                    arena->max_chunks = max_chunks;
+                }
+
+                void *chunk = NULL;
+                if (HSA_STATUS_SUCCESS != hsa_memory_allocate(arena->region, arena->chunk_size, &chunk)) {
+                    break;
+                }
+                arena->chunks[arena->num_chunks++] = chunk;
+                arena->chunk_cursor = (uint8_t*) chunk;
+                arena->chunk_end = (uint8_t*) chunk + arena->chunk_size;
+                counter_add(&cache->counters.chunk_allocations, 1);
+                counter_add(&cache->counters.bytes_reserved, arena->chunk_size);
+                cursor = (uintptr_t) chunk;
+            }
+            block = (void*) cursor;
+            arena->chunk_cursor = (uint8_t*) (cursor + block_size);
+        }
+        cache->blocks[class_index][cache->count[class_index]++] = block;
+        ++count;
+    }
+    pthread_mutex_unlock(&arena->mutex);
+
+    if (count > 0) {
+        counter_add(&cache->counters.cache_refills, 1);
+    }
+    return;
+}
+
+// Return the blocks of an exiting thread to the arena
+static void release_cache(void *data) {
+    struct arena_cache_s *cache = (struct arena_cache_s*) data;
+    arena_t *arena = cache->arena;
+
+    pthread_mutex_lock(&arena->mutex);
+    int ii;
+    for (ii = 0; ii < ARENA_NUM_CLASSES; ++ii) {
+        flush_cache(cache, ii, ARENA_CACHE_SIZE);
+    }
+    counters_sum(&arena->retired_counters, &cache->counters);
+
+    struct arena_cache_s **link = &arena->caches;
+    while (*link != cache) {
+        link = &(*link)->next;
+    }
+    *link = cache->next;
+    pthread_mutex_unlock(&arena->mutex);
+
+    free(cache);
+    return;
+}
+
+static struct arena_cache_s* get_cache(arena_t *arena) {
+    struct arena_cache_s *cache = (struct arena_cache_s*) pthread_getspecific(arena->cache_key);
+    if (NULL != cache) {
+        return cache;
+    }
+
+    cache = (struct arena_cache_s*) calloc(1, sizeof(struct arena_cache_s));
+    if (NULL == cache) {
+        return NULL;
+    }
+    cache->arena = arena;
+    if (0 != pthread_setspecific(arena->cache_key, cache)) {
+        free(cache);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&arena->mutex);
+    cache->next = arena->caches;
+    arena->caches = cache;
+    pthread_mutex_unlock(&arena->mutex);
+
+    return cache;
+}
+
+arena_t* arena_create(hsa_region_t region, size_t min_alignment) {
+    bool alloc_allowed = false;
+    hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_ALLOWED, &alloc_allowed);
+    if (!alloc_allowed) {
+        return NULL;
+    }
+
+    size_t granule = 0;
+    size_t region_alignment = 0;
+    hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_GRANULE, &granule);
+    hsa_region_get_info(region, HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT, &region_alignment);
+    if (0 == granule || 0 == region_alignment) {
+        return NULL;
+    }
+
+    arena_t *arena = (arena_t*) malloc(sizeof(arena_t));
+    if (NULL == arena) {
+        return NULL;
+    }
+    memset(arena, 0, sizeof(arena_t));
+
+    arena->region = region;
+    arena->min_alignment = (min_alignment > ARENA_MIN_BLOCK_SIZE) ? min_alignment : ARENA_MIN_BLOCK_SIZE;
+    arena->region_alignment = region_alignment;
+    arena->chunk_size = ((ARENA_CHUNK_SIZE + granule - 1) / granule) * granule;
+
+    if (0 != pthread_key_create(&arena->cache_key, release_cache)) {
+        free(arena);
+        return NULL;
+    }
+    pthread_mutex_init(&arena->mutex, NULL);
+
+    return arena;
+}
+
+void arena_destroy(arena_t *arena) {
+    // Threads that are still running lose their cache with the key
+    pthread_key_delete(arena->cache_key);
+    while (NULL != arena->caches) {
+        struct arena_cache_s *cache = arena->caches;
+        arena->caches = cache->next;
+        free(cache);
+    }
+
+    size_t ii;
+    for (ii = 0; ii < arena->num_chunks; ++ii) {
+        hsa_memory_free(arena->chunks[ii]);
+    }
+    free(arena->chunks);
+
+    pthread_mutex_destroy(&arena->mutex);
+    free(arena);
+    return;
+}
+
+void* arena_alloc(arena_t *arena, size_t size, size_t alignment) {
+    struct arena_cache_s *cache = get_cache(arena);
+    if (NULL == cache || 0 == size) {
+        return NULL;
+    }
+
+    int class_index = size_class(arena, size, alignment);
+    if (class_index < 0) {
+        // Large blocks come straight from the region, which can't align beyond its alignment
+        void *block = NULL;
+        if (alignment > arena->region_alignment || arena->min_alignment > arena->region_alignment ||
+            HSA_STATUS_SUCCESS != hsa_memory_allocate(arena->region, size, &block)) {
+            return NULL;
+        }
+        counter_add(&cache->counters.large_allocations, 1);
+        counter_add(&cache->counters.allocations, 1);
+        counter_add_signed(&cache->counters.bytes_in_use, (int64_t) size);
+        return block;
+    }
+
+    if (0 < cache->count[class_index]) {
+        counter_add(&cache->counters.cache_hits, 1);
+    } else {
+        refill_cache(cache, class_index);
+        if (0 == cache->count[class_index]) {
+            return NULL;
+        }
+    }
+
+    counter_add(&cache->counters.allocations, 1);
+    counter_add_signed(&cache->counters.bytes_in_use, (int64_t) ARENA_MIN_BLOCK_SIZE << class_index);
+    return cache->blocks[class_index][--cache->count[class_index]];
+}
+
+void arena_free(arena_t *arena, void *ptr, size_t size, size_t alignment) {
+    struct arena_cache_s *cache = get_cache(arena);
+    if (NULL == ptr || NULL == cache) {
+        return;
+    }
+
+    int class_index = size_class(arena, size, alignment);
+    if (class_index < 0) {
+        hsa_memory_free(ptr);
+        counter_add(&cache->counters.frees, 1);
+        counter_add_signed(&cache->counters.bytes_in_use, -(int64_t) size);
+        return;
+    }
+
+    // Make room by returning the most recently cached blocks to the arena
+    if (ARENA_CACHE_SIZE == cache->count[class_index]) {
+        pthread_mutex_lock(&arena->mutex);
+        flush_cache(cache, class_index, ARENA_CACHE_BATCH);
+        pthread_mutex_unlock(&arena->mutex);
+        counter_add(&cache->counters.cache_flushes, 1);
+    }
+
+    cache->blocks[class_index][cache->count[class_index]++] = ptr;
+    counter_add(&cache->counters.frees, 1);
+    counter_add_signed(&cache->counters.bytes_in_use, -((int64_t) ARENA_MIN_BLOCK_SIZE << class_index));
+    return;
+}
+
+void arena_get_counters(arena_t *arena, arena_counters_t *counters) {
+    memset(counters, 0, sizeof(arena_counters_t));
+
+    pthread_mutex_lock(&arena->mutex);
+    counters_sum(counters, &arena->retired_counters);
+    struct arena_cache_s *cache;
+    for (cache = arena->caches; NULL != cache; cache = cache->next) {
+        counters_sum(counters, &cache->counters);
+    }
+    pthread_mutex_unlock(&arena->mutex);
+
+    return;
+}
+
+void arena_frame_begin(arena_t *arena, arena_frame_t *frame) {
+    frame->arena = arena;
+    frame->count = 0;
+    return;
+}
+
+void* arena_frame_alloc(arena_frame_t *frame, size_t size, size_t alignment) {
+    if (ARENA_FRAME_MAX_BLOCKS == frame->count) {
+        return NULL;
+    }
+
+    void *block = arena_alloc(frame->arena, size, alignment);
+    if (NULL != block) {
+        frame->blocks[frame->count] = block;
+        frame->sizes[frame->count] = size;
+        frame->alignments[frame->count] = alignment;
+        ++frame->count;
+    }
+    return block;
+}
+
+void arena_frame_release(arena_frame_t *frame) {
+    // Return the blocks in reverse order, so the next frame reuses the same blocks
+    while (frame->count > 0) {
+        --frame->count;
+        arena_free(frame->arena, frame->blocks[frame->count], frame->sizes[frame->count], frame->alignments[frame->count]);
+    }
+    return;
+}
@@ -0,0 +1,244 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+#ifndef _ARENA_UTILS_H_
+#define _ARENA_UTILS_H_
+
+#include <hsa.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Smallest block handed out by an arena, in bytes
+ */
+#define ARENA_MIN_BLOCK_SIZE 16
+
+/**
+ * @brief Number of block size classes. Class N holds blocks of
+ * ARENA_MIN_BLOCK_SIZE << N bytes, larger requests are allocated directly
+ * from the region.
+ */
+#define ARENA_NUM_CLASSES 11
+
+/**
+ * @brief Default size of the chunks the blocks are carved from, in bytes
+ */
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+/**
+ * @brief Maximum number of blocks in a per-thread cache of a size class
+ */
+#define ARENA_CACHE_SIZE 64
+
+/**
+ * @brief Number of blocks moved between a per-thread cache and the arena
+ * at a time
+ */
+#define ARENA_CACHE_BATCH 16
+
+/**
+ * @brief Maximum number of blocks in an arena frame
+ */
+#define ARENA_FRAME_MAX_BLOCKS 16
+
+/**
+ * @struct arena_counters_s
+ * @brief Arena statistics. The counters of each thread are kept in its
+ * cache and summed up by arena_get_counters.
+ */
+struct arena_counters_s {
+    /* Blocks handed out and returned */
+    uint64_t allocations;
+    uint64_t frees;
+    /* Allocations served by the per-thread cache without locking */
+    uint64_t cache_hits;
+    /* Batches moved from the arena to a cache, and back */
+    uint64_t cache_refills;
+    uint64_t cache_flushes;
+    /* hsa_memory_allocate calls made for chunks and for large blocks */
+    uint64_t chunk_allocations;
+    uint64_t large_allocations;
+    /* Bytes handed out and not yet returned */
+    int64_t bytes_in_use;
+    /* Bytes of the chunks allocated from the region */
+    uint64_t bytes_reserved;
+};
+
+typedef struct arena_counters_s arena_counters_t;
+
+/**
+ * @struct arena_cache_s
+ * @brief Per-thread cache of free blocks of each size class
+ */
+struct arena_cache_s {
+    struct arena_s *arena;
+    void *blocks[ARENA_NUM_CLASSES][ARENA_CACHE_SIZE];
+    uint32_t count[ARENA_NUM_CLASSES];
+    arena_counters_t counters;
+    struct arena_cache_s *next;
+};
+
+/**
+ * @struct arena_s
+ * @brief A thread caching allocator of small blocks of a memory region,
+ * e.g. kernel argument buffers from a kernarg region, or small fine grained
+ * buffers from a global region. Blocks are powers of two carved from chunks
+ * allocated with hsa_memory_allocate, so a block is aligned to its size up to
+ * the region's HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT. Free blocks are linked
+ * through their first bytes, so the region must be accessible by the host.
+ */
+struct arena_s {
+    /* The region the chunks are allocated from */
+    hsa_region_t region;
+    /* Minimum alignment of every block */
+    size_t min_alignment;
+    /* HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT of the region */
+    size_t region_alignment;
+    /* Size of the chunks, a multiple of HSA_REGION_INFO_RUNTIME_ALLOC_GRANULE */
+    size_t chunk_size;
+    /* Mutex protecting everything below */
+    pthread_mutex_t mutex;
+    /* Free lists of each size class */
+    void *free_lists[ARENA_NUM_CLASSES];
+    /* Chunks allocated from the region */
+    void **chunks;
+    size_t num_chunks;
+    size_t max_chunks;
+    /* Unused part of the current chunk */
+    uint8_t *chunk_cursor;
+    uint8_t *chunk_end;
+    /* Thread caches, and the counters of the threads that have exited */
+    pthread_key_t cache_key;
+    struct arena_cache_s *caches;
+    arena_counters_t retired_counters;
+};
+
+typedef struct arena_s arena_t;
+
+/**
+ * @struct arena_frame_s
+ * @brief The blocks used by one dispatch, returned together once the
+ * dispatch has completed
+ */
+struct arena_frame_s {
+    arena_t *arena;
+    uint32_t count;
+    void *blocks[ARENA_FRAME_MAX_BLOCKS];
+    size_t sizes[ARENA_FRAME_MAX_BLOCKS];
+    size_t alignments[ARENA_FRAME_MAX_BLOCKS];
+};
+
+typedef struct arena_frame_s arena_frame_t;
+
+/**
+ * @brief create an arena over a memory region
+ * @param region The region, which must allow runtime allocation and be
+ * accessible by the host
+ * @param min_alignment Minimum alignment of every block, e.g. the
+ * kernarg_segment_alignment of the kernels, 0 for ARENA_MIN_BLOCK_SIZE
+ * @return the arena, NULL on failure
+ */
+arena_t* arena_create(hsa_region_t region, size_t min_alignment);
+
+/**
+ * @brief destroy an arena and free its chunks. All of the blocks must
+ * have been returned.
+ * @param arena Pointer to the arena
+ */
+void arena_destroy(arena_t *arena);
+
+/**
+ * @brief allocate a block
+ * @param arena Pointer to the arena
+ * @param size Size of the block in bytes
+ * @param alignment Alignment of the block, 0 for the arena's minimum
+ * @return the block, NULL on failure or if the alignment is larger than
+ * the region's HSA_REGION_INFO_RUNTIME_ALLOC_ALIGNMENT
+ */
+void* arena_alloc(arena_t *arena, size_t size, size_t alignment);
+
+/**
+ * @brief return a block to the arena
+ * @param arena Pointer to the arena
+ * @param ptr The block
+ * @param size The size passed to arena_alloc
+ * @param alignment The alignment passed to arena_alloc
+ */
+void arena_free(arena_t *arena, void *ptr, size_t size, size_t alignment);
+
+/**
+ * @brief sum up the counters of all of the threads using the arena
+ * @param arena Pointer to the arena
+ * @param counters The counters
+ */
+void arena_get_counters(arena_t *arena, arena_counters_t *counters);
+
+/**
+ * @brief start an empty frame
+ * @param arena Pointer to the arena
+ * @param frame Pointer to the frame
+ */
+void arena_frame_begin(arena_t *arena, arena_frame_t *frame);
+
+/**
+ * @brief allocate a block that is returned by arena_frame_release
+ * @param frame Pointer to the frame
+ * @param size Size of the block in bytes
+ * @param alignment Alignment of the block, 0 for the arena's minimum
+ * @return the block, NULL on failure or if the frame is full
+ */
+void* arena_frame_alloc(arena_frame_t *frame, size_t size, size_t alignment);
+
+/**
+ * @brief return all of the blocks of a frame to the arena, leaving the
+ * frame empty
+ * @param frame Pointer to the frame
+ */
+void arena_frame_release(arena_frame_t *frame);
+
+#endif  // _ARENA_UTILS_H_
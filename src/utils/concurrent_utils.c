@@ -211,15 +211,15 @@ int test_group_num_tests(struct test_group *t_group) {
 
 // Set affinity of the specific test
 void test_group_thread_affinity(struct test_group *t_group, int test_id, int cpu_id) {
-/*  Setting CPU affinity isn't currently supported.
- *  CPU_SET(cpu_id, &t_group->thread_list[test_id].cpuset);
- *  int status;
- *  status = pthread_setaffinity_np(t_group->tid[test_id],
- *          sizeof(cpu_set_t), &t_group->thread_list[test_id].cpuset);
- *  if (status != 0) {
- *      perror("pthread_setaffinity_np error");
- *  }
- */
+#if defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu_id, &cpuset);
+    int status = pthread_setaffinity_np(t_group->tid[test_id], sizeof(cpu_set_t), &cpuset);
+    if (status != 0) {
+        printf("Error: pthread_setaffinity_np failed with %d\n", status);
+    }
+#endif
     return;
 }
 
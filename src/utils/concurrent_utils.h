@@ -189,7 +189,8 @@ void test_group_destroy(struct test_group *t_group);
 int test_group_test_status(struct test_group *t_group, int test_id);
 
 /**
- * @brief set affinity of the specific test
+ * @brief set affinity of the specific test. Must be called after
+ * test_group_thread_create. Affinity is only supported on Linux.
  * @param t_group Pointer to a test group
  * @param test_id Test No.
  * @param cpu_id CPU No. that the test is binded to
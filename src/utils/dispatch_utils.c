@@ -54,11 +54,26 @@ void dispatch_kernel_1d_data(
         uint32_t data_size,
         uint64_t kernel_object,
         void*    kernarg_address) {
+    dispatch_kernel_1d_data_pooled(queue, NULL, data_size, kernel_object, kernarg_address);
+    return;
+}
+
+// Dispatch the kernel with a completion signal from the pool, and wait for the kernel to finish
+void dispatch_kernel_1d_data_pooled(
+        hsa_queue_t* queue,
+        signal_pool_t* pool,
+        uint32_t data_size,
+        uint64_t kernel_object,
+        void*    kernarg_address) {
     hsa_status_t status;
 
-    // Create a signal with initial value of 1
+    // Get a signal with initial value of 1
     hsa_signal_t signal;
-    status = hsa_signal_create(1, 0, NULL, &signal);
+    if (NULL != pool) {
+        status = signal_pool_acquire(pool, 1, &signal);
+    } else {
+        status = hsa_signal_create(1, 0, NULL, &signal);
+    }
     ASSERT(HSA_STATUS_SUCCESS == status);
 
     // Request a new packet ID
@@ -96,7 +111,11 @@ void dispatch_kernel_1d_data(
     // Wait until the kernel complete
     while (0 != hsa_signal_wait_acquire(signal, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED)) {}
 
-    hsa_signal_destroy(signal);
+    if (NULL != pool) {
+        signal_pool_release(pool, signal);
+    } else {
+        hsa_signal_destroy(signal);
+    }
 
     return;
 }
@@ -46,11 +46,21 @@
 #ifndef _DISPATCH_UTILS_H_
 #define _DISPATCH_UTILS_H_
 #include <hsa.h>
+#include "signal_pool_utils.h"
 
 void dispatch_kernel_1d_data(hsa_queue_t* queue,
                              uint32_t data_size,
                              uint64_t kernel_object,
                              void*    kernarg_address);
 
+// Same as dispatch_kernel_1d_data, but the completion signal is taken from
+// the pool instead of being created and destroyed for the dispatch. A NULL
+// pool falls back to creating a signal.
+void dispatch_kernel_1d_data_pooled(hsa_queue_t* queue,
+                                    signal_pool_t* pool,
+                                    uint32_t data_size,
+                                    uint64_t kernel_object,
+                                    void*    kernarg_address);
+
 #endif  // _DISPATCH_UTILS_H_
 
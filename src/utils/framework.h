@@ -75,6 +75,11 @@ END_TEST
     tcase_add_test(test_case, __test_name__); \
     suite_add_tcase(suite, test_case);
 
+#define ADD_LOOP_TEST(__test_name__, __case_name__, __start__, __end__) \
+    test_case = tcase_create(__case_name__); \
+    tcase_add_loop_test(test_case, __test_name__, __start__, __end__); \
+    suite_add_tcase(suite, test_case);
+
 #define RUN_TESTS() \
     srunner_run_all(runner, CK_NORMAL); \
     number_failed = srunner_ntests_failed(runner); \
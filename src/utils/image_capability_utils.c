@@ -0,0 +1,350 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <dlfcn.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "image_capability_utils.h"
+#include "perf_utils.h"
+
+// The longest line of a cache file
+#define IMAGE_CAPABILITY_MAX_LINE 1024
+
+// The header line of a cache file with the runtime build it was scanned with
+#define IMAGE_CAPABILITY_RUNTIME_PREFIX "# runtime "
+
+// The state shared by the agents of image_capability_get_supported
+typedef struct image_capability_context_s {
+    hsa_ext_image_pfn_t* pfn;
+    const image_matrix_entry_t* matrix;
+    uint32_t num_entries;
+    uint32_t* capability_masks;
+    uint8_t* supported;
+} image_capability_context_t;
+
+// Query the capability mask of every entry of the matrix on an agent
+hsa_status_t image_capability_scan(hsa_ext_image_pfn_t* pfn,
+                                   hsa_agent_t agent,
+                                   const image_matrix_entry_t* matrix,
+                                   uint32_t num_entries,
+                                   uint32_t* capability_masks) {
+    uint32_t ii;
+    for (ii = 0; ii < num_entries; ++ii) {
+        hsa_status_t status = pfn->hsa_ext_image_get_capability(agent,
+                                                                matrix[ii].geometry,
+                                                                &matrix[ii].format,
+                                                                &capability_masks[ii]);
+        if (HSA_STATUS_SUCCESS != status) {
+            return status;
+        }
+    }
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Get a string that identifies the build of the loaded runtime library
+void image_capability_get_runtime_id(char* id, size_t size) {
+    // HSA_SYSTEM_INFO_VERSION_MAJOR/MINOR is the version of the specification,
+    // so use the library file, which changes with every runtime build
+    Dl_info info;
+    char library[PATH_MAX];
+    struct stat library_stat;
+    if (0 == dladdr((void*) &hsa_init, &info) || NULL == info.dli_fname ||
+        NULL == realpath(info.dli_fname, library) ||
+        0 != stat(library, &library_stat)) {
+        snprintf(id, size, "unknown");
+        return;
+    }
+
+    snprintf(id, size, "%s %lld %lld", library,
+             (long long) library_stat.st_size, (long long) library_stat.st_mtime);
+
+    return;
+}
+
+// Get the path of the capability cache file of an agent
+hsa_status_t image_capability_get_cache_path(hsa_agent_t agent, char* path, size_t size) {
+    char name[64];
+    hsa_status_t status;
+
+    status = hsa_agent_get_info(agent, HSA_AGENT_INFO_NAME, name);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    // Keep the agent name usable as a file name
+    name[sizeof(name) - 1] = '\0';
+    char* c;
+    for (c = name; '\0' != *c; ++c) {
+        if (!isalnum((unsigned char) *c) && '-' != *c && '.' != *c) {
+            *c = '_';
+        }
+    }
+
+    const char* dir = getenv("IMAGE_CAPABILITY_CACHE_DIR");
+    if (NULL == dir || '\0' == *dir) {
+        dir = IMAGE_CAPABILITY_DEFAULT_CACHE_DIR;
+    }
+
+    snprintf(path, size, "%s/image_capability_%s.cache", dir, name);
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Read the capability masks of the matrix from a cache file
+int image_capability_load(const char* path,
+                          const char* runtime_id,
+                          const image_matrix_entry_t* matrix,
+                          uint32_t num_entries,
+                          uint32_t* capability_masks) {
+    FILE* file = fopen(path, "r");
+    if (NULL == file) {
+        return -1;
+    }
+
+    uint8_t* found = (uint8_t*) calloc(num_entries, sizeof(uint8_t));
+    if (NULL == found) {
+        fclose(file);
+        return -1;
+    }
+
+    char line[IMAGE_CAPABILITY_MAX_LINE];
+    uint32_t num_found = 0;
+    uint32_t next = 0;
+    int same_runtime = 0;
+    while (NULL != fgets(line, sizeof(line), file)) {
+        char type[64];
+        char order[64];
+        char geometry[64];
+        unsigned mask;
+
+        // The masks of another runtime build may be stale
+        if (0 == strncmp(line, IMAGE_CAPABILITY_RUNTIME_PREFIX, strlen(IMAGE_CAPABILITY_RUNTIME_PREFIX))) {
+            line[strcspn(line, "\r\n")] = '\0';
+            same_runtime = (0 == strcmp(line + strlen(IMAGE_CAPABILITY_RUNTIME_PREFIX), runtime_id));
+            continue;
+        }
+
+        if ('#' == line[0] || 4 != sscanf(line, "%63s %63s %63s %u", type, order, geometry, &mask)) {
+            continue;
+        }
+
+        // The lines are saved in the order of the matrix, so the entry
+        // after the previous one is almost always the one
+        uint32_t ii;
+        for (ii = 0; ii < num_entries; ++ii) {
+            uint32_t index = (next + ii) % num_entries;
+            if (0 == strcmp(type, matrix[index].channel_type_name) &&
+                0 == strcmp(order, matrix[index].channel_order_name) &&
+                0 == strcmp(geometry, matrix[index].geometry_name)) {
+                capability_masks[index] = mask;
+                if (!found[index]) {
+                    found[index] = 1;
+                    ++num_found;
+                }
+                next = index + 1;
+                break;
+            }
+        }
+    }
+
+    free(found);
+    fclose(file);
+
+    // A matrix with entries the cache does not have needs a new scan
+    return (same_runtime && num_found == num_entries) ? 0 : -1;
+}
+
+// Write the capability masks of the matrix to a cache file
+int image_capability_save(const char* path,
+                          const char* runtime_id,
+                          const image_matrix_entry_t* matrix,
+                          uint32_t num_entries,
+                          const uint32_t* capability_masks) {
+    // Write a temporary file and rename it, so that suites running at the
+    // same time never read a partial cache
+    char temp_path[1024];
+    snprintf(temp_path, sizeof(temp_path), "%s.%lu.tmp", path, (unsigned long) getpid());
+
+    FILE* file = fopen(temp_path, "w");
+    if (NULL == file) {
+        return -1;
+    }
+
+    fprintf(file, "%s%s\n", IMAGE_CAPABILITY_RUNTIME_PREFIX, runtime_id);
+    fprintf(file, "# channel_type channel_order geometry capability_mask\n");
+    fprintf(file, "# capability_mask: 0x%x read only, 0x%x write only, 0x%x read write, "
+            "0x%x read modify write, 0x%x access invariant data layout\n",
+            HSA_EXT_IMAGE_CAPABILITY_READ_ONLY,
+            HSA_EXT_IMAGE_CAPABILITY_WRITE_ONLY,
+            HSA_EXT_IMAGE_CAPABILITY_READ_WRITE,
+            HSA_EXT_IMAGE_CAPABILITY_READ_MODIFY_WRITE,
+            HSA_EXT_IMAGE_CAPABILITY_ACCESS_INVARIANT_DATA_LAYOUT);
+
+    uint32_t ii;
+    for (ii = 0; ii < num_entries; ++ii) {
+        fprintf(file, "%s %s %s %u\n",
+                matrix[ii].channel_type_name,
+                matrix[ii].channel_order_name,
+                matrix[ii].geometry_name,
+                capability_masks[ii]);
+    }
+
+    if (0 != fclose(file)) {
+        remove(temp_path);
+        return -1;
+    }
+
+    if (0 != rename(temp_path, path)) {
+        remove(temp_path);
+        return -1;
+    }
+
+    return 0;
+}
+
+// Get the capability masks of the matrix on an agent, from its cache file
+// when there is one
+hsa_status_t image_capability_get(hsa_ext_image_pfn_t* pfn,
+                                  hsa_agent_t agent,
+                                  const image_matrix_entry_t* matrix,
+                                  uint32_t num_entries,
+                                  uint32_t* capability_masks) {
+    char path[1024];
+    char runtime_id[IMAGE_CAPABILITY_MAX_LINE - sizeof(IMAGE_CAPABILITY_RUNTIME_PREFIX)];
+    hsa_status_t status;
+
+    status = image_capability_get_cache_path(agent, path, sizeof(path));
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    image_capability_get_runtime_id(runtime_id, sizeof(runtime_id));
+    if (0 == image_capability_load(path, runtime_id, matrix, num_entries, capability_masks)) {
+        return HSA_STATUS_SUCCESS;
+    }
+
+    status = image_capability_scan(pfn, agent, matrix, num_entries, capability_masks);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    // The scan is still good without a cache, it is only redone next time
+    if (0 != image_capability_save(path, runtime_id, matrix, num_entries, capability_masks)) {
+        fprintf(stderr, "Failed to write the image capability cache %s\n", path);
+    }
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Callback that marks the entries an agent can test
+static hsa_status_t mark_supported(hsa_agent_t agent, void* data) {
+    image_capability_context_t* context = (image_capability_context_t*) data;
+    hsa_status_t status;
+
+    status = image_capability_get(context->pfn, agent, context->matrix, context->num_entries, context->capability_masks);
+    if (HSA_STATUS_SUCCESS != status) {
+        return status;
+    }
+
+    uint32_t ii;
+    for (ii = 0; ii < context->num_entries; ++ii) {
+        if (IMAGE_CAPABILITY_TESTABLE & context->capability_masks[ii]) {
+            context->supported[ii] = 1;
+        }
+    }
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Find the entries of the matrix that at least one agent can test
+uint32_t image_capability_get_supported(const image_matrix_entry_t* matrix,
+                                        uint32_t num_entries,
+                                        uint8_t* supported) {
+    memset(supported, 1, num_entries);
+
+    if (0 == perf_get_env_uint("IMAGE_CAPABILITY_SCAN", 1)) {
+        return 0;
+    }
+
+    if (HSA_STATUS_SUCCESS != hsa_init()) {
+        return 0;
+    }
+
+    hsa_ext_image_pfn_t pfn;
+    image_capability_context_t context;
+    context.pfn = &pfn;
+    context.matrix = matrix;
+    context.num_entries = num_entries;
+    context.capability_masks = (uint32_t*) malloc(num_entries * sizeof(uint32_t));
+    context.supported = (uint8_t*) calloc(num_entries, sizeof(uint8_t));
+
+    // Only keep the result of a scan of every agent, the suite registers
+    // every entry and reports the failures otherwise
+    uint32_t num_unsupported = 0;
+    if (NULL != context.capability_masks && NULL != context.supported &&
+        HSA_STATUS_SUCCESS == get_image_fnc_tbl(&pfn) &&
+        HSA_STATUS_SUCCESS == hsa_iterate_agents(mark_supported, &context)) {
+        uint32_t ii;
+        for (ii = 0; ii < num_entries; ++ii) {
+            supported[ii] = context.supported[ii];
+            num_unsupported += !supported[ii];
+        }
+    }
+
+    free(context.capability_masks);
+    free(context.supported);
+    hsa_shut_down();
+
+    return num_unsupported;
+}
@@ -0,0 +1,155 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef _IMAGE_CAPABILITY_UTILS_H_
+#define _IMAGE_CAPABILITY_UTILS_H_
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <stdint.h>
+#include "image_matrix_utils.h"
+#include "image_utils.h"
+
+/**
+ * @brief The access modes the image tests need one of, the entries
+ * whose capability mask has none of them cannot be tested. Keep in sync
+ * with IMAGE_CAPABILITY_TESTABLE in cmake/image_data.cmake.
+ */
+#define IMAGE_CAPABILITY_TESTABLE (HSA_EXT_IMAGE_CAPABILITY_READ_ONLY | \
+                                   HSA_EXT_IMAGE_CAPABILITY_READ_WRITE | \
+                                   HSA_EXT_IMAGE_CAPABILITY_READ_MODIFY_WRITE)
+
+/**
+ * @brief The directory of the capability cache files, when
+ * IMAGE_CAPABILITY_CACHE_DIR is not set
+ */
+#define IMAGE_CAPABILITY_DEFAULT_CACHE_DIR "."
+
+/**
+ * @brief Query the capability mask of every entry of the matrix on an agent
+ * @param pfn The image extension function table
+ * @param agent The agent
+ * @param matrix The entries
+ * @param num_entries The number of entries
+ * @param capability_masks The capability mask of each entry
+ * @return HSA_STATUS_SUCCESS, or the status of the first query that failed
+ */
+hsa_status_t image_capability_scan(hsa_ext_image_pfn_t* pfn,
+                                   hsa_agent_t agent,
+                                   const image_matrix_entry_t* matrix,
+                                   uint32_t num_entries,
+                                   uint32_t* capability_masks);
+
+/**
+ * @brief Get a string that identifies the build of the loaded runtime
+ * library, its path, size and modification time, or "unknown"
+ * @param id The identifier
+ * @param size The size of id
+ */
+void image_capability_get_runtime_id(char* id, size_t size);
+
+/**
+ * @brief Get the path of the capability cache file of an agent,
+ * <dir>/image_capability_<agent name>.cache
+ * @param agent The agent
+ * @param path The path
+ * @param size The size of path
+ * @return HSA_STATUS_SUCCESS, or the status of the query that failed
+ */
+hsa_status_t image_capability_get_cache_path(hsa_agent_t agent, char* path, size_t size);
+
+/**
+ * @brief Read the capability masks of the matrix from a cache file
+ * @return 0 if the file was written with the runtime runtime_id and has the
+ * mask of every entry, -1 otherwise
+ */
+int image_capability_load(const char* path,
+                          const char* runtime_id,
+                          const image_matrix_entry_t* matrix,
+                          uint32_t num_entries,
+                          uint32_t* capability_masks);
+
+/**
+ * @brief Write the capability masks of the matrix to a cache file, a
+ * "# runtime <runtime_id>" line followed by one
+ * "<type> <order> <geometry> <mask>" line per entry
+ * @return 0 if the file was written, -1 otherwise
+ */
+int image_capability_save(const char* path,
+                          const char* runtime_id,
+                          const image_matrix_entry_t* matrix,
+                          uint32_t num_entries,
+                          const uint32_t* capability_masks);
+
+/**
+ * @brief Get the capability masks of the matrix on an agent from its cache
+ * file, or scan the agent and write the cache file if there is none for the
+ * loaded runtime build yet
+ * @return HSA_STATUS_SUCCESS, or the status of the scan that failed
+ */
+hsa_status_t image_capability_get(hsa_ext_image_pfn_t* pfn,
+                                  hsa_agent_t agent,
+                                  const image_matrix_entry_t* matrix,
+                                  uint32_t num_entries,
+                                  uint32_t* capability_masks);
+
+/**
+ * @brief Find the entries of the matrix that at least one agent can test,
+ * to skip the others before any of their setup. The runtime is initialized
+ * and shut down again. Every entry is marked as supported when the scan
+ * cannot be done, or IMAGE_CAPABILITY_SCAN is 0.
+ * @param matrix The entries
+ * @param num_entries The number of entries
+ * @param supported 1 for each entry to test, 0 for the others
+ * @return The number of entries not supported
+ */
+uint32_t image_capability_get_supported(const image_matrix_entry_t* matrix,
+                                        uint32_t num_entries,
+                                        uint8_t* supported);
+
+#endif  // _IMAGE_CAPABILITY_UTILS_H_
@@ -0,0 +1,1208 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "image_format_utils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IMAGE_FORMAT_AVX2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define IMAGE_FORMAT_NEON 1
+#endif
+
+// The size of the values of an element, four 32 bit components
+#define IMAGE_FORMAT_VALUES_SIZE 16
+
+// The number of elements of the formats with fewer than four channels that
+// are converted at a time through a buffer of four channel elements
+#define IMAGE_FORMAT_WIDE_ELEMENTS 256
+
+// The permutations and constants of the vector paths of a format
+typedef struct format_vector_s {
+    int32_t pack_index[4];  // The component of each channel
+    int32_t pack_keep[4];  // -1 for the channels, 0 for the padding
+    int32_t unpack_index[4];  // The channel of each component
+    int32_t unpack_keep[4];  // -1 for the stored components, 0 for the missing ones
+    uint32_t defaults[4];  // The values of the missing components
+    uint8_t pack_bytes[16];  // pack_index as byte indices
+    uint8_t unpack_bytes[16];  // unpack_index as byte indices
+    float scale;  // The largest raw value of a normalized channel
+    float lo;  // The smallest value of a normalized channel
+    uint32_t max;  // The largest raw value of an unsigned integer channel
+} format_vector_t;
+
+typedef size_t (*format_pack_fn_t)(const image_format_layout_t* layout,
+                                   const format_vector_t* vector,
+                                   const void* values,
+                                   void* elements,
+                                   size_t count);
+
+typedef size_t (*format_unpack_fn_t)(const image_format_layout_t* layout,
+                                     const format_vector_t* vector,
+                                     const void* elements,
+                                     void* values,
+                                     size_t count);
+
+// Get the type of the values a channel type is unpacked to
+image_format_value_t image_format_get_value_type(hsa_ext_image_channel_type_t channel_type) {
+    switch (channel_type) {
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32 : { return IMAGE_FORMAT_VALUE_INT32; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32 : { return IMAGE_FORMAT_VALUE_UINT32; }
+        default : { return IMAGE_FORMAT_VALUE_FLOAT; }
+    }
+}
+
+// Check if a channel type and order form a valid format, with the same
+// rules as valid_image in cmake/image_data.cmake
+static int is_valid_format(hsa_ext_image_channel_type_t type, hsa_ext_image_channel_order_t order) {
+    int is_packed = (HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_555 == type ||
+                     HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_565 == type ||
+                     HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_101010 == type);
+    int is_int8 = (HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT8 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8 == type);
+    int is_norm = (HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT8 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT16 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT16 == type);
+    int is_float = (HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT == type ||
+                    HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT == type);
+
+    switch (order) {
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_A :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_R :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RX :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RG :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGX :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RA :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA : {
+            return !is_packed && HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT24 != type;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGB :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGBX : { return is_packed; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_BGRA :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_ARGB :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_ABGR : { return is_int8; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGB :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBX :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBA :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SBGRA : { return HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8 == type; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_INTENSITY :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_LUMINANCE : { return is_norm || is_float; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH : {
+            return HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT16 == type ||
+                   HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT24 == type;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH_STENCIL : { return HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT24 == type; }
+        default : { return 0; }
+    }
+}
+
+// Get the storage layout of a format
+hsa_status_t image_format_get_layout(const hsa_ext_image_format_t* format,
+                                     image_format_layout_t* layout) {
+    static const int32_t ORDER_A[4] = {3};
+    static const int32_t ORDER_R[4] = {0};
+    static const int32_t ORDER_RX[4] = {0, -1};
+    static const int32_t ORDER_RG[4] = {0, 1};
+    static const int32_t ORDER_RGX[4] = {0, 1, -1};
+    static const int32_t ORDER_RA[4] = {0, 3};
+    static const int32_t ORDER_RGB[4] = {0, 1, 2};
+    static const int32_t ORDER_RGBX[4] = {0, 1, 2, -1};
+    static const int32_t ORDER_RGBA[4] = {0, 1, 2, 3};
+    static const int32_t ORDER_BGRA[4] = {2, 1, 0, 3};
+    static const int32_t ORDER_ARGB[4] = {3, 0, 1, 2};
+    static const int32_t ORDER_ABGR[4] = {3, 2, 1, 0};
+    const int32_t* components;
+    uint32_t num_channels;
+
+    memset(layout, 0, sizeof(image_format_layout_t));
+    if (!is_valid_format(format->channel_type, format->channel_order)) {
+        return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+    layout->channel_type = format->channel_type;
+    layout->channel_order = format->channel_order;
+    layout->value_type = image_format_get_value_type(format->channel_type);
+
+    switch (format->channel_order) {
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_A : { components = ORDER_A; num_channels = 1; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_R :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_INTENSITY :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_LUMINANCE :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH_STENCIL : { components = ORDER_R; num_channels = 1; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RX : { components = ORDER_RX; num_channels = 2; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RG : { components = ORDER_RG; num_channels = 2; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RA : { components = ORDER_RA; num_channels = 2; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGX : { components = ORDER_RGX; num_channels = 3; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGB :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGB : { components = ORDER_RGB; num_channels = 3; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGBX :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBX : { components = ORDER_RGBX; num_channels = 4; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_RGBA :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBA : { components = ORDER_RGBA; num_channels = 4; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_BGRA :
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_SBGRA : { components = ORDER_BGRA; num_channels = 4; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_ARGB : { components = ORDER_ARGB; num_channels = 4; break; }
+        case HSA_EXT_IMAGE_CHANNEL_ORDER_ABGR : { components = ORDER_ABGR; num_channels = 4; break; }
+        default : { return HSA_STATUS_ERROR_INVALID_ARGUMENT; }
+    }
+
+    layout->is_srgb = (HSA_EXT_IMAGE_CHANNEL_ORDER_SRGB == format->channel_order ||
+                       HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBX == format->channel_order ||
+                       HSA_EXT_IMAGE_CHANNEL_ORDER_SRGBA == format->channel_order ||
+                       HSA_EXT_IMAGE_CHANNEL_ORDER_SBGRA == format->channel_order);
+
+    // The packed types hold red, green and blue bit fields, in an RGB or RGBX order
+    switch (format->channel_type) {
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_555 : {
+            layout->element_size = 2;
+            layout->num_channels = 3;
+            layout->components[0] = 0; layout->shifts[0] = 10; layout->widths[0] = 5;
+            layout->components[1] = 1; layout->shifts[1] = 5;  layout->widths[1] = 5;
+            layout->components[2] = 2; layout->shifts[2] = 0;  layout->widths[2] = 5;
+            return HSA_STATUS_SUCCESS;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_565 : {
+            layout->element_size = 2;
+            layout->num_channels = 3;
+            layout->components[0] = 0; layout->shifts[0] = 11; layout->widths[0] = 5;
+            layout->components[1] = 1; layout->shifts[1] = 5;  layout->widths[1] = 6;
+            layout->components[2] = 2; layout->shifts[2] = 0;  layout->widths[2] = 5;
+            return HSA_STATUS_SUCCESS;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_SHORT_101010 : {
+            layout->element_size = 4;
+            layout->num_channels = 3;
+            layout->components[0] = 0; layout->shifts[0] = 20; layout->widths[0] = 10;
+            layout->components[1] = 1; layout->shifts[1] = 10; layout->widths[1] = 10;
+            layout->components[2] = 2; layout->shifts[2] = 0;  layout->widths[2] = 10;
+            return HSA_STATUS_SUCCESS;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT24 : {
+            // The depth is in the upper 24 bits when there is a stencil
+            layout->element_size = 4;
+            layout->num_channels = 1;
+            layout->components[0] = 0;
+            layout->shifts[0] = (HSA_EXT_IMAGE_CHANNEL_ORDER_DEPTH_STENCIL == format->channel_order) ? 8 : 0;
+            layout->widths[0] = 24;
+            return HSA_STATUS_SUCCESS;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8 : {
+            layout->channel_size = 1;
+            layout->is_signed = 1;
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8 : {
+            layout->channel_size = 1;
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 : {
+            layout->channel_size = 2;
+            layout->is_signed = 1;
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT : {
+            layout->channel_size = 2;
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32 : {
+            layout->channel_size = 4;
+            layout->is_signed = 1;
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT : {
+            layout->channel_size = 4;
+            break;
+        }
+        default : { return HSA_STATUS_ERROR_INVALID_ARGUMENT; }
+    }
+
+    uint32_t ii;
+    layout->element_size = layout->channel_size * num_channels;
+    layout->num_channels = num_channels;
+    for (ii = 0; ii < num_channels; ++ii) {
+        layout->components[ii] = components[ii];
+        layout->shifts[ii] = 0;
+        layout->widths[ii] = 8 * layout->channel_size;
+    }
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Get the size of an element of a format
+uint32_t image_format_get_element_size(const hsa_ext_image_format_t* format) {
+    image_format_layout_t layout;
+    if (HSA_STATUS_SUCCESS != image_format_get_layout(format, &layout)) {
+        return 0;
+    }
+
+    return layout.element_size;
+}
+
+// Read the raw value of a channel of an element
+int64_t image_format_read_channel(const image_format_layout_t* layout,
+                                  const void* element,
+                                  uint32_t channel) {
+    if (0 == layout->channel_size) {
+        uint32_t word;
+        if (2 == layout->element_size) {
+            uint16_t half_word;
+            memcpy(&half_word, element, sizeof(uint16_t));
+            word = half_word;
+        } else {
+            memcpy(&word, element, sizeof(uint32_t));
+        }
+        return (word >> layout->shifts[channel]) & ((1u << layout->widths[channel]) - 1);
+    }
+
+    const uint8_t* ptr = (const uint8_t*) element + channel * layout->channel_size;
+    switch (layout->channel_size) {
+        case 1 : {
+            return layout->is_signed ? (int64_t) (int8_t) ptr[0] : (int64_t) ptr[0];
+        }
+        case 2 : {
+            uint16_t value;
+            memcpy(&value, ptr, sizeof(uint16_t));
+            return layout->is_signed ? (int64_t) (int16_t) value : (int64_t) value;
+        }
+        default : {
+            uint32_t value;
+            memcpy(&value, ptr, sizeof(uint32_t));
+            return layout->is_signed ? (int64_t) (int32_t) value : (int64_t) value;
+        }
+    }
+}
+
+// Write the raw value of a channel of an element
+void image_format_write_channel(const image_format_layout_t* layout,
+                                void* element,
+                                uint32_t channel,
+                                int64_t raw) {
+    if (0 == layout->channel_size) {
+        uint32_t mask = ((1u << layout->widths[channel]) - 1) << layout->shifts[channel];
+        uint32_t field = ((uint32_t) raw << layout->shifts[channel]) & mask;
+        if (2 == layout->element_size) {
+            uint16_t half_word;
+            memcpy(&half_word, element, sizeof(uint16_t));
+            half_word = (uint16_t) ((half_word & ~mask) | field);
+            memcpy(element, &half_word, sizeof(uint16_t));
+        } else {
+            uint32_t word;
+            memcpy(&word, element, sizeof(uint32_t));
+            word = (word & ~mask) | field;
+            memcpy(element, &word, sizeof(uint32_t));
+        }
+        return;
+    }
+
+    uint8_t* ptr = (uint8_t*) element + channel * layout->channel_size;
+    switch (layout->channel_size) {
+        case 1 : {
+            ptr[0] = (uint8_t) raw;
+            break;
+        }
+        case 2 : {
+            uint16_t value = (uint16_t) raw;
+            memcpy(ptr, &value, sizeof(uint16_t));
+            break;
+        }
+        default : {
+            uint32_t value = (uint32_t) raw;
+            memcpy(ptr, &value, sizeof(uint32_t));
+            break;
+        }
+    }
+
+    return;
+}
+
+// Decode the raw value of a normalized channel
+double image_format_decode_norm(const image_format_layout_t* layout,
+                                uint32_t channel,
+                                int64_t raw) {
+    uint32_t width = layout->widths[channel];
+    if (layout->is_signed) {
+        double value = (double) raw / (double) ((1ll << (width - 1)) - 1);
+        return (value < -1.0) ? -1.0 : value;
+    }
+
+    return (double) raw / (double) ((1ll << width) - 1);
+}
+
+// Convert a single precision value to half precision
+uint16_t image_format_float_to_half(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(float));
+
+    uint16_t sign = (uint16_t) ((bits >> 16) & 0x8000);
+    int32_t exponent = (int32_t) ((bits >> 23) & 0xff);
+    uint32_t mantissa = bits & 0x7fffff;
+
+    // Infinities stay infinite and NaNs stay quiet NaNs
+    if (0xff == exponent) {
+        return sign | 0x7c00 | (0 == mantissa ? 0 : 0x200);
+    }
+
+    exponent = exponent - 127 + 15;
+    if (exponent >= 0x1f) {
+        return sign | 0x7c00;
+    }
+
+    // The values below the smallest normal half are denormalized, down to
+    // half of the smallest denormal
+    uint32_t shift = 13;
+    uint32_t half;
+    if (exponent <= 0) {
+        if (exponent < -10) {
+            return sign;
+        }
+        mantissa |= 0x800000;
+        shift = 14 - exponent;
+        half = mantissa >> shift;
+    } else {
+        half = ((uint32_t) exponent << 10) | (mantissa >> shift);
+    }
+
+    // Round to nearest even, a carry out of the mantissa correctly moves to
+    // the next exponent or to infinity
+    uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+    if (remainder > halfway || (remainder == halfway && (half & 0x1))) {
+        ++half;
+    }
+
+    return sign | (uint16_t) half;
+}
+
+// Convert a half precision value to single precision
+float image_format_half_to_float(uint16_t half) {
+    uint32_t sign = (half >> 15) & 0x1;
+    int32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+    float value;
+
+    if (0 == exponent) {
+        value = ldexpf((float) mantissa, -24);
+    } else if (0x1f == exponent) {
+        value = (0 == mantissa) ? INFINITY : NAN;
+    } else {
+        value = ldexpf((float) (mantissa | 0x400), exponent - 25);
+    }
+
+    return sign ? -value : value;
+}
+
+// Encode a linear value with the sRGB transfer function
+float image_format_linear_to_srgb(float value) {
+    if (value <= 0.0031308f) {
+        return 12.92f * value;
+    }
+
+    return 1.055f * powf(value, 1.0f / 2.4f) - 0.055f;
+}
+
+// Decode an sRGB encoded value to a linear value
+float image_format_srgb_to_linear(float value) {
+    if (value <= 0.04045f) {
+        return value / 12.92f;
+    }
+
+    return powf((value + 0.055f) / 1.055f, 2.4f);
+}
+
+// Get the largest raw value of a channel
+static int64_t get_raw_max(const image_format_layout_t* layout, uint32_t channel) {
+    uint32_t width = layout->widths[channel];
+    return layout->is_signed ? (1ll << (width - 1)) - 1 : (1ll << width) - 1;
+}
+
+// Encode a normalized value, clamped and rounded to the nearest even raw
+// value. Up to 16 bits the arithmetic is in single precision, as in the
+// vector paths, wider channels need double precision to be exact.
+static int64_t encode_norm(const image_format_layout_t* layout, uint32_t channel, float value) {
+    float lo = layout->is_signed ? -1.0f : 0.0f;
+    int64_t max = get_raw_max(layout, channel);
+
+    if (value != value) {
+        value = 0.0f;
+    }
+    value = (value > lo) ? value : lo;
+    value = (value < 1.0f) ? value : 1.0f;
+
+    if (layout->widths[channel] <= 16) {
+        return (int64_t) rintf(value * (float) max);
+    }
+
+    return (int64_t) rint((double) value * (double) max);
+}
+
+// Decode a normalized value, with the same precision as encode_norm
+static float decode_norm(const image_format_layout_t* layout, uint32_t channel, int64_t raw) {
+    if (layout->widths[channel] > 16) {
+        return (float) image_format_decode_norm(layout, channel, raw);
+    }
+
+    float value = (float) raw / (float) get_raw_max(layout, channel);
+    return (layout->is_signed && value < -1.0f) ? -1.0f : value;
+}
+
+// Encode the value of a component in a channel
+static int64_t encode_channel(const image_format_layout_t* layout,
+                              uint32_t channel,
+                              const uint8_t* values,
+                              int32_t component) {
+    int64_t max = get_raw_max(layout, channel);
+
+    switch (layout->value_type) {
+        case IMAGE_FORMAT_VALUE_INT32 : {
+            int32_t value;
+            memcpy(&value, values + component * sizeof(int32_t), sizeof(int32_t));
+            int64_t min = -max - 1;
+            return (value < min) ? min : ((value > max) ? max : value);
+        }
+        case IMAGE_FORMAT_VALUE_UINT32 : {
+            uint32_t value;
+            memcpy(&value, values + component * sizeof(uint32_t), sizeof(uint32_t));
+            return (value > max) ? max : value;
+        }
+        default : {
+            break;
+        }
+    }
+
+    float value;
+    memcpy(&value, values + component * sizeof(float), sizeof(float));
+    switch (layout->channel_type) {
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT : {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(float));
+            return bits;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT : {
+            return image_format_float_to_half(value);
+        }
+        default : {
+            break;
+        }
+    }
+
+    if (layout->is_srgb && 3 != component) {
+        value = (value > 0.0f) ? value : 0.0f;
+        value = (value < 1.0f) ? value : 1.0f;
+        value = image_format_linear_to_srgb(value);
+    }
+
+    return encode_norm(layout, channel, value);
+}
+
+// Decode the raw value of a channel into the value of its component
+static void decode_channel(const image_format_layout_t* layout,
+                           uint32_t channel,
+                           int64_t raw,
+                           uint8_t* values,
+                           int32_t component) {
+    switch (layout->value_type) {
+        case IMAGE_FORMAT_VALUE_INT32 : {
+            int32_t value = (int32_t) raw;
+            memcpy(values + component * sizeof(int32_t), &value, sizeof(int32_t));
+            return;
+        }
+        case IMAGE_FORMAT_VALUE_UINT32 : {
+            uint32_t value = (uint32_t) raw;
+            memcpy(values + component * sizeof(uint32_t), &value, sizeof(uint32_t));
+            return;
+        }
+        default : {
+            break;
+        }
+    }
+
+    float value;
+    switch (layout->channel_type) {
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT : {
+            uint32_t bits = (uint32_t) raw;
+            memcpy(&value, &bits, sizeof(float));
+            break;
+        }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT : {
+            value = image_format_half_to_float((uint16_t) raw);
+            break;
+        }
+        default : {
+            value = decode_norm(layout, channel, raw);
+            if (layout->is_srgb && 3 != component) {
+                value = image_format_srgb_to_linear(value);
+            }
+            break;
+        }
+    }
+
+    memcpy(values + component * sizeof(float), &value, sizeof(float));
+    return;
+}
+
+// Get the value of the components missing from an element
+static uint32_t get_default_value(const image_format_layout_t* layout, int32_t component) {
+    if (3 != component) {
+        return 0;
+    }
+
+    if (IMAGE_FORMAT_VALUE_FLOAT != layout->value_type) {
+        return 1;
+    }
+
+    float one = 1.0f;
+    uint32_t bits;
+    memcpy(&bits, &one, sizeof(float));
+    return bits;
+}
+
+// Pack elements one at a time
+static void pack_scalar(const image_format_layout_t* layout,
+                        const uint8_t* values,
+                        uint8_t* elements,
+                        size_t count) {
+    size_t ii;
+    uint32_t jj;
+
+    for (ii = 0; ii < count; ++ii) {
+        const uint8_t* element_values = values + ii * IMAGE_FORMAT_VALUES_SIZE;
+        uint8_t* element = elements + ii * layout->element_size;
+
+        // The bit fields are merged into a cleared word
+        if (0 == layout->channel_size) {
+            memset(element, 0, layout->element_size);
+        }
+
+        for (jj = 0; jj < layout->num_channels; ++jj) {
+            int32_t component = layout->components[jj];
+            int64_t raw = (component < 0) ? 0 : encode_channel(layout, jj, element_values, component);
+            image_format_write_channel(layout, element, jj, raw);
+        }
+    }
+
+    return;
+}
+
+// Unpack elements one at a time
+static void unpack_scalar(const image_format_layout_t* layout,
+                          const uint8_t* elements,
+                          uint8_t* values,
+                          size_t count) {
+    size_t ii;
+    uint32_t jj;
+
+    for (ii = 0; ii < count; ++ii) {
+        const uint8_t* element = elements + ii * layout->element_size;
+        uint8_t* element_values = values + ii * IMAGE_FORMAT_VALUES_SIZE;
+        uint32_t components[4];
+
+        for (jj = 0; jj < 4; ++jj) {
+            components[jj] = get_default_value(layout, jj);
+        }
+        memcpy(element_values, components, IMAGE_FORMAT_VALUES_SIZE);
+
+        for (jj = 0; jj < layout->num_channels; ++jj) {
+            int32_t component = layout->components[jj];
+            if (component >= 0) {
+                decode_channel(layout, jj, image_format_read_channel(layout, element, jj), element_values, component);
+            }
+        }
+
+        // Intensity is replicated to all of the components, luminance to
+        // all but alpha
+        if (HSA_EXT_IMAGE_CHANNEL_ORDER_INTENSITY == layout->channel_order) {
+            memcpy(element_values + 4, element_values, 4);
+            memcpy(element_values + 8, element_values, 8);
+        } else if (HSA_EXT_IMAGE_CHANNEL_ORDER_LUMINANCE == layout->channel_order) {
+            memcpy(element_values + 4, element_values, 4);
+            memcpy(element_values + 8, element_values, 4);
+        }
+    }
+
+    return;
+}
+
+// Check if the vector paths can convert a layout. They handle the 8 and 16
+// bit normalized and integer channels, the formats with fewer than four
+// channels through four channel elements.
+static int has_vector_layout(const image_format_layout_t* layout) {
+    return (1 == layout->channel_size || 2 == layout->channel_size) &&
+           HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT != layout->channel_type &&
+           HSA_EXT_IMAGE_CHANNEL_ORDER_INTENSITY != layout->channel_order &&
+           HSA_EXT_IMAGE_CHANNEL_ORDER_LUMINANCE != layout->channel_order &&
+           !layout->is_srgb;
+}
+
+// Get the four channel layout of a layout, the added channels are padding
+static void get_wide_layout(const image_format_layout_t* layout, image_format_layout_t* wide) {
+    uint32_t ii;
+
+    *wide = *layout;
+    wide->num_channels = 4;
+    wide->element_size = 4 * layout->channel_size;
+    for (ii = layout->num_channels; ii < 4; ++ii) {
+        wide->components[ii] = -1;
+        wide->shifts[ii] = 0;
+        wide->widths[ii] = 8 * layout->channel_size;
+    }
+
+    return;
+}
+
+// Copy count elements of size bytes between buffers with different strides
+static void copy_elements(uint8_t* dst,
+                          size_t dst_stride,
+                          const uint8_t* src,
+                          size_t src_stride,
+                          size_t size,
+                          size_t count) {
+    size_t ii;
+
+    // Constant sizes let the copies be single moves
+#define IMAGE_FORMAT_COPY_ELEMENTS(__size__)                                    \
+    for (ii = 0; ii < count; ++ii) {                                            \
+        memcpy(dst + ii * dst_stride, src + ii * src_stride, __size__);         \
+    }
+
+    switch (size) {
+        case 1 : { IMAGE_FORMAT_COPY_ELEMENTS(1); break; }
+        case 2 : { IMAGE_FORMAT_COPY_ELEMENTS(2); break; }
+        case 3 : { IMAGE_FORMAT_COPY_ELEMENTS(3); break; }
+        case 4 : { IMAGE_FORMAT_COPY_ELEMENTS(4); break; }
+        case 6 : { IMAGE_FORMAT_COPY_ELEMENTS(6); break; }
+        default : { IMAGE_FORMAT_COPY_ELEMENTS(size); break; }
+    }
+
+#undef IMAGE_FORMAT_COPY_ELEMENTS
+
+    return;
+}
+
+// Prepare the permutations and constants of the vector paths
+static void prepare_vector(const image_format_layout_t* layout, format_vector_t* vector) {
+    uint32_t ii, jj;
+
+    memset(vector, 0, sizeof(format_vector_t));
+
+    for (ii = 0; ii < 4; ++ii) {
+        vector->defaults[ii] = get_default_value(layout, ii);
+    }
+
+    for (ii = 0; ii < layout->num_channels; ++ii) {
+        int32_t component = layout->components[ii];
+        if (component < 0) {
+            continue;
+        }
+        vector->pack_index[ii] = component;
+        vector->pack_keep[ii] = -1;
+        vector->unpack_index[component] = ii;
+        vector->unpack_keep[component] = -1;
+    }
+
+    for (ii = 0; ii < 4; ++ii) {
+        for (jj = 0; jj < 4; ++jj) {
+            vector->pack_bytes[4 * ii + jj] = (uint8_t) (4 * vector->pack_index[ii] + jj);
+            vector->unpack_bytes[4 * ii + jj] = (uint8_t) (4 * vector->unpack_index[ii] + jj);
+        }
+    }
+
+    vector->scale = (float) get_raw_max(layout, 0);
+    vector->lo = layout->is_signed ? -1.0f : 0.0f;
+    vector->max = (uint32_t) get_raw_max(layout, 0);
+
+    return;
+}
+
+#if defined(IMAGE_FORMAT_AVX2)
+// Pack elements 8 at a time, returns the number of elements packed
+__attribute__((target("avx2")))
+static size_t pack_avx2(const image_format_layout_t* layout,
+                        const format_vector_t* vector,
+                        const void* values,
+                        void* elements,
+                        size_t count) {
+    __m256i index = _mm256_setr_epi32(vector->pack_index[0], vector->pack_index[1],
+                                      vector->pack_index[2], vector->pack_index[3],
+                                      vector->pack_index[0], vector->pack_index[1],
+                                      vector->pack_index[2], vector->pack_index[3]);
+    __m256i keep = _mm256_setr_epi32(vector->pack_keep[0], vector->pack_keep[1],
+                                     vector->pack_keep[2], vector->pack_keep[3],
+                                     vector->pack_keep[0], vector->pack_keep[1],
+                                     vector->pack_keep[2], vector->pack_keep[3]);
+    __m256i max = _mm256_set1_epi32((int32_t) vector->max);
+    __m256 scale = _mm256_set1_ps(vector->scale);
+    __m256 lo = _mm256_set1_ps(vector->lo);
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    const image_format_value_t value_type = layout->value_type;
+    const uint32_t channel_size = layout->channel_size;
+    const int is_signed = layout->is_signed;
+    size_t num_blocks = count / 8;
+    size_t ii;
+    uint32_t jj;
+
+    for (ii = 0; ii < num_blocks; ++ii) {
+        const uint8_t* src = (const uint8_t*) values + ii * 8 * IMAGE_FORMAT_VALUES_SIZE;
+        uint8_t* dst = (uint8_t*) elements + ii * 8 * 4 * channel_size;
+        __m256i raw[4];
+
+        // Each vector holds two elements
+        for (jj = 0; jj < 4; ++jj) {
+            __m256i x = _mm256_loadu_si256((const __m256i*) (src + 32 * jj));
+            x = _mm256_castps_si256(_mm256_permutevar_ps(_mm256_castsi256_ps(x), index));
+            if (IMAGE_FORMAT_VALUE_FLOAT == value_type) {
+                __m256 v = _mm256_castsi256_ps(x);
+                v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+                v = _mm256_min_ps(_mm256_max_ps(v, lo), one);
+                x = _mm256_cvtps_epi32(_mm256_mul_ps(v, scale));
+            } else if (IMAGE_FORMAT_VALUE_UINT32 == value_type) {
+                x = _mm256_min_epu32(x, max);
+            }
+            raw[jj] = _mm256_and_si256(x, keep);
+        }
+
+        // The saturating packs interleave the 128 bit lanes, the elements
+        // are put back in order afterwards
+        if (1 == channel_size) {
+            __m256i a = _mm256_packs_epi32(raw[0], raw[1]);
+            __m256i b = _mm256_packs_epi32(raw[2], raw[3]);
+            __m256i c = is_signed ? _mm256_packs_epi16(a, b) : _mm256_packus_epi16(a, b);
+            _mm256_storeu_si256((__m256i*) dst, _mm256_permutevar8x32_epi32(c, order));
+        } else if (is_signed) {
+            __m256i a = _mm256_packs_epi32(raw[0], raw[1]);
+            __m256i b = _mm256_packs_epi32(raw[2], raw[3]);
+            _mm256_storeu_si256((__m256i*) dst, _mm256_permute4x64_epi64(a, 0xd8));
+            _mm256_storeu_si256((__m256i*) (dst + 32), _mm256_permute4x64_epi64(b, 0xd8));
+        } else {
+            __m256i a = _mm256_packus_epi32(raw[0], raw[1]);
+            __m256i b = _mm256_packus_epi32(raw[2], raw[3]);
+            _mm256_storeu_si256((__m256i*) dst, _mm256_permute4x64_epi64(a, 0xd8));
+            _mm256_storeu_si256((__m256i*) (dst + 32), _mm256_permute4x64_epi64(b, 0xd8));
+        }
+    }
+
+    return num_blocks * 8;
+}
+
+// Unpack elements 2 at a time, returns the number of elements unpacked
+__attribute__((target("avx2")))
+static size_t unpack_avx2(const image_format_layout_t* layout,
+                          const format_vector_t* vector,
+                          const void* elements,
+                          void* values,
+                          size_t count) {
+    __m256i index = _mm256_setr_epi32(vector->unpack_index[0], vector->unpack_index[1],
+                                      vector->unpack_index[2], vector->unpack_index[3],
+                                      vector->unpack_index[0], vector->unpack_index[1],
+                                      vector->unpack_index[2], vector->unpack_index[3]);
+    __m256i keep = _mm256_setr_epi32(vector->unpack_keep[0], vector->unpack_keep[1],
+                                     vector->unpack_keep[2], vector->unpack_keep[3],
+                                     vector->unpack_keep[0], vector->unpack_keep[1],
+                                     vector->unpack_keep[2], vector->unpack_keep[3]);
+    __m256i defaults = _mm256_setr_epi32((int32_t) vector->defaults[0], (int32_t) vector->defaults[1],
+                                         (int32_t) vector->defaults[2], (int32_t) vector->defaults[3],
+                                         (int32_t) vector->defaults[0], (int32_t) vector->defaults[1],
+                                         (int32_t) vector->defaults[2], (int32_t) vector->defaults[3]);
+    __m256 scale = _mm256_set1_ps(vector->scale);
+    __m256 lo = _mm256_set1_ps(vector->lo);
+    const image_format_value_t value_type = layout->value_type;
+    const uint32_t channel_size = layout->channel_size;
+    const int is_signed = layout->is_signed;
+    size_t num_blocks = count / 2;
+    size_t ii;
+
+    for (ii = 0; ii < num_blocks; ++ii) {
+        const uint8_t* src = (const uint8_t*) elements + ii * 2 * 4 * channel_size;
+        uint8_t* dst = (uint8_t*) values + ii * 2 * IMAGE_FORMAT_VALUES_SIZE;
+        __m256i x;
+
+        if (1 == channel_size) {
+            __m128i bytes = _mm_loadl_epi64((const __m128i*) src);
+            x = is_signed ? _mm256_cvtepi8_epi32(bytes) : _mm256_cvtepu8_epi32(bytes);
+        } else {
+            __m128i words = _mm_loadu_si128((const __m128i*) src);
+            x = is_signed ? _mm256_cvtepi16_epi32(words) : _mm256_cvtepu16_epi32(words);
+        }
+
+        if (IMAGE_FORMAT_VALUE_FLOAT == value_type) {
+            __m256 v = _mm256_div_ps(_mm256_cvtepi32_ps(x), scale);
+            x = _mm256_castps_si256(_mm256_max_ps(v, lo));
+        }
+
+        x = _mm256_castps_si256(_mm256_permutevar_ps(_mm256_castsi256_ps(x), index));
+        _mm256_storeu_si256((__m256i*) dst, _mm256_blendv_epi8(defaults, x, keep));
+    }
+
+    return num_blocks * 2;
+}
+#endif
+
+#if defined(IMAGE_FORMAT_NEON)
+// Pack elements 4 at a time, returns the number of elements packed
+static size_t pack_neon(const image_format_layout_t* layout,
+                        const format_vector_t* vector,
+                        const void* values,
+                        void* elements,
+                        size_t count) {
+    uint8x16_t index = vld1q_u8(vector->pack_bytes);
+    int32x4_t keep = vld1q_s32(vector->pack_keep);
+    uint32x4_t max = vdupq_n_u32(vector->max);
+    float32x4_t scale = vdupq_n_f32(vector->scale);
+    float32x4_t lo = vdupq_n_f32(vector->lo);
+    float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t zero = vdupq_n_f32(0.0f);
+    size_t num_blocks = count / 4;
+    size_t ii;
+    uint32_t jj;
+
+    for (ii = 0; ii < num_blocks; ++ii) {
+        const uint8_t* src = (const uint8_t*) values + ii * 4 * IMAGE_FORMAT_VALUES_SIZE;
+        uint8_t* dst = (uint8_t*) elements + ii * 4 * layout->element_size;
+        int32x4_t raw[4];
+
+        // Each vector holds one element
+        for (jj = 0; jj < 4; ++jj) {
+            uint8x16_t x = vqtbl1q_u8(vld1q_u8(src + IMAGE_FORMAT_VALUES_SIZE * jj), index);
+            int32x4_t r;
+            if (IMAGE_FORMAT_VALUE_FLOAT == layout->value_type) {
+                float32x4_t v = vreinterpretq_f32_u8(x);
+                v = vbslq_f32(vceqq_f32(v, v), v, zero);
+                v = vminq_f32(vmaxq_f32(v, lo), one);
+                r = vcvtnq_s32_f32(vmulq_f32(v, scale));
+            } else if (IMAGE_FORMAT_VALUE_UINT32 == layout->value_type) {
+                r = vreinterpretq_s32_u32(vminq_u32(vreinterpretq_u32_u8(x), max));
+            } else {
+                r = vreinterpretq_s32_u8(x);
+            }
+            raw[jj] = vandq_s32(r, keep);
+        }
+
+        if (1 == layout->channel_size) {
+            int16x8_t a = vcombine_s16(vqmovn_s32(raw[0]), vqmovn_s32(raw[1]));
+            int16x8_t b = vcombine_s16(vqmovn_s32(raw[2]), vqmovn_s32(raw[3]));
+            if (layout->is_signed) {
+                vst1q_s8((int8_t*) dst, vcombine_s8(vqmovn_s16(a), vqmovn_s16(b)));
+            } else {
+                vst1q_u8(dst, vcombine_u8(vqmovun_s16(a), vqmovun_s16(b)));
+            }
+        } else if (layout->is_signed) {
+            vst1q_s16((int16_t*) dst, vcombine_s16(vqmovn_s32(raw[0]), vqmovn_s32(raw[1])));
+            vst1q_s16((int16_t*) (dst + 16), vcombine_s16(vqmovn_s32(raw[2]), vqmovn_s32(raw[3])));
+        } else {
+            vst1q_u16((uint16_t*) dst, vcombine_u16(vqmovun_s32(raw[0]), vqmovun_s32(raw[1])));
+            vst1q_u16((uint16_t*) (dst + 16), vcombine_u16(vqmovun_s32(raw[2]), vqmovun_s32(raw[3])));
+        }
+    }
+
+    return num_blocks * 4;
+}
+
+// Unpack elements 4 at a time, returns the number of elements unpacked
+static size_t unpack_neon(const image_format_layout_t* layout,
+                          const format_vector_t* vector,
+                          const void* elements,
+                          void* values,
+                          size_t count) {
+    uint8x16_t index = vld1q_u8(vector->unpack_bytes);
+    uint32x4_t keep = vld1q_u32((const uint32_t*) vector->unpack_keep);
+    uint32x4_t defaults = vld1q_u32(vector->defaults);
+    float32x4_t scale = vdupq_n_f32(vector->scale);
+    float32x4_t lo = vdupq_n_f32(vector->lo);
+    size_t num_blocks = count / 4;
+    size_t ii;
+    uint32_t jj;
+
+    for (ii = 0; ii < num_blocks; ++ii) {
+        const uint8_t* src = (const uint8_t*) elements + ii * 4 * layout->element_size;
+        uint8_t* dst = (uint8_t*) values + ii * 4 * IMAGE_FORMAT_VALUES_SIZE;
+        int32x4_t raw[4];
+
+        if (1 == layout->channel_size && layout->is_signed) {
+            int8x16_t x = vld1q_s8((const int8_t*) src);
+            int16x8_t a = vmovl_s8(vget_low_s8(x));
+            int16x8_t b = vmovl_s8(vget_high_s8(x));
+            raw[0] = vmovl_s16(vget_low_s16(a)); raw[1] = vmovl_s16(vget_high_s16(a));
+            raw[2] = vmovl_s16(vget_low_s16(b)); raw[3] = vmovl_s16(vget_high_s16(b));
+        } else if (1 == layout->channel_size) {
+            uint8x16_t x = vld1q_u8(src);
+            uint16x8_t a = vmovl_u8(vget_low_u8(x));
+            uint16x8_t b = vmovl_u8(vget_high_u8(x));
+            raw[0] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(a)));
+            raw[1] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(a)));
+            raw[2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(b)));
+            raw[3] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(b)));
+        } else if (layout->is_signed) {
+            int16x8_t a = vld1q_s16((const int16_t*) src);
+            int16x8_t b = vld1q_s16((const int16_t*) (src + 16));
+            raw[0] = vmovl_s16(vget_low_s16(a)); raw[1] = vmovl_s16(vget_high_s16(a));
+            raw[2] = vmovl_s16(vget_low_s16(b)); raw[3] = vmovl_s16(vget_high_s16(b));
+        } else {
+            uint16x8_t a = vld1q_u16((const uint16_t*) src);
+            uint16x8_t b = vld1q_u16((const uint16_t*) (src + 16));
+            raw[0] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(a)));
+            raw[1] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(a)));
+            raw[2] = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(b)));
+            raw[3] = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(b)));
+        }
+
+        for (jj = 0; jj < 4; ++jj) {
+            uint32x4_t x = vreinterpretq_u32_s32(raw[jj]);
+            if (IMAGE_FORMAT_VALUE_FLOAT == layout->value_type) {
+                float32x4_t v = vdivq_f32(vcvtq_f32_s32(raw[jj]), scale);
+                x = vreinterpretq_u32_f32(vmaxq_f32(v, lo));
+            }
+            x = vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(x), index));
+            vst1q_u32((uint32_t*) (dst + IMAGE_FORMAT_VALUES_SIZE * jj), vbslq_u32(keep, x, defaults));
+        }
+    }
+
+    return num_blocks * 4;
+}
+#endif
+
+// Select the vector paths of the host, returns the name of the instruction
+// set, or NULL if there are none
+static const char* get_vector_fns(format_pack_fn_t* pack_fn, format_unpack_fn_t* unpack_fn) {
+#if defined(IMAGE_FORMAT_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        *pack_fn = pack_avx2;
+        *unpack_fn = unpack_avx2;
+        return "avx2";
+    }
+#elif defined(IMAGE_FORMAT_NEON)
+    *pack_fn = pack_neon;
+    *unpack_fn = unpack_neon;
+    return "neon";
+#endif
+    *pack_fn = NULL;
+    *unpack_fn = NULL;
+    return NULL;
+}
+
+// Get the instruction set of the vector paths
+const char* image_format_get_isa(void) {
+    format_pack_fn_t pack_fn;
+    format_unpack_fn_t unpack_fn;
+    const char* isa = get_vector_fns(&pack_fn, &unpack_fn);
+    return (NULL == isa) ? "scalar" : isa;
+}
+
+// Check if a format has a vector path on this host
+int image_format_has_vector_path(const hsa_ext_image_format_t* format) {
+    image_format_layout_t layout;
+    format_pack_fn_t pack_fn;
+    format_unpack_fn_t unpack_fn;
+
+    return HSA_STATUS_SUCCESS == image_format_get_layout(format, &layout) &&
+           has_vector_layout(&layout) &&
+           NULL != get_vector_fns(&pack_fn, &unpack_fn);
+}
+
+// Pack values with the vector path, returns the number of elements packed
+static size_t pack_vector(const image_format_layout_t* layout,
+                          format_pack_fn_t pack_fn,
+                          const uint8_t* values,
+                          uint8_t* elements,
+                          size_t count) {
+    image_format_layout_t wide;
+    format_vector_t vector;
+    get_wide_layout(layout, &wide);
+    prepare_vector(&wide, &vector);
+
+    if (4 == layout->num_channels) {
+        return pack_fn(layout, &vector, values, elements, count);
+    }
+
+    // The formats with fewer channels are packed as four channel elements,
+    // then the padding channels are dropped
+    uint8_t buffer[IMAGE_FORMAT_WIDE_ELEMENTS * 8];
+    size_t done = 0;
+    while (count - done >= IMAGE_FORMAT_WIDE_ELEMENTS) {
+        pack_fn(&wide, &vector, values + done * IMAGE_FORMAT_VALUES_SIZE, buffer, IMAGE_FORMAT_WIDE_ELEMENTS);
+        copy_elements(elements + done * layout->element_size, layout->element_size,
+                      buffer, wide.element_size, layout->element_size, IMAGE_FORMAT_WIDE_ELEMENTS);
+        done += IMAGE_FORMAT_WIDE_ELEMENTS;
+    }
+
+    return done;
+}
+
+// Unpack elements with the vector path, returns the number of elements
+// unpacked
+static size_t unpack_vector(const image_format_layout_t* layout,
+                            format_unpack_fn_t unpack_fn,
+                            const uint8_t* elements,
+                            uint8_t* values,
+                            size_t count) {
+    image_format_layout_t wide;
+    format_vector_t vector;
+    get_wide_layout(layout, &wide);
+    prepare_vector(&wide, &vector);
+
+    if (4 == layout->num_channels) {
+        return unpack_fn(layout, &vector, elements, values, count);
+    }
+
+    // The formats with fewer channels are spread into four channel
+    // elements, the padding channels are replaced by the default values
+    uint8_t buffer[IMAGE_FORMAT_WIDE_ELEMENTS * 8];
+    size_t done = 0;
+    memset(buffer, 0, sizeof(buffer));
+    while (count - done >= IMAGE_FORMAT_WIDE_ELEMENTS) {
+        copy_elements(buffer, wide.element_size, elements + done * layout->element_size, layout->element_size,
+                      layout->element_size, IMAGE_FORMAT_WIDE_ELEMENTS);
+        unpack_fn(&wide, &vector, buffer, values + done * IMAGE_FORMAT_VALUES_SIZE, IMAGE_FORMAT_WIDE_ELEMENTS);
+        done += IMAGE_FORMAT_WIDE_ELEMENTS;
+    }
+
+    return done;
+}
+
+// Pack values with the vector path when there is one, the remaining
+// elements with the scalar code
+static hsa_status_t pack(const hsa_ext_image_format_t* format,
+                         const void* values,
+                         void* elements,
+                         size_t count,
+                         int use_vector) {
+    image_format_layout_t layout;
+    if (HSA_STATUS_SUCCESS != image_format_get_layout(format, &layout)) {
+        return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    format_pack_fn_t pack_fn;
+    format_unpack_fn_t unpack_fn;
+    size_t done = 0;
+    if (use_vector && has_vector_layout(&layout) && NULL != get_vector_fns(&pack_fn, &unpack_fn)) {
+        done = pack_vector(&layout, pack_fn, (const uint8_t*) values, (uint8_t*) elements, count);
+    }
+
+    pack_scalar(&layout,
+                (const uint8_t*) values + done * IMAGE_FORMAT_VALUES_SIZE,
+                (uint8_t*) elements + done * layout.element_size,
+                count - done);
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Unpack elements with the vector path when there is one, the remaining
+// elements with the scalar code
+static hsa_status_t unpack(const hsa_ext_image_format_t* format,
+                           const void* elements,
+                           void* values,
+                           size_t count,
+                           int use_vector) {
+    image_format_layout_t layout;
+    if (HSA_STATUS_SUCCESS != image_format_get_layout(format, &layout)) {
+        return HSA_STATUS_ERROR_INVALID_ARGUMENT;
+    }
+
+    format_pack_fn_t pack_fn;
+    format_unpack_fn_t unpack_fn;
+    size_t done = 0;
+    if (use_vector && has_vector_layout(&layout) && NULL != get_vector_fns(&pack_fn, &unpack_fn)) {
+        done = unpack_vector(&layout, unpack_fn, (const uint8_t*) elements, (uint8_t*) values, count);
+    }
+
+    unpack_scalar(&layout,
+                  (const uint8_t*) elements + done * layout.element_size,
+                  (uint8_t*) values + done * IMAGE_FORMAT_VALUES_SIZE,
+                  count - done);
+
+    return HSA_STATUS_SUCCESS;
+}
+
+// Pack RGBA values into the elements of a format
+hsa_status_t image_format_pack(const hsa_ext_image_format_t* format,
+                               const void* values,
+                               void* elements,
+                               size_t count) {
+    return pack(format, values, elements, count, 1);
+}
+
+// Unpack the elements of a format into RGBA values
+hsa_status_t image_format_unpack(const hsa_ext_image_format_t* format,
+                                 const void* elements,
+                                 void* values,
+                                 size_t count) {
+    return unpack(format, elements, values, count, 1);
+}
+
+// Pack RGBA values one element at a time
+hsa_status_t image_format_pack_scalar(const hsa_ext_image_format_t* format,
+                                      const void* values,
+                                      void* elements,
+                                      size_t count) {
+    return pack(format, values, elements, count, 0);
+}
+
+// Unpack elements one at a time
+hsa_status_t image_format_unpack_scalar(const hsa_ext_image_format_t* format,
+                                        const void* elements,
+                                        void* values,
+                                        size_t count) {
+    return unpack(format, elements, values, count, 0);
+}
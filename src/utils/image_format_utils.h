@@ -0,0 +1,228 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef _IMAGE_FORMAT_UTILS_H_
+#define _IMAGE_FORMAT_UTILS_H_
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief the type of the values of an unpacked element
+ */
+typedef enum image_format_value_e {
+    IMAGE_FORMAT_VALUE_FLOAT = 0,
+    IMAGE_FORMAT_VALUE_INT32,
+    IMAGE_FORMAT_VALUE_UINT32
+} image_format_value_t;
+
+/**
+ * @brief how the channels of an element are stored
+ */
+typedef struct image_format_layout_s {
+    hsa_ext_image_channel_type_t channel_type;
+    hsa_ext_image_channel_order_t channel_order;
+    uint32_t element_size;
+    // 0 if the channels are bit fields of one word
+    uint32_t channel_size;
+    uint32_t num_channels;
+    // The component of each channel, -1 for padding
+    int32_t components[4];
+    // The position of each bit field
+    uint32_t shifts[4];
+    // The number of bits of each channel
+    uint32_t widths[4];
+    int is_signed;
+    int is_srgb;
+    image_format_value_t value_type;
+} image_format_layout_t;
+
+/**
+ * @brief get the storage layout of a format
+ * @param format The format of the image
+ * @param layout The layout, filled in on success
+ * @return HSA_STATUS_SUCCESS, or HSA_STATUS_ERROR_INVALID_ARGUMENT if the
+ * channel type and order do not form a valid format
+ */
+hsa_status_t image_format_get_layout(const hsa_ext_image_format_t* format,
+                                     image_format_layout_t* layout);
+
+/**
+ * @brief get the size in bytes of an element of a format
+ * @param format The format of the image
+ * @return the element size, 0 if the format is unknown
+ */
+uint32_t image_format_get_element_size(const hsa_ext_image_format_t* format);
+
+/**
+ * @brief get the type of the values a channel type is unpacked to
+ * @param channel_type The channel type
+ * @return int32_t for signed integer types, uint32_t for unsigned integer
+ * types and float otherwise, as for the verify_image_region kernels
+ */
+image_format_value_t image_format_get_value_type(hsa_ext_image_channel_type_t channel_type);
+
+/**
+ * @brief read the raw value of a channel of an element, sign extended for
+ * the signed types
+ */
+int64_t image_format_read_channel(const image_format_layout_t* layout,
+                                  const void* element,
+                                  uint32_t channel);
+
+/**
+ * @brief write the raw value of a channel of an element, the other channels
+ * of a packed element are left unchanged
+ */
+void image_format_write_channel(const image_format_layout_t* layout,
+                                void* element,
+                                uint32_t channel,
+                                int64_t raw);
+
+/**
+ * @brief decode the raw value of a normalized channel to [0, 1] or [-1, 1]
+ * @details Double precision keeps the 24 bit channels exact.
+ */
+double image_format_decode_norm(const image_format_layout_t* layout,
+                                uint32_t channel,
+                                int64_t raw);
+
+/**
+ * @brief convert a single precision value to half precision, rounding to
+ * the nearest even value
+ */
+uint16_t image_format_float_to_half(float value);
+
+/**
+ * @brief convert a half precision value to single precision
+ */
+float image_format_half_to_float(uint16_t half);
+
+/**
+ * @brief encode a linear value with the sRGB transfer function
+ */
+float image_format_linear_to_srgb(float value);
+
+/**
+ * @brief decode an sRGB encoded value to a linear value
+ */
+float image_format_srgb_to_linear(float value);
+
+/**
+ * @brief get the name of the instruction set of the vector paths of
+ * image_format_pack and image_format_unpack, "avx2", "neon" or "scalar"
+ * @return the name
+ */
+const char* image_format_get_isa(void);
+
+/**
+ * @brief check if image_format_pack and image_format_unpack have a vector
+ * path for a format
+ * @param format The format of the image
+ * @return 1 if the format has a vector path on this host, 0 otherwise
+ */
+int image_format_has_vector_path(const hsa_ext_image_format_t* format);
+
+/**
+ * @brief pack RGBA values into the elements of a format
+ * @details The values are four float, int32_t or uint32_t per element as
+ * returned by image_format_get_value_type, in red, green, blue, alpha
+ * order. Normalized channels are clamped and rounded to the nearest even
+ * raw value, NaNs give 0. sRGB orders encode red, green and blue with the
+ * sRGB transfer function. Integer channels saturate to the range of the
+ * channel. Padding channels are written as 0.
+ * @param format The format of the image
+ * @param values The values of count elements
+ * @param elements The count packed elements
+ * @param count The number of elements
+ * @return HSA_STATUS_SUCCESS, or HSA_STATUS_ERROR_INVALID_ARGUMENT if the
+ * format is unknown
+ */
+hsa_status_t image_format_pack(const hsa_ext_image_format_t* format,
+                               const void* values,
+                               void* elements,
+                               size_t count);
+
+/**
+ * @brief unpack the elements of a format into RGBA values
+ * @details The components missing from the channel order are 0, alpha is
+ * 1. Intensity is replicated to all of the components, luminance to red,
+ * green and blue, depth is returned in red.
+ * @param format The format of the image
+ * @param elements The count packed elements
+ * @param values The values of count elements, as for image_format_pack
+ * @param count The number of elements
+ * @return HSA_STATUS_SUCCESS, or HSA_STATUS_ERROR_INVALID_ARGUMENT if the
+ * format is unknown
+ */
+hsa_status_t image_format_unpack(const hsa_ext_image_format_t* format,
+                                 const void* elements,
+                                 void* values,
+                                 size_t count);
+
+/**
+ * @brief image_format_pack without the vector paths, the reference the
+ * vector paths match bit for bit
+ */
+hsa_status_t image_format_pack_scalar(const hsa_ext_image_format_t* format,
+                                      const void* values,
+                                      void* elements,
+                                      size_t count);
+
+/**
+ * @brief image_format_unpack without the vector paths, the reference the
+ * vector paths match bit for bit
+ */
+hsa_status_t image_format_unpack_scalar(const hsa_ext_image_format_t* format,
+                                        const void* elements,
+                                        void* values,
+                                        size_t count);
+
+#endif  // _IMAGE_FORMAT_UTILS_H_
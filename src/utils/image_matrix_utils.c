@@ -0,0 +1,127 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "image_matrix_utils.h"
+
+// Check if a name is one of the names of a comma separated list
+static int list_contains(const char* list, const char* name) {
+    size_t length = strlen(name);
+
+    if (NULL == list) {
+        return 1;
+    }
+
+    while ('\0' != *list) {
+        const char* end = strchr(list, ',');
+        size_t item_length = (NULL == end) ? strlen(list) : (size_t) (end - list);
+        if (item_length == length && 0 == strncmp(list, name, length)) {
+            return 1;
+        }
+        if (NULL == end) {
+            break;
+        }
+        list = end + 1;
+    }
+
+    return 0;
+}
+
+// Parse the filter options of the command line
+void image_matrix_parse_filter(int argc, char* argv[], image_matrix_filter_t* filter) {
+    static const char CHANNEL_TYPE_OPTION[] = "--channel-type=";
+    static const char CHANNEL_ORDER_OPTION[] = "--channel-order=";
+    static const char GEOMETRY_OPTION[] = "--geometry=";
+    int ii;
+
+    memset(filter, 0, sizeof(image_matrix_filter_t));
+
+    for (ii = 1; ii < argc; ++ii) {
+        if (0 == strncmp(argv[ii], CHANNEL_TYPE_OPTION, sizeof(CHANNEL_TYPE_OPTION) - 1)) {
+            filter->channel_types = argv[ii] + sizeof(CHANNEL_TYPE_OPTION) - 1;
+        } else if (0 == strncmp(argv[ii], CHANNEL_ORDER_OPTION, sizeof(CHANNEL_ORDER_OPTION) - 1)) {
+            filter->channel_orders = argv[ii] + sizeof(CHANNEL_ORDER_OPTION) - 1;
+        } else if (0 == strncmp(argv[ii], GEOMETRY_OPTION, sizeof(GEOMETRY_OPTION) - 1)) {
+            filter->geometries = argv[ii] + sizeof(GEOMETRY_OPTION) - 1;
+        }
+    }
+
+    return;
+}
+
+// Check if an entry of the matrix matches a filter
+int image_matrix_match(const image_matrix_filter_t* filter, const image_matrix_entry_t* matrix, uint32_t index) {
+    const image_matrix_entry_t* entry = &matrix[index];
+
+    if (NULL != filter->supported && !filter->supported[index]) {
+        return 0;
+    }
+
+    return list_contains(filter->channel_types, entry->channel_type_name) &&
+           list_contains(filter->channel_orders, entry->channel_order_name) &&
+           list_contains(filter->geometries, entry->geometry_name);
+}
+
+// Get the name of the test case of an entry
+const char* image_matrix_get_test_name(const char* prefix, const image_matrix_entry_t* entry) {
+    size_t size = strlen(prefix) + strlen(entry->channel_type_name) + strlen(entry->channel_order_name) +
+                  strlen(entry->geometry_name) + 4;
+    char* name = (char*) malloc(size);
+
+    // The test cases are registered outside of any test, so there is no
+    // test to fail
+    if (NULL == name) {
+        fprintf(stderr, "Failed to allocate the name of a test case\n");
+        exit(EXIT_FAILURE);
+    }
+
+    snprintf(name, size, "%s_%s_%s_%s", prefix, entry->channel_type_name, entry->channel_order_name,
+             entry->geometry_name);
+
+    return name;
+}
@@ -0,0 +1,157 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef _IMAGE_MATRIX_UTILS_H_
+#define _IMAGE_MATRIX_UTILS_H_
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <stdint.h>
+#include <framework.h>
+#include "image_utils.h"
+
+/**
+ * @brief a channel type, channel order and geometry of the image test matrix
+ */
+typedef struct image_matrix_entry_s {
+    hsa_ext_image_format_t format;
+    hsa_ext_image_geometry_t geometry;
+    const char* channel_type_name;
+    const char* channel_order_name;
+    const char* geometry_name;
+} image_matrix_entry_t;
+
+/**
+ * @brief the entries of the matrix to register, as comma separated lists of
+ * names such as "UNORM_INT8,FLOAT", NULL to register all of them
+ */
+typedef struct image_matrix_filter_s {
+    const char* channel_types;
+    const char* channel_orders;
+    const char* geometries;
+    // 0 for the entries of the matrix no agent supports, NULL to register all of them
+    const uint8_t* supported;
+} image_matrix_filter_t;
+
+/**
+ * @brief expand to an entry of the matrix. The image_matrix.h file that
+ * image_test_matrix in cmake/image_data.cmake generates lists the valid
+ * entries with this macro, to initialize an array of image_matrix_entry_t.
+ */
+#define IMAGE_MATRIX_ENTRY(__type__, __order__, __geometry__) \
+    { { HSA_EXT_IMAGE_CHANNEL_TYPE_##__type__, HSA_EXT_IMAGE_CHANNEL_ORDER_##__order__ }, \
+      HSA_EXT_IMAGE_GEOMETRY_##__geometry__, #__type__, #__order__, #__geometry__ },
+
+/**
+ * @brief define the loop test that runs test_<__test_name__>(format, geometry)
+ * for the entry of __matrix__ given by the loop index
+ */
+#define DEFINE_IMAGE_MATRIX_TEST(__test_name__, __matrix__) \
+START_TEST(__test_name__) { \
+    hsa_ext_image_format_t image_format = __matrix__[_i].format; \
+    printf("\nTesting channel type = %s, channel order = %s, geometry = %s\n", \
+           __matrix__[_i].channel_type_name, __matrix__[_i].channel_order_name, __matrix__[_i].geometry_name); \
+    test_##__test_name__(&image_format, __matrix__[_i].geometry); \
+} \
+END_TEST
+
+/**
+ * @brief add a test case named <__test_name__>_<type>_<order>_<geometry> for
+ * each entry of __matrix__ that matches __filter__
+ */
+#define ADD_IMAGE_MATRIX_TESTS(__test_name__, __matrix__, __filter__) \
+    { \
+        uint32_t __index__; \
+        for (__index__ = 0; __index__ < sizeof(__matrix__) / sizeof(__matrix__[0]); ++__index__) { \
+            if (image_matrix_match(__filter__, __matrix__, __index__)) { \
+                ADD_LOOP_TEST(__test_name__, \
+                              image_matrix_get_test_name(#__test_name__, &__matrix__[__index__]), \
+                              __index__, __index__ + 1); \
+            } \
+        } \
+    }
+
+/**
+ * @brief run the test cases of an image test suite, in place of RUN_TESTS,
+ * and destroy the image test contexts the test cases created when they ran
+ * in this process
+ */
+#define RUN_IMAGE_MATRIX_TESTS() \
+    srunner_run_all(runner, CK_NORMAL); \
+    number_failed = srunner_ntests_failed(runner); \
+    srunner_free(runner); \
+    image_test_context_destroy_all(); \
+    return(number_failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+
+/**
+ * @brief parse the --channel-type=, --channel-order= and --geometry= options
+ * of the command line of a test suite, the other arguments are ignored
+ * @param argc The number of arguments
+ * @param argv The arguments, the filter points into them
+ * @param filter The filter, NULL lists for the options that are not given,
+ * and a NULL supported
+ */
+void image_matrix_parse_filter(int argc, char* argv[], image_matrix_filter_t* filter);
+
+/**
+ * @brief check if an entry of the matrix matches a filter
+ * @return 1 if the entry is supported and the channel type, order and
+ * geometry are each in their list, or the list is NULL, 0 otherwise
+ */
+int image_matrix_match(const image_matrix_filter_t* filter, const image_matrix_entry_t* matrix, uint32_t index);
+
+/**
+ * @brief get the name of the test case of an entry,
+ * <prefix>_<type>_<order>_<geometry>
+ * @details Check keeps a pointer to the names of the test cases, so the name
+ * is allocated and lives until the test suite exits.
+ * @return the name
+ */
+const char* image_matrix_get_test_name(const char* prefix, const image_matrix_entry_t* entry);
+
+#endif  // _IMAGE_MATRIX_UTILS_H_
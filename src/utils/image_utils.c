@@ -45,9 +45,18 @@
 
 #include <hsa.h>
 #include <hsa_ext_image.h>
+#include <agent_utils.h>
+#include <finalize_utils.h>
 #include <framework.h>
+#include <image_format_utils.h>
 #include <image_utils.h>
+#include <image_verify_utils.h>
+#include <perf_utils.h>
+#include <queue_utils.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 static char* VERIFY_IMAGE_REGION_KERNEL_1D[3] = {"&__verify_image_region_kernel_s32_1d", "&__verify_image_region_kernel_u32_1d", "&__verify_image_region_kernel_f32_1d"};
 static char* VERIFY_IMAGE_REGION_KERNEL_1DA[3] = {"&__verify_image_region_kernel_s32_1da", "&__verify_image_region_kernel_u32_1da", "&__verify_image_region_kernel_f32_1da"};
@@ -276,3 +285,753 @@ uint32_t get_cmp_info(hsa_ext_image_channel_order_t order) {
 
     return 0x0000;
 }
+
+// Get the number of regions to keep in flight
+uint32_t get_image_region_pipeline_depth(size_t bytes_per_region) {
+    uint32_t depth = IMAGE_REGION_PIPELINE_DEPTH;
+    while (depth > 1 && (size_t) depth * bytes_per_region > IMAGE_REGION_PIPELINE_MAX_BYTES) {
+        --depth;
+    }
+
+    return depth;
+}
+
+// Allocate the buffers and signals of a pipeline slot
+void image_region_slot_create(hsa_region_t global_region,
+                              hsa_region_t kernarg_region,
+                              size_t kernarg_segment_size,
+                              void* rgn_values,
+                              void* bkg_values,
+                              uint32_t* bits,
+                              uint32_t* cmp_mask,
+                              uint32_t* failures,
+                              image_region_slot_t* slot) {
+    hsa_status_t status;
+
+    // Allocate the kernel argument buffer from the correct region
+    if (0 == kernarg_segment_size) {
+        status = hsa_memory_allocate(global_region, sizeof(image_validate_args_t), (void**) &slot->kernarg_buffer);
+    } else {
+        status = hsa_memory_allocate(kernarg_region, kernarg_segment_size, (void**) &slot->kernarg_buffer);
+    }
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Create the start and end region buffers, and the error word
+    status = hsa_memory_allocate(global_region, 3 * sizeof(uint32_t), (void**) &slot->start_region);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_allocate(global_region, 3 * sizeof(uint32_t), (void**) &slot->end_region);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_allocate(global_region, sizeof(uint32_t), (void**) &slot->error);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // The slot starts out verified
+    status = hsa_signal_create(1, 0, NULL, &slot->completion_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_signal_create(0, 0, NULL, &slot->verified);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Add all of the components to the argument buffer
+    slot->kernarg_buffer->rgn_values = rgn_values;
+    slot->kernarg_buffer->bkg_values = bkg_values;
+    slot->kernarg_buffer->start_region = slot->start_region;
+    slot->kernarg_buffer->end_region = slot->end_region;
+    slot->kernarg_buffer->bits = bits;
+    slot->kernarg_buffer->cmp_mask = cmp_mask;
+    slot->kernarg_buffer->error = slot->error;
+    slot->failures = failures;
+
+    return;
+}
+
+// Free the buffers and signals of a pipeline slot
+void image_region_slot_destroy(image_region_slot_t* slot) {
+    hsa_status_t status;
+
+    status = hsa_signal_destroy(slot->verified);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_signal_destroy(slot->completion_signal);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    status = hsa_memory_free(slot->error);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_free(slot->end_region);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_free(slot->start_region);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_free(slot->kernarg_buffer);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return;
+}
+
+// Wait until the previous region of the slot has been verified
+void image_region_slot_wait(image_region_slot_t* slot) {
+    hsa_signal_value_t value;
+    do {
+        value = hsa_signal_wait_acquire(slot->verified, HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, HSA_WAIT_STATE_BLOCKED);
+    } while (0 != value);
+
+    return;
+}
+
+// Called by the reaper once the verification kernel of a region has finished
+static void check_image_region(hsa_signal_value_t value, void* data) {
+    image_region_slot_t* slot = (image_region_slot_t*) data;
+
+    // Verify that no errors occured.
+    if (0 != *slot->error) {
+        printf("\nRegion: (%d,%d,%d) -> (%d,%d,%d) Error: %d\n",
+                                                    slot->start_region[0],
+                                                    slot->start_region[1],
+                                                    slot->start_region[2],
+                                                    slot->end_region[0],
+                                                    slot->end_region[1],
+                                                    slot->end_region[2],
+                                                    *slot->error);
+        __atomic_add_fetch(slot->failures, 1, __ATOMIC_RELAXED);
+    } else {
+        printf(".");
+    }
+
+    hsa_signal_store_release(slot->verified, 0);
+
+    return;
+}
+
+// Dispatch the verification kernel for a region of the image
+void image_region_slot_verify(image_region_slot_t* slot,
+                              hsa_ext_image_t image,
+                              const hsa_ext_image_region_t* region,
+                              hsa_queue_t* queue,
+                              hsa_kernel_dispatch_packet_t* dispatch_packet,
+                              reaper_t* reaper) {
+    slot->start_region[0] = region->offset.x;
+    slot->start_region[1] = region->offset.y;
+    slot->start_region[2] = region->offset.z;
+    slot->end_region[0] = region->offset.x + region->range.x;
+    slot->end_region[1] = region->offset.y + region->range.y;
+    slot->end_region[2] = region->offset.z + region->range.z;
+    slot->kernarg_buffer->image = image;
+    *slot->error = 0;
+
+    // Reset the completion signal, and mark the slot in flight until the
+    // reaper has checked the region
+    hsa_signal_store_relaxed(slot->completion_signal, 1);
+    hsa_signal_store_relaxed(slot->verified, 1);
+
+    // Dispatch the kernel
+    dispatch_packet->kernarg_address = (void*) slot->kernarg_buffer;
+    dispatch_packet->completion_signal = slot->completion_signal;
+    enqueue_dispatch_packet(queue, dispatch_packet);
+
+    reaper_add(reaper, slot->completion_signal, HSA_SIGNAL_CONDITION_LT, 1, check_image_region, slot);
+
+    return;
+}
+
+// Verify a region of the image on the host
+void image_region_slot_verify_host(image_region_slot_t* slot,
+                                   hsa_ext_image_pfn_t* pfn,
+                                   hsa_agent_t agent,
+                                   hsa_ext_image_t image,
+                                   const hsa_ext_image_format_t* format,
+                                   const hsa_ext_image_region_t* region_all,
+                                   const hsa_ext_image_region_t* region,
+                                   void* export_buffer) {
+    hsa_status_t status;
+
+    slot->start_region[0] = region->offset.x;
+    slot->start_region[1] = region->offset.y;
+    slot->start_region[2] = region->offset.z;
+    slot->end_region[0] = region->offset.x + region->range.x;
+    slot->end_region[1] = region->offset.y + region->range.y;
+    slot->end_region[2] = region->offset.z + region->range.z;
+
+    // Export the entire image
+    size_t row_pitch = region_all->range.x * image_format_get_element_size(format);
+    size_t slice_pitch = row_pitch * region_all->range.y;
+    status = pfn->hsa_ext_image_export(agent,
+                                       image,
+                                       export_buffer,
+                                       row_pitch,
+                                       slice_pitch,
+                                       region_all);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    uint32_t size[3];
+    size[0] = region_all->range.x;
+    size[1] = region_all->range.y;
+    size[2] = region_all->range.z;
+    *slot->error = image_verify_region(format,
+                                       export_buffer,
+                                       row_pitch,
+                                       slice_pitch,
+                                       size,
+                                       slot->start_region,
+                                       slot->end_region,
+                                       slot->kernarg_buffer->rgn_values,
+                                       slot->kernarg_buffer->bkg_values,
+                                       *slot->kernarg_buffer->cmp_mask);
+
+    check_image_region(0, slot);
+
+    return;
+}
+
+// The image test contexts of the agents
+static image_test_context_t* image_test_contexts[IMAGE_TEST_MAX_CONTEXTS];
+static int num_image_test_contexts = 0;
+
+// Free the slots of a context
+static void destroy_image_test_context_slots(image_test_context_t* context) {
+    int ii;
+    for (ii = 0; ii < context->num_slots; ++ii) {
+        image_region_slot_destroy(&context->slots[ii]);
+    }
+    context->num_slots = 0;
+
+    return;
+}
+
+// Wait for the regions in flight and destroy the images of a context,
+// returning the first error
+static hsa_status_t destroy_image_test_context_images(image_test_context_t* context) {
+    hsa_status_t result = HSA_STATUS_SUCCESS;
+
+    if (NULL != context->reaper) {
+        reaper_drain(context->reaper);
+    }
+
+    // Forget the images first, so that a failed destroy isn't retried
+    int num_images = context->num_images;
+    context->num_images = 0;
+
+    int ii;
+    for (ii = 0; ii < num_images; ++ii) {
+        hsa_status_t status = context->pfn.hsa_ext_image_destroy(context->agent, context->images[ii]);
+        if (HSA_STATUS_SUCCESS == result) {
+            result = status;
+        }
+    }
+
+    return result;
+}
+
+// Destroy the image test contexts of the agents
+void image_test_context_destroy_all(void) {
+    if (0 == num_image_test_contexts) {
+        return;
+    }
+
+    int ii;
+    for (ii = 0; ii < num_image_test_contexts; ++ii) {
+        image_test_context_t* context = image_test_contexts[ii];
+
+        destroy_image_test_context_images(context);
+        if (NULL != context->reaper) {
+            reaper_destroy(context->reaper);
+        }
+        destroy_image_test_context_slots(context);
+
+        if (NULL != context->image_arena) {
+            hsa_memory_free(context->image_arena);
+        }
+        if (NULL != context->export_arena) {
+            hsa_memory_free(context->export_arena);
+        }
+        hsa_memory_free(context->bg_pattern);
+        hsa_memory_free(context->clr_pattern);
+        hsa_memory_free(context->bits);
+        hsa_memory_free(context->cmp_mask);
+
+        if (NULL != context->queue) {
+            hsa_executable_destroy(context->executable);
+            hsa_code_object_destroy(context->code_object);
+            hsa_queue_destroy(context->queue);
+        }
+
+        free(context);
+    }
+    num_image_test_contexts = 0;
+
+    // Release the reference of the contexts to the runtime
+    hsa_shut_down();
+
+    return;
+}
+
+// Get the image test context of an agent
+image_test_context_t* image_test_context_get(hsa_agent_t agent, const char* brig_file) {
+    hsa_status_t status;
+
+    int ii;
+    for (ii = 0; ii < num_image_test_contexts; ++ii) {
+        if (image_test_contexts[ii]->agent.handle == agent.handle) {
+            return image_test_contexts[ii];
+        }
+    }
+    ASSERT(num_image_test_contexts < IMAGE_TEST_MAX_CONTEXTS);
+
+    // The contexts hold their own reference to the runtime, so that it stays
+    // initialized when a test case shuts it down.
+    if (0 == num_image_test_contexts) {
+        status = hsa_init();
+        ASSERT(HSA_STATUS_SUCCESS == status);
+    }
+
+    image_test_context_t* context = (image_test_context_t*) calloc(1, sizeof(image_test_context_t));
+    ASSERT(NULL != context);
+    context->agent = agent;
+    status = get_image_fnc_tbl(&context->pfn);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    // Verify the regions on the host when the agent cannot dispatch the
+    // verification kernels, or when IMAGE_VERIFY_HOST is set.
+    uint32_t features = 0;
+    status = hsa_agent_get_info(agent, HSA_AGENT_INFO_FEATURE, &features);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    context->verify_on_host = !(features & HSA_AGENT_FEATURE_KERNEL_DISPATCH) ||
+                              0 != perf_get_env_uint("IMAGE_VERIFY_HOST", 0);
+
+    // Find a global memory region for the image backing buffers
+    context->global_region.handle = (uint64_t) -1;
+    hsa_agent_iterate_regions(agent, get_global_memory_region_fine_grained, &context->global_region);
+    ASSERT((uint64_t) -1 != context->global_region.handle);
+
+    // Find a memory region that supports kernel arguments
+    context->kernarg_region.handle = (uint64_t) -1;
+    if (!context->verify_on_host) {
+        hsa_agent_iterate_regions(agent, get_kernarg_memory_region, &context->kernarg_region);
+        ASSERT((uint64_t) -1 != context->kernarg_region.handle);
+    }
+
+    if (!context->verify_on_host) {
+        // Create a queue to execute validation kernels.
+        status = hsa_queue_create(agent, 1024, HSA_QUEUE_TYPE_SINGLE, NULL, NULL, UINT32_MAX, UINT32_MAX, &context->queue);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+
+        // Finalize the executable with all of the verification kernels
+        hsa_ext_module_t module;
+        ASSERT(0 == load_module_from_file(brig_file, &module));
+
+        hsa_ext_control_directives_t control_directives;
+        memset(&control_directives, 0, sizeof(hsa_ext_control_directives_t));
+
+        status = finalize_executable(agent,
+                                     1,
+                                     &module,
+                                     HSA_MACHINE_MODEL_LARGE,
+                                     HSA_PROFILE_FULL,
+                                     HSA_DEFAULT_FLOAT_ROUNDING_MODE_ZERO,
+                                     HSA_CODE_OBJECT_TYPE_PROGRAM,
+                                     0,
+                                     control_directives,
+                                     &context->code_object,
+                                     &context->executable);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        destroy_module(module);
+
+        // Create the reaper that checks the regions as they complete
+        context->reaper = reaper_create(IMAGE_REGION_PIPELINE_DEPTH);
+        ASSERT(NULL != context->reaper);
+    }
+
+    // Create the pattern, bits and mask buffers
+    status = hsa_memory_allocate(context->global_region, 4 * sizeof(uint32_t), (void**) &context->bg_pattern);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_allocate(context->global_region, 4 * sizeof(uint32_t), (void**) &context->clr_pattern);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_allocate(context->global_region, sizeof(uint32_t), (void**) &context->bits);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+    status = hsa_memory_allocate(context->global_region, sizeof(uint32_t), (void**) &context->cmp_mask);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    image_test_contexts[num_image_test_contexts++] = context;
+
+    return context;
+}
+
+// Set the patterns, bits and cmp_mask for a format
+void image_test_context_set_format(image_test_context_t* context,
+                                   const hsa_ext_image_format_t* format) {
+    if (format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8  ||
+       format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 ||
+       format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32) {
+        uint32_t *bg = (uint32_t*) context->bg_pattern;
+        uint32_t *clr = (uint32_t*) context->clr_pattern;
+        bg[0] = bg[1] = bg[2] = bg[3] = 0;
+        clr[0] = clr[1] = clr[2] = clr[3] = 255;
+    } else if (format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8  ||
+       format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 ||
+       format->channel_type == HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32) {
+        int32_t *bg = (int32_t*) context->bg_pattern;
+        int32_t *clr = (int32_t*) context->clr_pattern;
+        bg[0] = bg[1] = bg[2] = bg[3] = 0;
+        clr[0] = clr[1] = clr[2] = clr[3] = 127;
+    } else {
+        float *bg = (float*) context->bg_pattern;
+        float *clr = (float*) context->clr_pattern;
+        bg[0] = bg[1] = bg[2] = bg[3] = 0.0f;
+        clr[0] = clr[1] = clr[2] = clr[3] = 0.5f;
+    }
+
+    // A failed test case may have left regions in flight, which would count
+    // their failures against this one
+    image_test_context_release_images(context);
+
+    *context->cmp_mask = get_cmp_info(format->channel_order);
+    *context->bits = get_channel_type_bits(format->channel_type);
+    context->failures = 0;
+
+    return;
+}
+
+// Get the pipeline slots of a context
+image_region_slot_t* image_test_context_get_slots(image_test_context_t* context,
+                                                  size_t kernarg_segment_size) {
+    if (0 == context->num_slots || kernarg_segment_size > context->kernarg_segment_size) {
+        destroy_image_test_context_slots(context);
+
+        int ii;
+        for (ii = 0; ii < IMAGE_REGION_PIPELINE_DEPTH; ++ii) {
+            image_region_slot_create(context->global_region,
+                                     context->kernarg_region,
+                                     kernarg_segment_size,
+                                     context->clr_pattern,
+                                     context->bg_pattern,
+                                     context->bits,
+                                     context->cmp_mask,
+                                     &context->failures,
+                                     &context->slots[ii]);
+        }
+        context->num_slots = IMAGE_REGION_PIPELINE_DEPTH;
+        context->kernarg_segment_size = kernarg_segment_size;
+    }
+
+    return context->slots;
+}
+
+// Carve count buffers of size bytes from an arena, growing it if needed
+static void carve_image_test_arena(hsa_region_t region,
+                                   void** arena,
+                                   size_t* arena_size,
+                                   size_t size,
+                                   size_t alignment,
+                                   uint32_t count,
+                                   void** buffers) {
+    hsa_status_t status;
+
+    alignment = (0 == alignment) ? 1 : alignment;
+    size_t stride = (size + alignment - 1) / alignment * alignment;
+    if ((size_t) count * stride > *arena_size) {
+        if (NULL != *arena) {
+            status = hsa_memory_free(*arena);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+        }
+        status = hsa_memory_allocate(region, (size_t) count * stride, arena);
+        ASSERT(HSA_STATUS_SUCCESS == status);
+        *arena_size = (size_t) count * stride;
+    }
+
+    uint32_t ii;
+    for (ii = 0; ii < count; ++ii) {
+        buffers[ii] = (char*) *arena + ii * stride;
+    }
+
+    return;
+}
+
+// Carve image backing buffers from the image arena of a context
+void image_test_context_get_image_data(image_test_context_t* context,
+                                       size_t size,
+                                       size_t alignment,
+                                       uint32_t count,
+                                       void** image_data) {
+    // The arena is only carved again once no image uses it
+    image_test_context_release_images(context);
+    carve_image_test_arena(context->global_region,
+                           &context->image_arena,
+                           &context->image_arena_size,
+                           size,
+                           alignment,
+                           count,
+                           image_data);
+
+    return;
+}
+
+// Carve export buffers from the export arena of a context
+void image_test_context_get_export_buffers(image_test_context_t* context,
+                                           size_t size,
+                                           uint32_t count,
+                                           void** export_buffers) {
+    carve_image_test_arena(context->global_region,
+                           &context->export_arena,
+                           &context->export_arena_size,
+                           size,
+                           4 * sizeof(uint32_t),
+                           count,
+                           export_buffers);
+
+    return;
+}
+
+// Create an image of the current test case
+hsa_status_t image_test_context_create_image(image_test_context_t* context,
+                                             const hsa_ext_image_descriptor_t* descriptor,
+                                             const void* image_data,
+                                             hsa_access_permission_t access_permission,
+                                             hsa_ext_image_t* image) {
+    ASSERT(context->num_images < IMAGE_REGION_PIPELINE_DEPTH + 1);
+
+    hsa_status_t status = context->pfn.hsa_ext_image_create(context->agent,
+                                                            descriptor,
+                                                            image_data,
+                                                            access_permission,
+                                                            image);
+    if (HSA_STATUS_SUCCESS == status) {
+        context->images[context->num_images++] = *image;
+    }
+
+    return status;
+}
+
+// Wait for the regions in flight and destroy the images of the current test case
+void image_test_context_release_images(image_test_context_t* context) {
+    hsa_status_t status = destroy_image_test_context_images(context);
+    ASSERT(HSA_STATUS_SUCCESS == status);
+
+    return;
+}
+
+// The queries kept by the image query cache
+typedef enum image_query_kind_e {
+    IMAGE_QUERY_DATA_INFO = 1,
+    IMAGE_QUERY_CAPABILITY = 2
+} image_query_kind_t;
+
+// The arguments of a query. Keys are zero filled before they are set, so
+// that they can be hashed and compared as bytes.
+typedef struct image_query_key_s {
+    uint64_t agent;
+    uint64_t width;
+    uint64_t height;
+    uint64_t depth;
+    uint64_t array_size;
+    uint32_t kind;
+    uint32_t geometry;
+    uint32_t channel_type;
+    uint32_t channel_order;
+    uint32_t access_permission;
+    uint32_t reserved;
+} image_query_key_t;
+
+// An entry of the cache. The key and result are written once, before the
+// state is set to IMAGE_QUERY_ENTRY_READY.
+typedef struct image_query_entry_s {
+    int state;
+    image_query_key_t key;
+    hsa_ext_image_data_info_t image_data_info;
+    uint32_t capability_mask;
+} image_query_entry_t;
+
+#define IMAGE_QUERY_ENTRY_FREE 0
+#define IMAGE_QUERY_ENTRY_WRITING 1
+#define IMAGE_QUERY_ENTRY_READY 2
+
+static image_query_entry_t image_query_cache[IMAGE_QUERY_CACHE_SIZE];
+static image_query_cache_counters_t image_query_counters;
+// Serializes the insertions, the lookups take no lock
+static pthread_mutex_t image_query_mutex = PTHREAD_MUTEX_INITIALIZER;
+// 1 to check the cached results, -1 until IMAGE_QUERY_CACHE_CHECK is read
+static int image_query_check = -1;
+
+// Hash the words of a key
+static uint32_t hash_image_query_key(const image_query_key_t* key) {
+    uint64_t words[sizeof(image_query_key_t) / sizeof(uint64_t)];
+    memcpy(words, key, sizeof(words));
+
+    uint64_t hash = 0;
+    size_t ii;
+    for (ii = 0; ii < sizeof(words) / sizeof(uint64_t); ++ii) {
+        hash = (hash ^ words[ii]) * 0x9E3779B97F4A7C15ull;
+    }
+
+    return (uint32_t) (hash >> 32);
+}
+
+// Count a query. The counters are shared by all of the threads without a
+// locked instruction, so they are approximate when several threads query
+// the cache at the same time.
+static void add_image_query_count(uint64_t* counter) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+}
+
+// Find the cached entry of a key, NULL if it isn't cached
+static const image_query_entry_t* find_image_query(const image_query_key_t* key) {
+    uint32_t hash = hash_image_query_key(key);
+    uint32_t ii;
+    for (ii = 0; ii < IMAGE_QUERY_CACHE_MAX_PROBES; ++ii) {
+        const image_query_entry_t* entry = &image_query_cache[(hash + ii) & (IMAGE_QUERY_CACHE_SIZE - 1)];
+        int state = __atomic_load_n(&entry->state, __ATOMIC_ACQUIRE);
+        if (IMAGE_QUERY_ENTRY_FREE == state) {
+            return NULL;
+        }
+        if (IMAGE_QUERY_ENTRY_READY == state && 0 == memcmp(&entry->key, key, sizeof(image_query_key_t))) {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+// Cache the result of a query, unless its entries are all taken
+static void insert_image_query(const image_query_key_t* key,
+                               const hsa_ext_image_data_info_t* image_data_info,
+                               uint32_t capability_mask) {
+    uint32_t hash = hash_image_query_key(key);
+    uint32_t ii;
+
+    pthread_mutex_lock(&image_query_mutex);
+    for (ii = 0; ii < IMAGE_QUERY_CACHE_MAX_PROBES; ++ii) {
+        image_query_entry_t* entry = &image_query_cache[(hash + ii) & (IMAGE_QUERY_CACHE_SIZE - 1)];
+        if (IMAGE_QUERY_ENTRY_READY == entry->state) {
+            if (0 == memcmp(&entry->key, key, sizeof(image_query_key_t))) {
+                // Another thread cached it first
+                break;
+            }
+            continue;
+        }
+
+        entry->state = IMAGE_QUERY_ENTRY_WRITING;
+        entry->key = *key;
+        if (NULL != image_data_info) {
+            entry->image_data_info = *image_data_info;
+        }
+        entry->capability_mask = capability_mask;
+        __atomic_store_n(&entry->state, IMAGE_QUERY_ENTRY_READY, __ATOMIC_RELEASE);
+        break;
+    }
+    if (IMAGE_QUERY_CACHE_MAX_PROBES == ii) {
+        add_image_query_count(&image_query_counters.overflows);
+    }
+    pthread_mutex_unlock(&image_query_mutex);
+
+    return;
+}
+
+// Check if the cached results are to be checked against the runtime
+static int get_image_query_check(void) {
+    int check = __atomic_load_n(&image_query_check, __ATOMIC_RELAXED);
+    if (0 > check) {
+        check = (0 != perf_get_env_uint("IMAGE_QUERY_CACHE_CHECK", 0)) ? 1 : 0;
+        __atomic_store_n(&image_query_check, check, __ATOMIC_RELAXED);
+    }
+
+    return check;
+}
+
+// Get the data info of an image from the query cache
+hsa_status_t image_query_cache_data_get_info(hsa_ext_image_pfn_t* pfn,
+                                             hsa_agent_t agent,
+                                             const hsa_ext_image_descriptor_t* descriptor,
+                                             hsa_access_permission_t access_permission,
+                                             hsa_ext_image_data_info_t* image_data_info) {
+    hsa_status_t status;
+
+    image_query_key_t key;
+    memset(&key, 0, sizeof(image_query_key_t));
+    key.agent = agent.handle;
+    key.width = descriptor->width;
+    key.height = descriptor->height;
+    key.depth = descriptor->depth;
+    key.array_size = descriptor->array_size;
+    key.kind = IMAGE_QUERY_DATA_INFO;
+    key.geometry = descriptor->geometry;
+    key.channel_type = descriptor->format.channel_type;
+    key.channel_order = descriptor->format.channel_order;
+    key.access_permission = access_permission;
+
+    const image_query_entry_t* entry = find_image_query(&key);
+    if (NULL != entry) {
+        add_image_query_count(&image_query_counters.hits);
+        *image_data_info = entry->image_data_info;
+
+        if (get_image_query_check()) {
+            hsa_ext_image_data_info_t fresh_info;
+            status = pfn->hsa_ext_image_data_get_info(agent, descriptor, access_permission, &fresh_info);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            ASSERT(fresh_info.size == image_data_info->size);
+            ASSERT(fresh_info.alignment == image_data_info->alignment);
+        }
+
+        return HSA_STATUS_SUCCESS;
+    }
+
+    add_image_query_count(&image_query_counters.misses);
+    status = pfn->hsa_ext_image_data_get_info(agent, descriptor, access_permission, image_data_info);
+    if (HSA_STATUS_SUCCESS == status) {
+        insert_image_query(&key, image_data_info, 0);
+    }
+
+    return status;
+}
+
+// Get the capability mask of an image format and geometry from the query cache
+hsa_status_t image_query_cache_get_capability(hsa_ext_image_pfn_t* pfn,
+                                              hsa_agent_t agent,
+                                              hsa_ext_image_geometry_t geometry,
+                                              const hsa_ext_image_format_t* image_format,
+                                              uint32_t* capability_mask) {
+    hsa_status_t status;
+
+    image_query_key_t key;
+    memset(&key, 0, sizeof(image_query_key_t));
+    key.agent = agent.handle;
+    key.kind = IMAGE_QUERY_CAPABILITY;
+    key.geometry = geometry;
+    key.channel_type = image_format->channel_type;
+    key.channel_order = image_format->channel_order;
+
+    const image_query_entry_t* entry = find_image_query(&key);
+    if (NULL != entry) {
+        add_image_query_count(&image_query_counters.hits);
+        *capability_mask = entry->capability_mask;
+
+        if (get_image_query_check()) {
+            uint32_t fresh_mask;
+            status = pfn->hsa_ext_image_get_capability(agent, geometry, image_format, &fresh_mask);
+            ASSERT(HSA_STATUS_SUCCESS == status);
+            ASSERT(fresh_mask == *capability_mask);
+        }
+
+        return HSA_STATUS_SUCCESS;
+    }
+
+    add_image_query_count(&image_query_counters.misses);
+    status = pfn->hsa_ext_image_get_capability(agent, geometry, image_format, capability_mask);
+    if (HSA_STATUS_SUCCESS == status) {
+        insert_image_query(&key, NULL, *capability_mask);
+    }
+
+    return status;
+}
+
+// Get the statistics of the image query cache
+void image_query_cache_get_counters(image_query_cache_counters_t* counters) {
+    counters->hits = __atomic_load_n(&image_query_counters.hits, __ATOMIC_RELAXED);
+    counters->misses = __atomic_load_n(&image_query_counters.misses, __ATOMIC_RELAXED);
+    counters->overflows = __atomic_load_n(&image_query_counters.overflows, __ATOMIC_RELAXED);
+
+    return;
+}
+
+// Empty the image query cache
+void image_query_cache_reset(void) {
+    pthread_mutex_lock(&image_query_mutex);
+    memset(image_query_cache, 0, sizeof(image_query_cache));
+    memset(&image_query_counters, 0, sizeof(image_query_counters));
+    pthread_mutex_unlock(&image_query_mutex);
+
+    return;
+}
@@ -48,6 +48,13 @@
 
 #include <hsa.h>
 #include <hsa_ext_image.h>
+#include "reaper_utils.h"
+
+// Maximum number of image regions whose verification is in flight
+#define IMAGE_REGION_PIPELINE_DEPTH 4
+
+// Maximum number of bytes of images and buffers used by the regions in flight
+#define IMAGE_REGION_PIPELINE_MAX_BYTES (256 * 1024 * 1024)
 
 typedef struct hsa_ext_image_pfn_s {
   hsa_status_t (*hsa_ext_image_get_capability)(
@@ -113,4 +120,206 @@ uint32_t get_cmp_info(hsa_ext_image_channel_order_t order);
 // Get the number of bits per pixel in for the specified channel type.
 uint32_t get_channel_type_bits(hsa_ext_image_channel_type_t channel_type);
 
+// The arguments of the verify_image_region kernels
+typedef struct __attribute__ ((aligned(16))) image_validate_args_s {
+    hsa_ext_image_t image;  // The image handle
+    void* rgn_values;  // The floating point pixel pattern in the specified region
+    void* bkg_values;  // The floating point pixel pattern in the rest of the image
+    uint32_t* start_region;  // The regions starting coords
+    uint32_t* end_region;  // The regions ending coords
+    uint32_t* bits;  // The channel values to compare
+    uint32_t* cmp_mask;  // The channel values to compare
+    uint32_t* error;  // An error field representing different rbga channel errors
+} image_validate_args_t;
+
+// The buffers and signals of an image region whose verification is in flight
+typedef struct image_region_slot_s {
+    image_validate_args_t* kernarg_buffer;
+    uint32_t* start_region;
+    uint32_t* end_region;
+    uint32_t* error;
+    hsa_signal_t completion_signal;
+    // Set to 0 once the reaper has checked the error word of the region
+    hsa_signal_t verified;
+    // Number of regions that failed, shared by the slots of a pipeline
+    uint32_t* failures;
+} image_region_slot_t;
+
+// Get the number of regions to keep in flight, when each region needs its own
+// bytes_per_region bytes of images and buffers.
+uint32_t get_image_region_pipeline_depth(size_t bytes_per_region);
+
+// Allocate the buffers and signals of a pipeline slot. The patterns, bits,
+// cmp_mask and failures are shared by all of the slots. Slots that verify
+// on the host pass a kernarg_segment_size of 0, and keep their arguments in
+// the global region.
+void image_region_slot_create(hsa_region_t global_region,
+                              hsa_region_t kernarg_region,
+                              size_t kernarg_segment_size,
+                              void* rgn_values,
+                              void* bkg_values,
+                              uint32_t* bits,
+                              uint32_t* cmp_mask,
+                              uint32_t* failures,
+                              image_region_slot_t* slot);
+
+// Free the buffers and signals of a pipeline slot.
+void image_region_slot_destroy(image_region_slot_t* slot);
+
+// Wait until the previous region of the slot has been verified.
+void image_region_slot_wait(image_region_slot_t* slot);
+
+// Dispatch the verification kernel for a region of the image, and let the
+// reaper check the result once the kernel has finished.
+void image_region_slot_verify(image_region_slot_t* slot,
+                              hsa_ext_image_t image,
+                              const hsa_ext_image_region_t* region,
+                              hsa_queue_t* queue,
+                              hsa_kernel_dispatch_packet_t* dispatch_packet,
+                              reaper_t* reaper);
+
+// Verify a region of the image on the host. The image is exported to
+// export_buffer, which holds the elements of region_all with no padding.
+void image_region_slot_verify_host(image_region_slot_t* slot,
+                                   hsa_ext_image_pfn_t* pfn,
+                                   hsa_agent_t agent,
+                                   hsa_ext_image_t image,
+                                   const hsa_ext_image_format_t* format,
+                                   const hsa_ext_image_region_t* region_all,
+                                   const hsa_ext_image_region_t* region,
+                                   void* export_buffer);
+
+// Maximum number of agents with an image test context
+#define IMAGE_TEST_MAX_CONTEXTS 16
+
+// The resources of an agent that the image tests keep from one test case to
+// the next, when the cases run in the same process. Only the images
+// themselves are created and destroyed by each case.
+typedef struct image_test_context_s {
+    hsa_agent_t agent;
+    // Verify the regions on the host rather than with the kernels
+    int verify_on_host;
+    hsa_region_t global_region;
+    hsa_region_t kernarg_region;
+    // The queue, verification kernels and reaper, NULL or 0 when verifying on the host
+    hsa_queue_t* queue;
+    hsa_code_object_t code_object;
+    hsa_executable_t executable;
+    reaper_t* reaper;
+    // The patterns, bits and cmp_mask shared by the slots
+    void* bg_pattern;
+    void* clr_pattern;
+    uint32_t* bits;
+    uint32_t* cmp_mask;
+    // Number of regions that failed in the current test case
+    uint32_t failures;
+    // The slots, created for kernels with kernarg_segment_size bytes of arguments
+    image_region_slot_t slots[IMAGE_REGION_PIPELINE_DEPTH];
+    int num_slots;
+    size_t kernarg_segment_size;
+    // The buffers the image backing buffers and export buffers are carved
+    // from. They only grow, to the largest size needed by a test case.
+    void* image_arena;
+    size_t image_arena_size;
+    void* export_arena;
+    size_t export_arena_size;
+    // The images of the current test case, carved from the image arena
+    hsa_ext_image_pfn_t pfn;
+    hsa_ext_image_t images[IMAGE_REGION_PIPELINE_DEPTH + 1];
+    int num_images;
+} image_test_context_t;
+
+// Get the image test context of an agent, creating it the first time. The
+// verification kernels are finalized from brig_file. The contexts keep the
+// runtime initialized until image_test_context_destroy_all. They are only
+// reused by the test cases that run in the same process, i.e. when Check
+// does not fork (CK_FORK=no).
+image_test_context_t* image_test_context_get(hsa_agent_t agent, const char* brig_file);
+
+// Destroy the image test contexts of the agents and release their reference
+// to the runtime, once all of the test cases have run.
+void image_test_context_destroy_all(void);
+
+// Start a test case with an image format: release the images of the previous
+// test case, set the patterns, bits and cmp_mask for the format and clear the
+// failure count.
+void image_test_context_set_format(image_test_context_t* context,
+                                   const hsa_ext_image_format_t* format);
+
+// Get the pipeline slots for verification kernels with kernarg_segment_size
+// bytes of arguments, recreating them if they are too small.
+image_region_slot_t* image_test_context_get_slots(image_test_context_t* context,
+                                                  size_t kernarg_segment_size);
+
+// Carve count image backing buffers of size bytes with the given alignment
+// from the image arena, growing it if needed. The images created with the
+// previous buffers are released first.
+void image_test_context_get_image_data(image_test_context_t* context,
+                                       size_t size,
+                                       size_t alignment,
+                                       uint32_t count,
+                                       void** image_data);
+
+// Create an image of the current test case, it is destroyed by
+// image_test_context_release_images.
+hsa_status_t image_test_context_create_image(image_test_context_t* context,
+                                             const hsa_ext_image_descriptor_t* descriptor,
+                                             const void* image_data,
+                                             hsa_access_permission_t access_permission,
+                                             hsa_ext_image_t* image);
+
+// Wait for the regions in flight to be verified, and destroy the images of
+// the current test case. Also done when the next test case starts, in case
+// the current one stopped on a failed assertion.
+void image_test_context_release_images(image_test_context_t* context);
+
+// Carve count export buffers of size bytes from the export arena, growing it
+// if needed.
+void image_test_context_get_export_buffers(image_test_context_t* context,
+                                           size_t size,
+                                           uint32_t count,
+                                           void** export_buffers);
+
+// Number of entries of the image query cache, a power of two
+#define IMAGE_QUERY_CACHE_SIZE 1024
+
+// Number of entries probed before a query is not cached
+#define IMAGE_QUERY_CACHE_MAX_PROBES 8
+
+// Statistics of the image query cache
+typedef struct image_query_cache_counters_s {
+    // Queries answered from the cache
+    uint64_t hits;
+    // Queries passed to the runtime, and cached if they succeeded
+    uint64_t misses;
+    // Successful queries that did not fit in the cache
+    uint64_t overflows;
+} image_query_cache_counters_t;
+
+// Get the data info of an image, as hsa_ext_image_data_get_info, from a cache
+// keyed by the agent, descriptor and permission. Only successful queries are
+// cached. Looking up a cached query takes no lock. When the
+// IMAGE_QUERY_CACHE_CHECK environment variable is set, a cached result is
+// checked against a fresh call to the runtime.
+hsa_status_t image_query_cache_data_get_info(hsa_ext_image_pfn_t* pfn,
+                                             hsa_agent_t agent,
+                                             const hsa_ext_image_descriptor_t* descriptor,
+                                             hsa_access_permission_t access_permission,
+                                             hsa_ext_image_data_info_t* image_data_info);
+
+// Get the capability mask of an image format and geometry, as
+// hsa_ext_image_get_capability, from the same cache.
+hsa_status_t image_query_cache_get_capability(hsa_ext_image_pfn_t* pfn,
+                                              hsa_agent_t agent,
+                                              hsa_ext_image_geometry_t geometry,
+                                              const hsa_ext_image_format_t* image_format,
+                                              uint32_t* capability_mask);
+
+// Get the statistics of the image query cache
+void image_query_cache_get_counters(image_query_cache_counters_t* counters);
+
+// Empty the image query cache and clear its statistics. It must not be
+// called while other threads query the cache.
+void image_query_cache_reset(void);
+
 #endif  // _IMAGE_UTILS_H_
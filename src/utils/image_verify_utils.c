@@ -0,0 +1,495 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "image_format_utils.h"
+#include "image_utils.h"
+#include "image_verify_utils.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IMAGE_VERIFY_AVX2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define IMAGE_VERIFY_NEON 1
+#endif
+
+// The size of the lane patterns, large enough for the widest vector
+#define IMAGE_VERIFY_PATTERN_SIZE 32
+
+// The lanes the vector kernels compare the elements with
+typedef enum image_verify_lane_e {
+    IMAGE_VERIFY_LANE_NONE = 0,  // Only checked by the scalar code
+    IMAGE_VERIFY_LANE_U8,
+    IMAGE_VERIFY_LANE_S8,
+    IMAGE_VERIFY_LANE_U16,
+    IMAGE_VERIFY_LANE_S16,
+    IMAGE_VERIFY_LANE_U32,
+    IMAGE_VERIFY_LANE_S32,
+    IMAGE_VERIFY_LANE_F32
+} image_verify_lane_t;
+
+// The values a channel is allowed to hold
+typedef struct verify_channel_s {
+    int32_t component;  // -1 if the channel is not compared
+    int64_t lo;  // The smallest raw value that matches
+    int64_t hi;  // The largest raw value that matches
+    float expected;  // The expected value of a floating point channel
+    float tolerance;
+} verify_channel_t;
+
+// An expected pattern, prepared for the scalar and vector checks
+typedef struct verify_pattern_s {
+    verify_channel_t channels[4];
+    // The lo and hi values of each lane, repeated over the vector. The
+    // expected value and the tolerance for floating point lanes.
+    uint8_t lo[IMAGE_VERIFY_PATTERN_SIZE];
+    uint8_t hi[IMAGE_VERIFY_PATTERN_SIZE];
+    // Set for the floating point lanes that are compared
+    uint8_t care[IMAGE_VERIFY_PATTERN_SIZE];
+    uint32_t vector_size;  // 0 if the vector kernels cannot be used
+    image_verify_lane_t lane;
+} verify_pattern_t;
+
+typedef int (*verify_vector_fn_t)(const verify_pattern_t* pattern,
+                                  image_verify_lane_t lane,
+                                  const uint8_t* data,
+                                  size_t num_bytes);
+
+// Get the lane the vector kernels compare the channels of a layout with
+static image_verify_lane_t get_lane(const image_format_layout_t* layout) {
+    switch (layout->channel_type) {
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8 : { return IMAGE_VERIFY_LANE_S8; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT8 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8 : { return IMAGE_VERIFY_LANE_U8; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SNORM_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 : { return IMAGE_VERIFY_LANE_S16; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNORM_INT16 :
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 : { return IMAGE_VERIFY_LANE_U16; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32 : { return IMAGE_VERIFY_LANE_S32; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32 : { return IMAGE_VERIFY_LANE_U32; }
+        case HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT : { return IMAGE_VERIFY_LANE_F32; }
+        default : { return IMAGE_VERIFY_LANE_NONE; }
+    }
+}
+
+// Find the range of raw values of a channel that match the expected value
+static void get_raw_range(const image_format_layout_t* layout,
+                          uint32_t channel,
+                          int is_normalized,
+                          float expected,
+                          float tolerance,
+                          int64_t expected_int,
+                          int64_t* lo,
+                          int64_t* hi) {
+    uint32_t width = layout->widths[channel];
+    int64_t min = layout->is_signed ? -(1ll << (width - 1)) : 0;
+    int64_t max = layout->is_signed ? (1ll << (width - 1)) - 1 : (1ll << width) - 1;
+
+    if (!is_normalized) {
+        *lo = expected_int;
+        *hi = expected_int;
+    } else {
+        // The decoded values increase with the raw values, so the first raw
+        // value above expected - tolerance and the last one below
+        // expected + tolerance are found with binary searches.
+        int64_t first = min;
+        int64_t last = max + 1;
+        while (first < last) {
+            int64_t middle = first + (last - first) / 2;
+            if (image_format_decode_norm(layout, channel, middle) > (double) expected - tolerance) {
+                last = middle;
+            } else {
+                first = middle + 1;
+            }
+        }
+        *lo = first;
+
+        first = min - 1;
+        last = max;
+        while (first < last) {
+            int64_t middle = last - (last - first) / 2;
+            if (image_format_decode_norm(layout, channel, middle) < (double) expected + tolerance) {
+                first = middle;
+            } else {
+                last = middle - 1;
+            }
+        }
+        *hi = last;
+    }
+
+    // Keep empty ranges representable in the lanes
+    if (*lo > *hi || *lo > max || *hi < min) {
+        *lo = max;
+        *hi = min;
+    }
+
+    return;
+}
+
+// Write the raw value of a lane into a lane pattern
+static void write_lane(uint8_t* lane, uint32_t size, int64_t value) {
+    if (1 == size) {
+        uint8_t lane_value = (uint8_t) value;
+        memcpy(lane, &lane_value, size);
+    } else if (2 == size) {
+        uint16_t lane_value = (uint16_t) value;
+        memcpy(lane, &lane_value, size);
+    } else {
+        uint32_t lane_value = (uint32_t) value;
+        memcpy(lane, &lane_value, size);
+    }
+
+    return;
+}
+
+// Prepare an expected pattern for the checks
+static void prepare_pattern(const image_format_layout_t* layout,
+                            const void* values,
+                            uint32_t cmp_mask,
+                            uint32_t vector_size,
+                            verify_pattern_t* pattern) {
+    hsa_ext_image_channel_type_t type = layout->channel_type;
+    int is_int = (HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT8 == type ||
+                  HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT16 == type ||
+                  HSA_EXT_IMAGE_CHANNEL_TYPE_SIGNED_INT32 == type ||
+                  HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT8 == type ||
+                  HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT16 == type ||
+                  HSA_EXT_IMAGE_CHANNEL_TYPE_UNSIGNED_INT32 == type);
+    int is_float = (HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT == type ||
+                    HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT == type);
+    float tolerance = ldexpf(0.6f, -(int) get_channel_type_bits(type));
+    uint32_t ii, jj;
+
+    memset(pattern, 0, sizeof(verify_pattern_t));
+    pattern->lane = get_lane(layout);
+
+    for (ii = 0; ii < layout->num_channels; ++ii) {
+        verify_channel_t* channel = &pattern->channels[ii];
+        int32_t component = layout->components[ii];
+        uint32_t width = layout->widths[ii];
+
+        // Channels that are padding or masked out match anything
+        if (component < 0 || !(cmp_mask & (0x1000 >> (4 * component)))) {
+            channel->component = -1;
+            channel->lo = layout->is_signed ? -(1ll << (width - 1)) : 0;
+            channel->hi = layout->is_signed ? (1ll << (width - 1)) - 1 : (1ll << width) - 1;
+            continue;
+        }
+
+        channel->component = component;
+        channel->tolerance = tolerance;
+        if (is_int) {
+            int64_t expected_int = layout->is_signed ? (int64_t) ((const int32_t*) values)[component] :
+                                                       (int64_t) ((const uint32_t*) values)[component];
+            get_raw_range(layout, ii, 0, 0.0f, 0.0f, expected_int, &channel->lo, &channel->hi);
+        } else {
+            channel->expected = ((const float*) values)[component];
+            if (layout->is_srgb && 3 != component) {
+                channel->expected = image_format_linear_to_srgb(channel->expected);
+            }
+            if (!is_float) {
+                get_raw_range(layout, ii, 1, channel->expected, tolerance, 0, &channel->lo, &channel->hi);
+            }
+        }
+    }
+
+    // The vector kernels need the elements to tile the vectors
+    pattern->vector_size = 0;
+    if (0 == vector_size || IMAGE_VERIFY_LANE_NONE == pattern->lane || 0 != vector_size % layout->element_size) {
+        return;
+    }
+    pattern->vector_size = vector_size;
+
+    for (jj = 0; jj < IMAGE_VERIFY_PATTERN_SIZE; jj += layout->element_size) {
+        for (ii = 0; ii < layout->num_channels; ++ii) {
+            const verify_channel_t* channel = &pattern->channels[ii];
+            uint32_t offset = jj + ii * layout->channel_size;
+            if (IMAGE_VERIFY_LANE_F32 == pattern->lane) {
+                memcpy(&pattern->lo[offset], &channel->expected, sizeof(float));
+                memcpy(&pattern->hi[offset], &channel->tolerance, sizeof(float));
+                memset(&pattern->care[offset], (channel->component < 0) ? 0 : 0xff, sizeof(float));
+            } else {
+                write_lane(&pattern->lo[offset], layout->channel_size, channel->lo);
+                write_lane(&pattern->hi[offset], layout->channel_size, channel->hi);
+            }
+        }
+    }
+
+    return;
+}
+
+// Check the elements of a run one at a time
+static uint32_t verify_run_scalar(const image_format_layout_t* layout,
+                                  const verify_pattern_t* pattern,
+                                  const uint8_t* data,
+                                  uint32_t count) {
+    uint32_t errors = 0;
+    uint32_t ii, jj;
+
+    for (ii = 0; ii < count; ++ii) {
+        const uint8_t* element = data + (size_t) ii * layout->element_size;
+        for (jj = 0; jj < layout->num_channels; ++jj) {
+            const verify_channel_t* channel = &pattern->channels[jj];
+            if (channel->component < 0) {
+                continue;
+            }
+
+            int64_t raw = image_format_read_channel(layout, element, jj);
+            int match;
+            if (HSA_EXT_IMAGE_CHANNEL_TYPE_FLOAT == layout->channel_type) {
+                float value;
+                uint32_t bits = (uint32_t) raw;
+                memcpy(&value, &bits, sizeof(float));
+                match = fabsf(value - channel->expected) < channel->tolerance;
+            } else if (HSA_EXT_IMAGE_CHANNEL_TYPE_HALF_FLOAT == layout->channel_type) {
+                match = fabsf(image_format_half_to_float((uint16_t) raw) - channel->expected) < channel->tolerance;
+            } else {
+                match = (raw >= channel->lo) && (raw <= channel->hi);
+            }
+
+            if (!match) {
+                errors |= 0x1000 >> (4 * channel->component);
+            }
+        }
+    }
+
+    return errors;
+}
+
+#if defined(IMAGE_VERIFY_AVX2)
+// Check num_bytes of elements 32 bytes at a time, returns 1 if they all match
+__attribute__((target("avx2")))
+static int verify_vector_avx2(const verify_pattern_t* pattern,
+                              image_verify_lane_t lane,
+                              const uint8_t* data,
+                              size_t num_bytes) {
+    __m256i lo = _mm256_loadu_si256((const __m256i*) pattern->lo);
+    __m256i hi = _mm256_loadu_si256((const __m256i*) pattern->hi);
+    __m256i ok = _mm256_set1_epi8(-1);
+    size_t ii;
+
+#define IMAGE_VERIFY_AVX2_RANGE(max_fn, min_fn, cmpeq_fn)                       \
+    for (ii = 0; ii < num_bytes; ii += 32) {                                    \
+        __m256i x = _mm256_loadu_si256((const __m256i*) (data + ii));            \
+        ok = _mm256_and_si256(ok, cmpeq_fn(max_fn(x, lo), x));                   \
+        ok = _mm256_and_si256(ok, cmpeq_fn(min_fn(x, hi), x));                   \
+    }
+
+    switch (lane) {
+        case IMAGE_VERIFY_LANE_U8 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epu8, _mm256_min_epu8, _mm256_cmpeq_epi8); break; }
+        case IMAGE_VERIFY_LANE_S8 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epi8, _mm256_min_epi8, _mm256_cmpeq_epi8); break; }
+        case IMAGE_VERIFY_LANE_U16 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epu16, _mm256_min_epu16, _mm256_cmpeq_epi16); break; }
+        case IMAGE_VERIFY_LANE_S16 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epi16, _mm256_min_epi16, _mm256_cmpeq_epi16); break; }
+        case IMAGE_VERIFY_LANE_U32 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epu32, _mm256_min_epu32, _mm256_cmpeq_epi32); break; }
+        case IMAGE_VERIFY_LANE_S32 : { IMAGE_VERIFY_AVX2_RANGE(_mm256_max_epi32, _mm256_min_epi32, _mm256_cmpeq_epi32); break; }
+        case IMAGE_VERIFY_LANE_F32 : {
+            __m256 expected = _mm256_castsi256_ps(lo);
+            __m256 tolerance = _mm256_castsi256_ps(hi);
+            __m256 ignore = _mm256_castsi256_ps(_mm256_xor_si256(_mm256_loadu_si256((const __m256i*) pattern->care), ok));
+            __m256 sign = _mm256_set1_ps(-0.0f);
+            __m256 match = _mm256_castsi256_ps(ok);
+            for (ii = 0; ii < num_bytes; ii += 32) {
+                __m256 x = _mm256_loadu_ps((const float*) (data + ii));
+                __m256 difference = _mm256_andnot_ps(sign, _mm256_sub_ps(x, expected));
+                match = _mm256_and_ps(match, _mm256_or_ps(_mm256_cmp_ps(difference, tolerance, _CMP_LT_OQ), ignore));
+            }
+            return 0xff == _mm256_movemask_ps(match);
+        }
+        default : { return 0; }
+    }
+
+#undef IMAGE_VERIFY_AVX2_RANGE
+
+    return -1 == _mm256_movemask_epi8(ok);
+}
+#endif
+
+#if defined(IMAGE_VERIFY_NEON)
+#define IMAGE_VERIFY_NEON_MASK(x) (x)
+
+// Check num_bytes of elements 16 bytes at a time, returns 1 if they all match
+static int verify_vector_neon(const verify_pattern_t* pattern,
+                              image_verify_lane_t lane,
+                              const uint8_t* data,
+                              size_t num_bytes) {
+    uint8x16_t ok = vdupq_n_u8(0xff);
+    size_t ii;
+
+#define IMAGE_VERIFY_NEON_RANGE(type, load_fn, cge_fn, cle_fn, cast_fn)         \
+    {                                                                           \
+        type lo = load_fn((const void*) pattern->lo);                           \
+        type hi = load_fn((const void*) pattern->hi);                           \
+        for (ii = 0; ii < num_bytes; ii += 16) {                                \
+            type x = load_fn((const void*) (data + ii));                        \
+            ok = vandq_u8(ok, cast_fn(cge_fn(x, lo)));                          \
+            ok = vandq_u8(ok, cast_fn(cle_fn(x, hi)));                          \
+        }                                                                       \
+    }
+
+    switch (lane) {
+        case IMAGE_VERIFY_LANE_U8 : { IMAGE_VERIFY_NEON_RANGE(uint8x16_t, vld1q_u8, vcgeq_u8, vcleq_u8, IMAGE_VERIFY_NEON_MASK); break; }
+        case IMAGE_VERIFY_LANE_S8 : { IMAGE_VERIFY_NEON_RANGE(int8x16_t, vld1q_s8, vcgeq_s8, vcleq_s8, IMAGE_VERIFY_NEON_MASK); break; }
+        case IMAGE_VERIFY_LANE_U16 : { IMAGE_VERIFY_NEON_RANGE(uint16x8_t, vld1q_u16, vcgeq_u16, vcleq_u16, vreinterpretq_u8_u16); break; }
+        case IMAGE_VERIFY_LANE_S16 : { IMAGE_VERIFY_NEON_RANGE(int16x8_t, vld1q_s16, vcgeq_s16, vcleq_s16, vreinterpretq_u8_u16); break; }
+        case IMAGE_VERIFY_LANE_U32 : { IMAGE_VERIFY_NEON_RANGE(uint32x4_t, vld1q_u32, vcgeq_u32, vcleq_u32, vreinterpretq_u8_u32); break; }
+        case IMAGE_VERIFY_LANE_S32 : { IMAGE_VERIFY_NEON_RANGE(int32x4_t, vld1q_s32, vcgeq_s32, vcleq_s32, vreinterpretq_u8_u32); break; }
+        case IMAGE_VERIFY_LANE_F32 : {
+            float32x4_t expected = vld1q_f32((const float*) pattern->lo);
+            float32x4_t tolerance = vld1q_f32((const float*) pattern->hi);
+            uint32x4_t ignore = vmvnq_u32(vld1q_u32((const uint32_t*) pattern->care));
+            for (ii = 0; ii < num_bytes; ii += 16) {
+                float32x4_t x = vld1q_f32((const float*) (data + ii));
+                uint32x4_t match = vorrq_u32(vcltq_f32(vabdq_f32(x, expected), tolerance), ignore);
+                ok = vandq_u8(ok, vreinterpretq_u8_u32(match));
+            }
+            break;
+        }
+        default : { return 0; }
+    }
+
+#undef IMAGE_VERIFY_NEON_RANGE
+
+    return 0xff == vminvq_u8(ok);
+}
+#endif
+
+// Select the vector kernel of the host
+static verify_vector_fn_t get_vector_fn(uint32_t* vector_size) {
+#if defined(IMAGE_VERIFY_AVX2)
+    if (__builtin_cpu_supports("avx2")) {
+        *vector_size = 32;
+        return verify_vector_avx2;
+    }
+#elif defined(IMAGE_VERIFY_NEON)
+    *vector_size = 16;
+    return verify_vector_neon;
+#endif
+    *vector_size = 0;
+    return NULL;
+}
+
+// Get the instruction set used by image_verify_region
+const char* image_verify_get_isa(void) {
+    uint32_t vector_size;
+    if (NULL == get_vector_fn(&vector_size)) {
+        return "scalar";
+    }
+
+    return (32 == vector_size) ? "avx2" : "neon";
+}
+
+// Check a run of elements with the same expected pattern
+static uint32_t verify_run(const image_format_layout_t* layout,
+                           const verify_pattern_t* pattern,
+                           verify_vector_fn_t vector_fn,
+                           const uint8_t* data,
+                           uint32_t count) {
+    if (0 != pattern->vector_size && NULL != vector_fn) {
+        size_t num_bytes = (size_t) count * layout->element_size;
+        size_t vector_bytes = num_bytes - num_bytes % pattern->vector_size;
+
+        // When the vectors do not all match, the scalar code finds which
+        // components are in error.
+        if (0 != vector_bytes && vector_fn(pattern, pattern->lane, data, vector_bytes)) {
+            data += vector_bytes;
+            count -= vector_bytes / layout->element_size;
+        }
+    }
+
+    return verify_run_scalar(layout, pattern, data, count);
+}
+
+// Verify an exported image on the host
+uint32_t image_verify_region(const hsa_ext_image_format_t* format,
+                             const void* data,
+                             size_t row_pitch,
+                             size_t slice_pitch,
+                             const uint32_t size[3],
+                             const uint32_t start_region[3],
+                             const uint32_t end_region[3],
+                             const void* rgn_values,
+                             const void* bkg_values,
+                             uint32_t cmp_mask) {
+    image_format_layout_t layout;
+    if (HSA_STATUS_SUCCESS != image_format_get_layout(format, &layout)) {
+        return cmp_mask;
+    }
+
+    uint32_t vector_size;
+    verify_vector_fn_t vector_fn = get_vector_fn(&vector_size);
+
+    verify_pattern_t rgn_pattern;
+    verify_pattern_t bkg_pattern;
+    prepare_pattern(&layout, rgn_values, cmp_mask, vector_size, &rgn_pattern);
+    prepare_pattern(&layout, bkg_values, cmp_mask, vector_size, &bkg_pattern);
+
+    // The region columns of each row, clamped to the exported data
+    uint32_t start_x = (start_region[0] < size[0]) ? start_region[0] : size[0];
+    uint32_t end_x = (end_region[0] < size[0]) ? end_region[0] : size[0];
+    end_x = (end_x > start_x) ? end_x : start_x;
+
+    uint32_t errors = 0;
+    uint32_t y, z;
+    for (z = 0; z < size[2]; ++z) {
+        for (y = 0; y < size[1]; ++y) {
+            const uint8_t* row = (const uint8_t*) data + z * slice_pitch + y * row_pitch;
+            if (y < start_region[1] || y >= end_region[1] || z < start_region[2] || z >= end_region[2]) {
+                errors |= verify_run(&layout, &bkg_pattern, vector_fn, row, size[0]);
+                continue;
+            }
+
+            errors |= verify_run(&layout, &bkg_pattern, vector_fn, row, start_x);
+            errors |= verify_run(&layout, &rgn_pattern, vector_fn, row + (size_t) start_x * layout.element_size, end_x - start_x);
+            errors |= verify_run(&layout, &bkg_pattern, vector_fn, row + (size_t) end_x * layout.element_size, size[0] - end_x);
+        }
+    }
+
+    return errors;
+}
@@ -0,0 +1,92 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#ifndef _IMAGE_VERIFY_UTILS_H_
+#define _IMAGE_VERIFY_UTILS_H_
+
+#include <hsa.h>
+#include <hsa_ext_image.h>
+#include <stdint.h>
+
+/**
+ * @brief get the name of the instruction set used by image_verify_region,
+ * "avx2", "neon" or "scalar"
+ * @return the name
+ */
+const char* image_verify_get_isa(void);
+
+/**
+ * @brief verify an exported image on the host, with the same checks as
+ * the verify_image_region kernels
+ * @details The expected values are four int32_t, uint32_t or float values,
+ * depending on the channel type, as for the kernels. Normalized and floating
+ * point channels match when they are within 0.6 / 2^get_channel_type_bits of
+ * the expected value. sRGB channels are compared in the encoded space.
+ * @param format The format of the image
+ * @param data The exported image data
+ * @param row_pitch The number of bytes between rows of data
+ * @param slice_pitch The number of bytes between slices of data
+ * @param size The width, height and depth of the exported data
+ * @param start_region The first coordinates of the region
+ * @param end_region The coordinates one past the end of the region
+ * @param rgn_values The expected values inside the region
+ * @param bkg_values The expected values outside of the region
+ * @param cmp_mask The components to compare, as returned by get_cmp_info
+ * @return the components that did not match, with the same layout as the
+ * error word of the verify_image_region kernels
+ */
+uint32_t image_verify_region(const hsa_ext_image_format_t* format,
+                             const void* data,
+                             size_t row_pitch,
+                             size_t slice_pitch,
+                             const uint32_t size[3],
+                             const uint32_t start_region[3],
+                             const uint32_t end_region[3],
+                             const void* rgn_values,
+                             const void* bkg_values,
+                             uint32_t cmp_mask);
+
+#endif  // _IMAGE_VERIFY_UTILS_H_
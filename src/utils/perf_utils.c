@@ -0,0 +1,166 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "perf_utils.h"
+
+uint64_t perf_get_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+uint64_t perf_get_thread_cpu_time_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ull + (uint64_t) ts.tv_nsec;
+}
+
+void perf_get_process_usage(perf_process_usage_t* usage) {
+    memset(usage, 0, sizeof(perf_process_usage_t));
+
+    struct rusage rusage;
+    if (0 == getrusage(RUSAGE_SELF, &rusage)) {
+        usage->user_time_ns = (uint64_t) rusage.ru_utime.tv_sec * 1000000000ull + (uint64_t) rusage.ru_utime.tv_usec * 1000ull;
+        usage->system_time_ns = (uint64_t) rusage.ru_stime.tv_sec * 1000000000ull + (uint64_t) rusage.ru_stime.tv_usec * 1000ull;
+        usage->minor_faults = (uint64_t) rusage.ru_minflt;
+        usage->major_faults = (uint64_t) rusage.ru_majflt;
+    }
+
+    // The second field of statm is the number of resident pages
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if (NULL != statm) {
+        unsigned long size, resident;
+        if (2 == fscanf(statm, "%lu %lu", &size, &resident)) {
+            usage->rss_bytes = (uint64_t) resident * (uint64_t) sysconf(_SC_PAGESIZE);
+        }
+        fclose(statm);
+    }
+
+    return;
+}
+
+uint64_t perf_get_env_uint(const char* name, uint64_t default_value) {
+    const char* value = getenv(name);
+    if (NULL == value || '\0' == *value) {
+        return default_value;
+    }
+
+    char* end;
+    unsigned long long parsed = strtoull(value, &end, 0);
+    if ('\0' != *end) {
+        fprintf(stderr, "Ignoring invalid value %s=%s\n", name, value);
+        return default_value;
+    }
+
+    return (uint64_t) parsed;
+}
+
+static int compare_doubles(const void* a, const void* b) {
+    double da = *(const double*) a;
+    double db = *(const double*) b;
+    return (da > db) - (da < db);
+}
+
+// Nearest rank percentile of a sorted array
+static double percentile(const double* sorted, size_t count, double pct) {
+    size_t rank = (size_t) ceil(pct / 100.0 * (double) count);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[rank - 1];
+}
+
+void perf_compute_stats(double* samples, size_t count, perf_stats_t* stats) {
+    memset(stats, 0, sizeof(perf_stats_t));
+    if (0 == count) {
+        return;
+    }
+
+    qsort(samples, count, sizeof(double), compare_doubles);
+
+    double sum = 0.0;
+    size_t ii;
+    for (ii = 0; ii < count; ++ii) {
+        sum += samples[ii];
+    }
+
+    stats->count = count;
+    stats->min = samples[0];
+    stats->max = samples[count - 1];
+    stats->mean = sum / (double) count;
+
+    double variance = 0.0;
+    for (ii = 0; ii < count; ++ii) {
+        double diff = samples[ii] - stats->mean;
+        variance += diff * diff;
+    }
+    if (count > 1) {
+        variance /= (double) (count - 1);
+    }
+
+    stats->stddev = sqrt(variance);
+    stats->cv = (0.0 != stats->mean) ? stats->stddev / stats->mean : 0.0;
+    stats->p50 = percentile(samples, count, 50.0);
+    stats->p90 = percentile(samples, count, 90.0);
+    stats->p99 = percentile(samples, count, 99.0);
+
+    return;
+}
+
+void perf_print_stats(const char* label, const char* units, const perf_stats_t* stats) {
+    printf("%-40s n=%-8zu mean=%.3f %s stddev=%.3f cv=%.3f min=%.3f p50=%.3f p90=%.3f p99=%.3f max=%.3f\n",
+           label, stats->count, stats->mean, units, stats->stddev, stats->cv,
+           stats->min, stats->p50, stats->p90, stats->p99, stats->max);
+    return;
+}
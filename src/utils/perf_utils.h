@@ -0,0 +1,96 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#ifndef _PERF_UTILS_H_
+#define _PERF_UTILS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Summary statistics for a set of measurement samples
+typedef struct perf_stats_s {
+    size_t count;
+    double min;
+    double max;
+    double mean;
+    double stddev;
+    // Coefficient of variation, stddev / mean
+    double cv;
+    double p50;
+    double p90;
+    double p99;
+} perf_stats_t;
+
+// Return a monotonic wall clock time stamp in nanoseconds
+uint64_t perf_get_time_ns();
+
+// Return the CPU time consumed by the calling thread in nanoseconds
+uint64_t perf_get_thread_cpu_time_ns();
+
+// Resource usage of the process
+typedef struct perf_process_usage_s {
+    uint64_t user_time_ns;
+    uint64_t system_time_ns;
+    uint64_t minor_faults;
+    uint64_t major_faults;
+    // Resident set size in bytes, 0 if it can't be read
+    uint64_t rss_bytes;
+} perf_process_usage_t;
+
+// Get the CPU time, page faults and resident set size of the process
+void perf_get_process_usage(perf_process_usage_t* usage);
+
+// Return the value of an unsigned integer environment variable, or
+// default_value if the variable isn't set or can't be parsed
+uint64_t perf_get_env_uint(const char* name, uint64_t default_value);
+
+// Compute the summary statistics of the samples, the samples are sorted in place
+void perf_compute_stats(double* samples, size_t count, perf_stats_t* stats);
+
+// Print a single line summary of the statistics
+void perf_print_stats(const char* label, const char* units, const perf_stats_t* stats);
+
+#endif  // _PERF_UTILS_H_
@@ -64,7 +64,7 @@ void enqueue_dispatch_packet_at(uint64_t write_index,
     uint64_t delta;
     do {
         delta = write_index - hsa_queue_load_read_index_relaxed(queue);
-    } while (delta > queue->size);
+    } while (delta >= queue->size);
 
     const uint32_t queue_mask = queue->size - 1;
 
@@ -108,8 +108,8 @@ void enqueue_dispatch_packets_at(uint64_t write_index,
 
             uint64_t delta;
             do {
-                delta = write_index + dispatch_count - hsa_queue_load_read_index_relaxed(queue);
-            } while (delta > queue->size);
+                delta = write_index + dispatch_count - 1 - hsa_queue_load_read_index_relaxed(queue);
+            } while (delta >= queue->size);
 
             const uint32_t queue_mask = queue->size - 1;
 
@@ -0,0 +1,256 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "reaper_utils.h"
+
+#define REAPER_ENTRY_FREE 0
+#define REAPER_ENTRY_PENDING 1
+#define REAPER_ENTRY_REAPING 2
+
+static int condition_satisfied(hsa_signal_condition_t condition, hsa_signal_value_t value, hsa_signal_value_t compare_value) {
+    switch (condition) {
+    case HSA_SIGNAL_CONDITION_EQ:
+        return value == compare_value;
+    case HSA_SIGNAL_CONDITION_NE:
+        return value != compare_value;
+    case HSA_SIGNAL_CONDITION_LT:
+        return value < compare_value;
+    case HSA_SIGNAL_CONDITION_GTE:
+        return value >= compare_value;
+    default:
+        return 0;
+    }
+}
+
+// Work function of the reaper thread
+static void* reaper_thread(void *data) {
+    reaper_t *reaper = (reaper_t*) data;
+    uint32_t *reaped = (uint32_t*) malloc(reaper->max_entries * sizeof(uint32_t));
+    hsa_signal_value_t *values = (hsa_signal_value_t*) malloc(reaper->max_entries * sizeof(hsa_signal_value_t));
+
+    pthread_mutex_lock(&reaper->mutex);
+    while (1) {
+        while (!reaper->exit_flag && 0 == reaper->num_pending) {
+            pthread_cond_wait(&reaper->work_cond, &reaper->mutex);
+        }
+        if (0 == reaper->num_pending) {
+            break;
+        }
+
+        // Block on the oldest signal, which usually completes first
+        uint32_t ii, oldest = 0;
+        uint64_t oldest_sequence = UINT64_MAX;
+        for (ii = 0; ii < reaper->max_entries; ++ii) {
+            if (REAPER_ENTRY_PENDING == reaper->entries[ii].state && reaper->entries[ii].sequence < oldest_sequence) {
+                oldest = ii;
+                oldest_sequence = reaper->entries[ii].sequence;
+            }
+        }
+        struct reaper_entry_s wait_entry = reaper->entries[oldest];
+        pthread_mutex_unlock(&reaper->mutex);
+
+        hsa_signal_wait_acquire(wait_entry.signal, wait_entry.condition, wait_entry.compare_value,
+                                reaper->wait_timeout, HSA_WAIT_STATE_BLOCKED);
+
+        // Collect every signal that has completed, in the order they were added
+        pthread_mutex_lock(&reaper->mutex);
+        ++reaper->counters.wakeups;
+        uint32_t num_reaped = 0;
+        for (ii = 0; ii < reaper->max_entries; ++ii) {
+            struct reaper_entry_s *entry = &reaper->entries[ii];
+            if (REAPER_ENTRY_PENDING != entry->state) {
+                continue;
+            }
+            hsa_signal_value_t value = hsa_signal_load_acquire(entry->signal);
+            if (!condition_satisfied(entry->condition, value, entry->compare_value)) {
+                continue;
+            }
+            entry->state = REAPER_ENTRY_REAPING;
+            uint32_t jj = num_reaped++;
+            while (jj > 0 && reaper->entries[reaped[jj - 1]].sequence > entry->sequence) {
+                reaped[jj] = reaped[jj - 1];
+                values[jj] = values[jj - 1];
+                --jj;
+            }
+            reaped[jj] = ii;
+            values[jj] = value;
+        }
+        reaper->num_pending -= num_reaped;
+        pthread_mutex_unlock(&reaper->mutex);
+
+        for (ii = 0; ii < num_reaped; ++ii) {
+            struct reaper_entry_s *entry = &reaper->entries[reaped[ii]];
+            if (NULL != entry->callback) {
+                entry->callback(values[ii], entry->data);
+            }
+        }
+
+        pthread_mutex_lock(&reaper->mutex);
+        for (ii = 0; ii < num_reaped; ++ii) {
+            reaper->entries[reaped[ii]].state = REAPER_ENTRY_FREE;
+        }
+        reaper->num_entries -= num_reaped;
+        reaper->counters.completions += num_reaped;
+        if (num_reaped > 0) {
+            pthread_cond_broadcast(&reaper->space_cond);
+        }
+    }
+    pthread_mutex_unlock(&reaper->mutex);
+
+    free(values);
+    free(reaped);
+
+    return NULL;
+}
+
+reaper_t* reaper_create(uint32_t max_entries) {
+    if (0 == max_entries) {
+        return NULL;
+    }
+
+    reaper_t *reaper = (reaper_t*) malloc(sizeof(reaper_t));
+    if (NULL == reaper) {
+        return NULL;
+    }
+    memset(reaper, 0, sizeof(reaper_t));
+
+    reaper->entries = (struct reaper_entry_s*) calloc(max_entries, sizeof(struct reaper_entry_s));
+    if (NULL == reaper->entries) {
+        free(reaper);
+        return NULL;
+    }
+    reaper->max_entries = max_entries;
+
+    uint64_t frequency = 0;
+    hsa_system_get_info(HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY, &frequency);
+    reaper->wait_timeout = (frequency / 1000000) * REAPER_WAIT_TIMEOUT_US;
+    if (0 == reaper->wait_timeout) {
+        reaper->wait_timeout = 1;
+    }
+
+    pthread_mutex_init(&reaper->mutex, NULL);
+    pthread_cond_init(&reaper->work_cond, NULL);
+    pthread_cond_init(&reaper->space_cond, NULL);
+
+    if (0 != pthread_create(&reaper->thread, NULL, reaper_thread, reaper)) {
+        pthread_cond_destroy(&reaper->space_cond);
+        pthread_cond_destroy(&reaper->work_cond);
+        pthread_mutex_destroy(&reaper->mutex);
+        free(reaper->entries);
+        free(reaper);
+        return NULL;
+    }
+
+    return reaper;
+}
+
+void reaper_destroy(reaper_t *reaper) {
+    // The thread only exits once nothing is outstanding
+    pthread_mutex_lock(&reaper->mutex);
+    reaper->exit_flag = 1;
+    pthread_cond_signal(&reaper->work_cond);
+    pthread_mutex_unlock(&reaper->mutex);
+    pthread_join(reaper->thread, NULL);
+
+    pthread_cond_destroy(&reaper->space_cond);
+    pthread_cond_destroy(&reaper->work_cond);
+    pthread_mutex_destroy(&reaper->mutex);
+    free(reaper->entries);
+    free(reaper);
+    return;
+}
+
+void reaper_add(reaper_t *reaper,
+                hsa_signal_t signal,
+                hsa_signal_condition_t condition,
+                hsa_signal_value_t compare_value,
+                reaper_callback_t callback,
+                void *data) {
+    pthread_mutex_lock(&reaper->mutex);
+    while (reaper->num_entries == reaper->max_entries) {
+        pthread_cond_wait(&reaper->space_cond, &reaper->mutex);
+    }
+
+    uint32_t ii;
+    for (ii = 0; REAPER_ENTRY_FREE != reaper->entries[ii].state; ++ii) {}
+    struct reaper_entry_s *entry = &reaper->entries[ii];
+    entry->signal = signal;
+    entry->condition = condition;
+    entry->compare_value = compare_value;
+    entry->callback = callback;
+    entry->data = data;
+    entry->sequence = reaper->next_sequence++;
+    entry->state = REAPER_ENTRY_PENDING;
+
+    ++reaper->num_entries;
+    ++reaper->num_pending;
+    if (reaper->num_entries > reaper->counters.high_water) {
+        reaper->counters.high_water = reaper->num_entries;
+    }
+    pthread_cond_signal(&reaper->work_cond);
+    pthread_mutex_unlock(&reaper->mutex);
+
+    return;
+}
+
+void reaper_drain(reaper_t *reaper) {
+    pthread_mutex_lock(&reaper->mutex);
+    while (0 != reaper->num_entries) {
+        pthread_cond_wait(&reaper->space_cond, &reaper->mutex);
+    }
+    pthread_mutex_unlock(&reaper->mutex);
+    return;
+}
+
+void reaper_get_counters(reaper_t *reaper, reaper_counters_t *counters) {
+    pthread_mutex_lock(&reaper->mutex);
+    *counters = reaper->counters;
+    pthread_mutex_unlock(&reaper->mutex);
+    return;
+}
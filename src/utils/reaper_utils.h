@@ -0,0 +1,173 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef _REAPER_UTILS_H_
+#define _REAPER_UTILS_H_
+
+#include <hsa.h>
+#include <pthread.h>
+#include <stdint.h>
+
+/**
+ * @brief How long the reaper blocks on the oldest outstanding signal before
+ * checking the others, in microseconds
+ */
+#define REAPER_WAIT_TIMEOUT_US 100
+
+/**
+ * @brief Function called by the reaper thread once the condition of a
+ * signal is satisfied. It must not add signals to the reaper.
+ * @param value The value of the signal that satisfied the condition
+ * @param data The data passed to reaper_add
+ */
+typedef void (*reaper_callback_t)(hsa_signal_value_t value, void *data);
+
+/**
+ * @struct reaper_counters_s
+ * @brief Reaper statistics
+ */
+struct reaper_counters_s {
+    /* Callbacks invoked */
+    uint64_t completions;
+    /* Times the reaper thread woke up and checked the outstanding signals */
+    uint64_t wakeups;
+    /* Largest number of outstanding signals */
+    uint32_t high_water;
+};
+
+typedef struct reaper_counters_s reaper_counters_t;
+
+/**
+ * @struct reaper_entry_s
+ * @brief An outstanding signal
+ */
+struct reaper_entry_s {
+    hsa_signal_t signal;
+    hsa_signal_condition_t condition;
+    hsa_signal_value_t compare_value;
+    reaper_callback_t callback;
+    void *data;
+    uint64_t sequence;
+    /* 0 if the slot is free, 1 while waiting, 2 while the callback runs */
+    int state;
+};
+
+/**
+ * @struct reaper_s
+ * @brief A thread that tracks outstanding completion signals and invokes
+ * a callback for each once its condition is satisfied. Callbacks of the
+ * signals completed at the same time are invoked in the order the signals
+ * were added.
+ */
+struct reaper_s {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    /* Signaled when a signal is added, or the reaper has to exit */
+    pthread_cond_t work_cond;
+    /* Signaled when signals have been reaped */
+    pthread_cond_t space_cond;
+    struct reaper_entry_s *entries;
+    uint32_t max_entries;
+    /* Slots in use, and the signals still waited on */
+    uint32_t num_entries;
+    uint32_t num_pending;
+    uint64_t next_sequence;
+    /* REAPER_WAIT_TIMEOUT_US in system timestamp ticks */
+    uint64_t wait_timeout;
+    int exit_flag;
+    reaper_counters_t counters;
+};
+
+typedef struct reaper_s reaper_t;
+
+/**
+ * @brief create a reaper and start its thread
+ * @param max_entries Maximum number of outstanding signals
+ * @return the reaper, NULL on failure
+ */
+reaper_t* reaper_create(uint32_t max_entries);
+
+/**
+ * @brief wait for all of the outstanding signals, stop the thread and
+ * destroy the reaper
+ * @param reaper Pointer to the reaper
+ */
+void reaper_destroy(reaper_t *reaper);
+
+/**
+ * @brief add a signal to be waited on, blocking while max_entries signals
+ * are outstanding
+ * @param reaper Pointer to the reaper
+ * @param signal The signal
+ * @param condition The condition, as for hsa_signal_wait_acquire
+ * @param compare_value The value compared with the value of the signal
+ * @param callback Function called once the condition is satisfied
+ * @param data Passed to the callback
+ */
+void reaper_add(reaper_t *reaper,
+                hsa_signal_t signal,
+                hsa_signal_condition_t condition,
+                hsa_signal_value_t compare_value,
+                reaper_callback_t callback,
+                void *data);
+
+/**
+ * @brief wait until the callbacks of all of the outstanding signals have
+ * returned
+ * @param reaper Pointer to the reaper
+ */
+void reaper_drain(reaper_t *reaper);
+
+/**
+ * @brief get the statistics of the reaper
+ * @param reaper Pointer to the reaper
+ * @param counters The counters
+ */
+void reaper_get_counters(reaper_t *reaper, reaper_counters_t *counters);
+
+#endif  // _REAPER_UTILS_H_
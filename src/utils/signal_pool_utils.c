@@ -0,0 +1,292 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "signal_pool_utils.h"
+
+// The counters of a thread are only written by the thread, but may be read by any
+static void counter_add(uint64_t *counter, uint64_t value) {
+    __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+static void counters_sum(signal_pool_counters_t *sum, signal_pool_counters_t *counters) {
+    sum->acquisitions += __atomic_load_n(&counters->acquisitions, __ATOMIC_RELAXED);
+    sum->releases += __atomic_load_n(&counters->releases, __ATOMIC_RELAXED);
+    sum->cache_hits += __atomic_load_n(&counters->cache_hits, __ATOMIC_RELAXED);
+    sum->cache_refills += __atomic_load_n(&counters->cache_refills, __ATOMIC_RELAXED);
+    sum->cache_flushes += __atomic_load_n(&counters->cache_flushes, __ATOMIC_RELAXED);
+    sum->exhausted += __atomic_load_n(&counters->exhausted, __ATOMIC_RELAXED);
+    return;
+}
+
+// Add a free signal to the shared ring, which has room for every signal of the pool
+static void ring_enqueue(signal_pool_t *pool, hsa_signal_t signal) {
+    struct signal_pool_cell_s *cell;
+    uint64_t pos = __atomic_load_n(&pool->enqueue_pos, __ATOMIC_RELAXED);
+    while (1) {
+        cell = &pool->cells[pos & pool->mask];
+        int64_t diff = (int64_t) (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - pos);
+        if (0 == diff) {
+            if (__atomic_compare_exchange_n(&pool->enqueue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else {
+            pos = __atomic_load_n(&pool->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+    cell->signal = signal;
+    __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+    return;
+}
+
+// Take a free signal from the shared ring, return 0 if the ring is empty
+static int ring_dequeue(signal_pool_t *pool, hsa_signal_t *signal) {
+    struct signal_pool_cell_s *cell;
+    uint64_t pos = __atomic_load_n(&pool->dequeue_pos, __ATOMIC_RELAXED);
+    while (1) {
+        cell = &pool->cells[pos & pool->mask];
+        int64_t diff = (int64_t) (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - (pos + 1));
+        if (0 == diff) {
+            if (__atomic_compare_exchange_n(&pool->dequeue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0 && pos == __atomic_load_n(&pool->enqueue_pos, __ATOMIC_RELAXED)) {
+            return 0;
+        } else {
+            // Either another thread took the cell, or the cell has been
+            // claimed by an enqueue that is about to fill it
+            pos = __atomic_load_n(&pool->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+    *signal = cell->signal;
+    __atomic_store_n(&cell->sequence, pos + pool->mask + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+// Return the signals of an exiting thread to the pool
+static void release_cache(void *data) {
+    struct signal_pool_cache_s *cache = (struct signal_pool_cache_s*) data;
+    signal_pool_t *pool = cache->pool;
+
+    while (cache->count > 0) {
+        ring_enqueue(pool, cache->signals[--cache->count]);
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    counters_sum(&pool->retired_counters, &cache->counters);
+    struct signal_pool_cache_s **link = &pool->caches;
+    while (*link != cache) {
+        link = &(*link)->next;
+    }
+    *link = cache->next;
+    pthread_mutex_unlock(&pool->mutex);
+
+    free(cache);
+    return;
+}
+
+static struct signal_pool_cache_s* get_cache(signal_pool_t *pool) {
+    struct signal_pool_cache_s *cache = (struct signal_pool_cache_s*) pthread_getspecific(pool->cache_key);
+    if (NULL != cache) {
+        return cache;
+    }
+
+    cache = (struct signal_pool_cache_s*) calloc(1, sizeof(struct signal_pool_cache_s));
+    if (NULL == cache) {
+        return NULL;
+    }
+    cache->pool = pool;
+    if (0 != pthread_setspecific(pool->cache_key, cache)) {
+        free(cache);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    cache->next = pool->caches;
+    pool->caches = cache;
+    pthread_mutex_unlock(&pool->mutex);
+
+    return cache;
+}
+
+signal_pool_t* signal_pool_create(uint32_t num_signals) {
+    if (0 == num_signals) {
+        return NULL;
+    }
+
+    signal_pool_t *pool = (signal_pool_t*) malloc(sizeof(signal_pool_t));
+    if (NULL == pool) {
+        return NULL;
+    }
+    memset(pool, 0, sizeof(signal_pool_t));
+
+    if (0 != pthread_key_create(&pool->cache_key, release_cache)) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->mutex, NULL);
+
+    uint64_t num_cells = 1;
+    while (num_cells < num_signals) {
+        num_cells <<= 1;
+    }
+    pool->mask = num_cells - 1;
+    pool->cells = (struct signal_pool_cell_s*) malloc(num_cells * sizeof(struct signal_pool_cell_s));
+    pool->signals = (hsa_signal_t*) malloc(num_signals * sizeof(hsa_signal_t));
+    if (NULL == pool->cells || NULL == pool->signals) {
+        signal_pool_destroy(pool);
+        return NULL;
+    }
+
+    uint64_t ii;
+    for (ii = 0; ii < num_cells; ++ii) {
+        pool->cells[ii].sequence = ii;
+    }
+
+    for (ii = 0; ii < num_signals; ++ii) {
+        if (HSA_STATUS_SUCCESS != hsa_signal_create(0, 0, NULL, &pool->signals[ii])) {
+            signal_pool_destroy(pool);
+            return NULL;
+        }
+        ++pool->num_signals;
+        ring_enqueue(pool, pool->signals[ii]);
+    }
+
+    return pool;
+}
+
+void signal_pool_destroy(signal_pool_t *pool) {
+    // Threads that are still running lose their cache with the key
+    pthread_key_delete(pool->cache_key);
+    while (NULL != pool->caches) {
+        struct signal_pool_cache_s *cache = pool->caches;
+        pool->caches = cache->next;
+        free(cache);
+    }
+
+    uint32_t ii;
+    for (ii = 0; ii < pool->num_signals; ++ii) {
+        hsa_signal_destroy(pool->signals[ii]);
+    }
+    free(pool->signals);
+    free(pool->cells);
+
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool);
+    return;
+}
+
+hsa_status_t signal_pool_acquire(signal_pool_t *pool, hsa_signal_value_t initial_value, hsa_signal_t *signal) {
+    struct signal_pool_cache_s *cache = get_cache(pool);
+    if (NULL == cache) {
+        return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+    }
+
+    if (0 < cache->count) {
+        counter_add(&cache->counters.cache_hits, 1);
+    } else {
+        while (cache->count < SIGNAL_POOL_CACHE_BATCH && ring_dequeue(pool, &cache->signals[cache->count])) {
+            ++cache->count;
+        }
+        if (0 == cache->count) {
+            counter_add(&cache->counters.exhausted, 1);
+            return HSA_STATUS_ERROR_OUT_OF_RESOURCES;
+        }
+        counter_add(&cache->counters.cache_refills, 1);
+    }
+
+    *signal = cache->signals[--cache->count];
+    // The release of the packet header orders the reset before the use by the agent
+    hsa_signal_store_relaxed(*signal, initial_value);
+    counter_add(&cache->counters.acquisitions, 1);
+
+    uint64_t in_use = __atomic_add_fetch(&pool->in_use, 1, __ATOMIC_RELAXED);
+    uint64_t high_water = __atomic_load_n(&pool->high_water, __ATOMIC_RELAXED);
+    while (high_water < in_use &&
+           !__atomic_compare_exchange_n(&pool->high_water, &high_water, in_use, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+    return HSA_STATUS_SUCCESS;
+}
+
+void signal_pool_release(signal_pool_t *pool, hsa_signal_t signal) {
+    struct signal_pool_cache_s *cache = get_cache(pool);
+    __atomic_sub_fetch(&pool->in_use, 1, __ATOMIC_RELAXED);
+    if (NULL == cache) {
+        ring_enqueue(pool, signal);
+        return;
+    }
+
+    // Make room by returning a batch to the shared ring
+    if (SIGNAL_POOL_CACHE_SIZE == cache->count) {
+        uint32_t ii;
+        for (ii = 0; ii < SIGNAL_POOL_CACHE_BATCH; ++ii) {
+            ring_enqueue(pool, cache->signals[--cache->count]);
+        }
+        counter_add(&cache->counters.cache_flushes, 1);
+    }
+
+    cache->signals[cache->count++] = signal;
+    counter_add(&cache->counters.releases, 1);
+    return;
+}
+
+void signal_pool_get_counters(signal_pool_t *pool, signal_pool_counters_t *counters) {
+    memset(counters, 0, sizeof(signal_pool_counters_t));
+
+    pthread_mutex_lock(&pool->mutex);
+    counters_sum(counters, &pool->retired_counters);
+    struct signal_pool_cache_s *cache;
+    for (cache = pool->caches; NULL != cache; cache = cache->next) {
+        counters_sum(counters, &cache->counters);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    counters->in_use = __atomic_load_n(&pool->in_use, __ATOMIC_RELAXED);
+    counters->high_water = __atomic_load_n(&pool->high_water, __ATOMIC_RELAXED);
+    return;
+}
@@ -0,0 +1,180 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+
+
+#ifndef _SIGNAL_POOL_UTILS_H_
+#define _SIGNAL_POOL_UTILS_H_
+
+#include <hsa.h>
+#include <pthread.h>
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of signals in a per-thread cache
+ */
+#define SIGNAL_POOL_CACHE_SIZE 32
+
+/**
+ * @brief Number of signals moved between a per-thread cache and the pool
+ * at a time
+ */
+#define SIGNAL_POOL_CACHE_BATCH 8
+
+/**
+ * @struct signal_pool_counters_s
+ * @brief Signal pool statistics
+ */
+struct signal_pool_counters_s {
+    /* Signals handed out and taken back */
+    uint64_t acquisitions;
+    uint64_t releases;
+    /* Acquisitions served by the per-thread cache */
+    uint64_t cache_hits;
+    /* Batches moved from the pool to a cache, and back */
+    uint64_t cache_refills;
+    uint64_t cache_flushes;
+    /* Acquisitions that failed because every signal was in use or cached */
+    uint64_t exhausted;
+    /* Signals handed out and not yet taken back, and the largest number so far */
+    uint64_t in_use;
+    uint64_t high_water;
+};
+
+typedef struct signal_pool_counters_s signal_pool_counters_t;
+
+/**
+ * @struct signal_pool_cell_s
+ * @brief A slot of the shared ring, the sequence number tells the producers
+ * and consumers whose turn it is
+ */
+struct signal_pool_cell_s {
+    uint64_t sequence;
+    hsa_signal_t signal;
+};
+
+/**
+ * @struct signal_pool_cache_s
+ * @brief Per-thread cache of free signals
+ */
+struct signal_pool_cache_s {
+    struct signal_pool_s *pool;
+    hsa_signal_t signals[SIGNAL_POOL_CACHE_SIZE];
+    uint32_t count;
+    signal_pool_counters_t counters;
+    struct signal_pool_cache_s *next;
+};
+
+/**
+ * @struct signal_pool_s
+ * @brief A pool of pre-created completion signals. Free signals are kept in
+ * a lock-free bounded ring shared by all of the threads, in front of which
+ * each thread keeps a small cache. A thread only takes the lock of the pool
+ * the first time it uses the pool, and when it exits.
+ */
+struct signal_pool_s {
+    /* Every signal of the pool */
+    hsa_signal_t *signals;
+    uint32_t num_signals;
+    /* The shared ring of free signals, a power of two sized */
+    struct signal_pool_cell_s *cells;
+    uint64_t mask;
+    uint64_t enqueue_pos;
+    uint64_t dequeue_pos;
+    /* Signals in use and the high-water mark */
+    uint64_t in_use;
+    uint64_t high_water;
+    /* Mutex protecting the list of caches and the retired counters */
+    pthread_mutex_t mutex;
+    pthread_key_t cache_key;
+    struct signal_pool_cache_s *caches;
+    signal_pool_counters_t retired_counters;
+};
+
+typedef struct signal_pool_s signal_pool_t;
+
+/**
+ * @brief create a pool of signals
+ * @param num_signals Number of signals to pre-create. Up to
+ * SIGNAL_POOL_CACHE_SIZE free signals may sit in the cache of each thread,
+ * so the pool should be sized for that on top of the signals in flight.
+ * @return the pool, NULL on failure
+ */
+signal_pool_t* signal_pool_create(uint32_t num_signals);
+
+/**
+ * @brief destroy a pool and all of its signals. All of the signals must
+ * have been released.
+ * @param pool Pointer to the pool
+ */
+void signal_pool_destroy(signal_pool_t *pool);
+
+/**
+ * @brief take a signal from the pool
+ * @param pool Pointer to the pool
+ * @param initial_value The value the signal is reset to
+ * @param signal The signal
+ * @return HSA_STATUS_SUCCESS, or HSA_STATUS_ERROR_OUT_OF_RESOURCES if no
+ * signal is available to the calling thread
+ */
+hsa_status_t signal_pool_acquire(signal_pool_t *pool, hsa_signal_value_t initial_value, hsa_signal_t *signal);
+
+/**
+ * @brief return a signal to the pool. The signal must not be used by the
+ * agents anymore, e.g. its completion must have been observed.
+ * @param pool Pointer to the pool
+ * @param signal The signal
+ */
+void signal_pool_release(signal_pool_t *pool, hsa_signal_t signal);
+
+/**
+ * @brief sum up the counters of all of the threads using the pool
+ * @param pool Pointer to the pool
+ * @param counters The counters
+ */
+void signal_pool_get_counters(signal_pool_t *pool, signal_pool_counters_t *counters);
+
+#endif  // _SIGNAL_POOL_UTILS_H_
@@ -0,0 +1,360 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include "soft_queue_utils.h"
+
+// Maximum time the processor sleeps on the doorbell before checking for a stop request, in us
+#define SOFT_QUEUE_DOORBELL_TIMEOUT_US 1000
+
+static uint8_t packet_type(uint16_t header) {
+    return (header >> HSA_PACKET_HEADER_TYPE) & ((1 << HSA_PACKET_HEADER_WIDTH_TYPE) - 1);
+}
+
+static uint8_t packet_fence_scope(uint16_t header, hsa_packet_header_t field) {
+    return (header >> field) & ((1 << HSA_PACKET_HEADER_WIDTH_ACQUIRE_FENCE_SCOPE) - 1);
+}
+
+// Apply the release fence of a packet and decrement its completion signal
+static void complete_packet(uint16_t header, hsa_signal_t completion_signal) {
+    if (HSA_FENCE_SCOPE_NONE != packet_fence_scope(header, HSA_PACKET_HEADER_RELEASE_FENCE_SCOPE)) {
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+
+    if (0 != completion_signal.handle) {
+        hsa_signal_subtract_release(completion_signal, 1);
+    }
+
+    return;
+}
+
+static void execute_agent_dispatch(soft_queue_processor_t *processor, hsa_agent_dispatch_packet_t *packet) {
+    struct soft_queue_dispatch_entry_s *entry = &processor->dispatch_table[packet->type];
+    entry->function(packet, entry->data);
+    complete_packet(packet->header, packet->completion_signal);
+    return;
+}
+
+// Worker thread function, executes the agent dispatch packets in the work ring
+static void* worker_thread_proc(void *input) {
+    soft_queue_processor_t *processor = (soft_queue_processor_t*) input;
+    hsa_agent_dispatch_packet_t packet;
+
+    pthread_mutex_lock(&processor->mutex);
+    while (1) {
+        while (processor->work_head == processor->work_tail && !processor->drained) {
+            pthread_cond_wait(&processor->work_cond, &processor->mutex);
+        }
+        if (processor->work_head == processor->work_tail) {
+            // Drained and no work left
+            break;
+        }
+
+        packet = processor->work_ring[processor->work_head % processor->work_ring_size];
+        ++processor->work_head;
+        pthread_cond_signal(&processor->space_cond);
+        pthread_mutex_unlock(&processor->mutex);
+
+        execute_agent_dispatch(processor, &packet);
+
+        pthread_mutex_lock(&processor->mutex);
+        if (0 == --processor->in_flight) {
+            pthread_cond_broadcast(&processor->idle_cond);
+        }
+    }
+    pthread_mutex_unlock(&processor->mutex);
+
+    return NULL;
+}
+
+// Hand an agent dispatch packet to the worker threads
+static void submit_agent_dispatch(soft_queue_processor_t *processor, hsa_agent_dispatch_packet_t *packet) {
+    pthread_mutex_lock(&processor->mutex);
+    while (processor->work_tail - processor->work_head == processor->work_ring_size) {
+        pthread_cond_wait(&processor->space_cond, &processor->mutex);
+    }
+    processor->work_ring[processor->work_tail % processor->work_ring_size] = *packet;
+    ++processor->work_tail;
+    ++processor->in_flight;
+    pthread_cond_signal(&processor->work_cond);
+    pthread_mutex_unlock(&processor->mutex);
+    return;
+}
+
+// Wait until all launched packets have completed
+static void wait_idle(soft_queue_processor_t *processor) {
+    pthread_mutex_lock(&processor->mutex);
+    while (0 != processor->in_flight) {
+        pthread_cond_wait(&processor->idle_cond, &processor->mutex);
+    }
+    pthread_mutex_unlock(&processor->mutex);
+    return;
+}
+
+static void execute_barrier_and(soft_queue_processor_t *processor, hsa_barrier_and_packet_t *packet) {
+    int ii;
+    for (ii = 0; ii < 5; ++ii) {
+        if (0 != packet->dep_signal[ii].handle) {
+            while (0 != hsa_signal_wait_acquire(packet->dep_signal[ii], HSA_SIGNAL_CONDITION_EQ, 0, UINT64_MAX, processor->wait_state));
+        }
+    }
+    complete_packet(packet->header, packet->completion_signal);
+    return;
+}
+
+static void execute_barrier_or(soft_queue_processor_t *processor, hsa_barrier_or_packet_t *packet) {
+    int ii, num_deps = 0;
+    for (ii = 0; ii < 5; ++ii) {
+        num_deps += (0 != packet->dep_signal[ii].handle);
+    }
+
+    // A barrier without dependencies completes immediately
+    while (num_deps > 0) {
+        int resolved = 0;
+        for (ii = 0; ii < 5; ++ii) {
+            if (0 != packet->dep_signal[ii].handle && 0 == hsa_signal_load_acquire(packet->dep_signal[ii])) {
+                resolved = 1;
+                break;
+            }
+        }
+        if (resolved) {
+            break;
+        }
+        if (HSA_WAIT_STATE_BLOCKED == processor->wait_state) {
+            sched_yield();
+        }
+    }
+    complete_packet(packet->header, packet->completion_signal);
+    return;
+}
+
+// Wait until the doorbell indicates the packet at read_index may have been published
+static void wait_doorbell(soft_queue_processor_t *processor, uint64_t read_index) {
+    hsa_signal_value_t value = hsa_signal_wait_acquire(processor->queue->doorbell_signal,
+                                                       HSA_SIGNAL_CONDITION_GTE,
+                                                       (hsa_signal_value_t) read_index,
+                                                       processor->wait_timeout,
+                                                       processor->wait_state);
+    ++processor->doorbell_waits;
+
+    // The doorbell was rung past read_index, but the packet header hasn't been
+    // published yet. This happens with multiple producers or reserved packets.
+    if (value >= (hsa_signal_value_t) read_index) {
+        sched_yield();
+    }
+
+    return;
+}
+
+// Packet processor thread function
+static void* processor_thread_proc(void *input) {
+    soft_queue_processor_t *processor = (soft_queue_processor_t*) input;
+    hsa_queue_t *queue = processor->queue;
+    const uint32_t queue_mask = queue->size - 1;
+    hsa_agent_dispatch_packet_t *packets = (hsa_agent_dispatch_packet_t*) queue->base_address;
+
+    uint64_t read_index = hsa_queue_load_read_index_relaxed(queue);
+    while (HSA_STATUS_SUCCESS == processor->status) {
+        hsa_agent_dispatch_packet_t *slot = &packets[read_index & queue_mask];
+        uint16_t header = __atomic_load_n(&slot->header, __ATOMIC_ACQUIRE);
+        uint8_t type = packet_type(header);
+
+        if (HSA_PACKET_TYPE_INVALID == type) {
+            if (processor->stop_requested) {
+                break;
+            }
+            wait_doorbell(processor, read_index);
+            continue;
+        }
+
+        // Copy the packet, the slot is released once the packet is launched
+        hsa_agent_dispatch_packet_t packet;
+        memcpy(&packet, slot, sizeof(hsa_agent_dispatch_packet_t));
+        packet.header = header;
+
+        if (header & (1 << HSA_PACKET_HEADER_BARRIER)) {
+            wait_idle(processor);
+        }
+
+        if (HSA_FENCE_SCOPE_NONE != packet_fence_scope(header, HSA_PACKET_HEADER_ACQUIRE_FENCE_SCOPE)) {
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        }
+
+        switch (type) {
+        case HSA_PACKET_TYPE_AGENT_DISPATCH:
+            if (packet.type >= SOFT_QUEUE_DISPATCH_TABLE_SIZE || NULL == processor->dispatch_table[packet.type].function) {
+                processor->status = HSA_STATUS_ERROR_INVALID_PACKET_FORMAT;
+                break;
+            }
+            ++processor->agent_dispatch_packets;
+            if (0 == processor->num_workers || (header & (1 << HSA_PACKET_HEADER_BARRIER))) {
+                execute_agent_dispatch(processor, &packet);
+            } else {
+                submit_agent_dispatch(processor, &packet);
+            }
+            break;
+        case HSA_PACKET_TYPE_BARRIER_AND:
+            ++processor->barrier_packets;
+            execute_barrier_and(processor, (hsa_barrier_and_packet_t*) &packet);
+            break;
+        case HSA_PACKET_TYPE_BARRIER_OR:
+            ++processor->barrier_packets;
+            execute_barrier_or(processor, (hsa_barrier_or_packet_t*) &packet);
+            break;
+        default:
+            // Kernel dispatch and vendor specific packets can't be executed on the host
+            processor->status = HSA_STATUS_ERROR_INVALID_PACKET_FORMAT;
+            break;
+        }
+
+        if (HSA_STATUS_SUCCESS != processor->status) {
+            break;
+        }
+
+        // Release the packet slot
+        __atomic_store_n(&slot->header, HSA_PACKET_TYPE_INVALID << HSA_PACKET_HEADER_TYPE, __ATOMIC_RELAXED);
+        ++read_index;
+        hsa_queue_store_read_index_release(queue, read_index);
+        ++processor->packets_processed;
+    }
+
+    // Let the worker threads drain the work ring and exit
+    pthread_mutex_lock(&processor->mutex);
+    processor->drained = 1;
+    pthread_cond_broadcast(&processor->work_cond);
+    pthread_mutex_unlock(&processor->mutex);
+
+    return NULL;
+}
+
+soft_queue_processor_t* soft_queue_processor_create(hsa_queue_t *queue, uint32_t num_workers, hsa_wait_state_t wait_state) {
+    soft_queue_processor_t *processor = (soft_queue_processor_t*) malloc(sizeof(soft_queue_processor_t));
+    if (NULL == processor) {
+        return NULL;
+    }
+    memset(processor, 0, sizeof(soft_queue_processor_t));
+
+    processor->queue = queue;
+    processor->wait_state = wait_state;
+    processor->num_workers = num_workers;
+    processor->status = HSA_STATUS_SUCCESS;
+
+    uint64_t timestamp_frequency = 0;
+    hsa_system_get_info(HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY, &timestamp_frequency);
+    processor->wait_timeout = timestamp_frequency * SOFT_QUEUE_DOORBELL_TIMEOUT_US / 1000000;
+    if (0 == processor->wait_timeout) {
+        processor->wait_timeout = 1;
+    }
+
+    // The work ring never holds more packets than the queue does
+    processor->work_ring_size = queue->size;
+    processor->work_ring = (hsa_agent_dispatch_packet_t*) malloc(queue->size * sizeof(hsa_agent_dispatch_packet_t));
+    if (num_workers > 0) {
+        processor->worker_threads = (pthread_t*) malloc(num_workers * sizeof(pthread_t));
+    }
+    if (NULL == processor->work_ring || (num_workers > 0 && NULL == processor->worker_threads)) {
+        free(processor->work_ring);
+        free(processor->worker_threads);
+        free(processor);
+        return NULL;
+    }
+
+    pthread_mutex_init(&processor->mutex, NULL);
+    pthread_cond_init(&processor->work_cond, NULL);
+    pthread_cond_init(&processor->space_cond, NULL);
+    pthread_cond_init(&processor->idle_cond, NULL);
+
+    return processor;
+}
+
+int soft_queue_processor_register(soft_queue_processor_t *processor, uint16_t type, soft_queue_dispatch_fn_t function, void *data) {
+    if (type >= SOFT_QUEUE_DISPATCH_TABLE_SIZE) {
+        return -1;
+    }
+    processor->dispatch_table[type].function = function;
+    processor->dispatch_table[type].data = data;
+    return 0;
+}
+
+void soft_queue_processor_start(soft_queue_processor_t *processor) {
+    uint32_t ii;
+    processor->stop_requested = 0;
+    processor->drained = 0;
+    for (ii = 0; ii < processor->num_workers; ++ii) {
+        pthread_create(&processor->worker_threads[ii], NULL, worker_thread_proc, processor);
+    }
+    pthread_create(&processor->processor_thread, NULL, processor_thread_proc, processor);
+    return;
+}
+
+hsa_status_t soft_queue_processor_stop(soft_queue_processor_t *processor) {
+    uint32_t ii;
+
+    // The processor thread exits when it finds an empty packet slot, and
+    // tells the workers to exit once the work ring is empty. The workers
+    // don't see the request, so the packets already launched still run.
+    processor->stop_requested = 1;
+    pthread_join(processor->processor_thread, NULL);
+    for (ii = 0; ii < processor->num_workers; ++ii) {
+        pthread_join(processor->worker_threads[ii], NULL);
+    }
+
+    return processor->status;
+}
+
+void soft_queue_processor_destroy(soft_queue_processor_t *processor) {
+    pthread_cond_destroy(&processor->idle_cond);
+    pthread_cond_destroy(&processor->space_cond);
+    pthread_cond_destroy(&processor->work_cond);
+    pthread_mutex_destroy(&processor->mutex);
+    free(processor->worker_threads);
+    free(processor->work_ring);
+    free(processor);
+    return;
+}
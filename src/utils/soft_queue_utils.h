@@ -0,0 +1,170 @@
+/*
+ * =============================================================================
+ *   HSA Runtime Conformance Release License
+ * =============================================================================
+ * The University of Illinois/NCSA
+ * Open Source License (NCSA)
+ *
+ * Copyright (c) 2014, Advanced Micro Devices, Inc.
+ * All rights reserved.
+ *
+ * Developed by:
+ *
+ *                 AMD Research and AMD HSA Software Development
+ *
+ *                 Advanced Micro Devices, Inc.
+ *
+ *                 www.amd.com
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal with the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ *  - Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimers.
+ *  - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimers in
+ *    the documentation and/or other materials provided with the distribution.
+ *  - Neither the names of <Name of Development Group, Name of Institution>,
+ *    nor the names of its contributors may be used to endorse or promote
+ *    products derived from this Software without specific prior written
+ *    permission.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS WITH THE SOFTWARE.
+ *
+ */
+
+
+#ifndef _SOFT_QUEUE_UTILS_H_
+#define _SOFT_QUEUE_UTILS_H_
+
+#include <hsa.h>
+#include <pthread.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of entries in the agent dispatch callback table. Agent
+ * dispatch packets whose type field is outside the table are invalid.
+ */
+#define SOFT_QUEUE_DISPATCH_TABLE_SIZE 64
+
+/**
+ * @brief Function executing an agent dispatch packet. The function may write
+ * its results through the packet's return_address. The completion signal is
+ * decremented by the processor after the function returns.
+ * @param packet Copy of the agent dispatch packet
+ * @param data User data registered with the function
+ */
+typedef void (*soft_queue_dispatch_fn_t)(hsa_agent_dispatch_packet_t* packet, void* data);
+
+/**
+ * @struct soft_queue_dispatch_entry_s
+ * @brief An entry of the agent dispatch callback table
+ */
+struct soft_queue_dispatch_entry_s {
+    soft_queue_dispatch_fn_t function;
+    void* data;
+};
+
+/**
+ * @struct soft_queue_processor_s
+ * @brief A host packet processor consuming the AQL packets of a soft queue
+ * created with hsa_soft_queue_create. Packets are launched in order. Agent
+ * dispatch packets without the barrier bit are executed by a pool of worker
+ * threads and may complete out of order. Barrier-AND and Barrier-OR packets
+ * are executed by the processor thread.
+ */
+struct soft_queue_processor_s {
+    /* The soft queue */
+    hsa_queue_t *queue;
+    /* Wait state used when waiting on the doorbell and dependency signals */
+    hsa_wait_state_t wait_state;
+    /* Doorbell wait timeout, in HSA_SYSTEM_INFO_TIMESTAMP_FREQUENCY ticks */
+    uint64_t wait_timeout;
+    /* The agent dispatch callback table, indexed by the packet's type field */
+    struct soft_queue_dispatch_entry_s dispatch_table[SOFT_QUEUE_DISPATCH_TABLE_SIZE];
+    /* The packet processor thread */
+    pthread_t processor_thread;
+    /* The worker threads */
+    uint32_t num_workers;
+    pthread_t *worker_threads;
+    /* Ring of agent dispatch packets waiting for a worker */
+    hsa_agent_dispatch_packet_t *work_ring;
+    uint32_t work_ring_size;
+    uint64_t work_head;
+    uint64_t work_tail;
+    /* Number of launched packets that have not completed */
+    uint32_t in_flight;
+    /* Mutex and conditions protecting the work ring and in_flight */
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t space_cond;
+    pthread_cond_t idle_cond;
+    /* Set to stop the processor once the queue is empty, only read by the processor thread */
+    volatile int stop_requested;
+    /* Set under the mutex by the processor thread when it has stopped, the
+     * workers exit once it is set and the work ring is empty */
+    int drained;
+    /* Set by the processor when it finds an invalid packet and stops */
+    hsa_status_t status;
+    /* Counters */
+    volatile uint64_t packets_processed;
+    volatile uint64_t agent_dispatch_packets;
+    volatile uint64_t barrier_packets;
+    volatile uint64_t doorbell_waits;
+};
+
+typedef struct soft_queue_processor_s soft_queue_processor_t;
+
+/**
+ * @brief create a packet processor for a soft queue. The processor
+ * isn't started until soft_queue_processor_start is called.
+ * @param queue The soft queue
+ * @param num_workers Number of worker threads, 0 to execute all
+ * packets on the processor thread
+ * @param wait_state Wait state used when waiting on signals
+ * @return the packet processor, NULL on failure
+ */
+soft_queue_processor_t* soft_queue_processor_create(hsa_queue_t *queue, uint32_t num_workers, hsa_wait_state_t wait_state);
+
+/**
+ * @brief register the function executing agent dispatch packets of a type
+ * @param processor Pointer to the packet processor
+ * @param type The agent dispatch packet type
+ * @param function The function executing the packets
+ * @param data User data passed to the function
+ * @return 0 on success, -1 if type is outside the dispatch table
+ */
+int soft_queue_processor_register(soft_queue_processor_t *processor, uint16_t type, soft_queue_dispatch_fn_t function, void *data);
+
+/**
+ * @brief start the processor and worker threads
+ * @param processor Pointer to the packet processor
+ */
+void soft_queue_processor_start(soft_queue_processor_t *processor);
+
+/**
+ * @brief stop the processor once all of the packets published in the queue
+ * have been processed, and wait for the processor and worker threads to finish
+ * @param processor Pointer to the packet processor
+ * @return HSA_STATUS_SUCCESS, or HSA_STATUS_ERROR_INVALID_PACKET_FORMAT if the
+ * processor stopped on an invalid packet
+ */
+hsa_status_t soft_queue_processor_stop(soft_queue_processor_t *processor);
+
+/**
+ * @brief destroy a stopped packet processor, release all resources
+ * @param processor Pointer to the packet processor
+ */
+void soft_queue_processor_destroy(soft_queue_processor_t *processor);
+
+#endif  // _SOFT_QUEUE_UTILS_H_